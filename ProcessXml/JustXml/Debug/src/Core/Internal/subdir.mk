@@ -4,16 +4,31 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
+../src/Core/Internal/ChildIndex.cpp \
 ../src/Core/Internal/CoreAlgorithms.cpp \
-../src/Core/Internal/LookupTables.cpp 
+../src/Core/Internal/PathTree.cpp \
+../src/Core/Internal/ScanKernels.cpp \
+../src/Core/Internal/StructuralIndex.cpp \
+../src/Core/Internal/SymbolTable.cpp \
+../src/Core/Internal/WorkerPool.cpp 
 
 OBJS += \
+./src/Core/Internal/ChildIndex.o \
 ./src/Core/Internal/CoreAlgorithms.o \
-./src/Core/Internal/LookupTables.o 
+./src/Core/Internal/PathTree.o \
+./src/Core/Internal/ScanKernels.o \
+./src/Core/Internal/StructuralIndex.o \
+./src/Core/Internal/SymbolTable.o \
+./src/Core/Internal/WorkerPool.o 
 
 CPP_DEPS += \
+./src/Core/Internal/ChildIndex.d \
 ./src/Core/Internal/CoreAlgorithms.d \
-./src/Core/Internal/LookupTables.d 
+./src/Core/Internal/PathTree.d \
+./src/Core/Internal/ScanKernels.d \
+./src/Core/Internal/StructuralIndex.d \
+./src/Core/Internal/SymbolTable.d \
+./src/Core/Internal/WorkerPool.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
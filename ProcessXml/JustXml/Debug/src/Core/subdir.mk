@@ -5,15 +5,51 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
 ../src/Core/MemoryPool.cpp \
-../src/Core/XmlBase.cpp 
+../src/Core/ParseError.cpp \
+../src/Core/XmlAttribute.cpp \
+../src/Core/XmlBase.cpp \
+../src/Core/XmlBinder.cpp \
+../src/Core/XmlBindingGenerator.cpp \
+../src/Core/XmlDocument.cpp \
+../src/Core/XmlExtractor.cpp \
+../src/Core/XmlFile.cpp \
+../src/Core/XmlMapping.cpp \
+../src/Core/XmlNode.cpp \
+../src/Core/XmlQuery.cpp \
+../src/Core/XmlReader.cpp \
+../src/Core/XmlTape.cpp 
 
 OBJS += \
 ./src/Core/MemoryPool.o \
-./src/Core/XmlBase.o 
+./src/Core/ParseError.o \
+./src/Core/XmlAttribute.o \
+./src/Core/XmlBase.o \
+./src/Core/XmlBinder.o \
+./src/Core/XmlBindingGenerator.o \
+./src/Core/XmlDocument.o \
+./src/Core/XmlExtractor.o \
+./src/Core/XmlFile.o \
+./src/Core/XmlMapping.o \
+./src/Core/XmlNode.o \
+./src/Core/XmlQuery.o \
+./src/Core/XmlReader.o \
+./src/Core/XmlTape.o 
 
 CPP_DEPS += \
 ./src/Core/MemoryPool.d \
-./src/Core/XmlBase.d 
+./src/Core/ParseError.d \
+./src/Core/XmlAttribute.d \
+./src/Core/XmlBase.d \
+./src/Core/XmlBinder.d \
+./src/Core/XmlBindingGenerator.d \
+./src/Core/XmlDocument.d \
+./src/Core/XmlExtractor.d \
+./src/Core/XmlFile.d \
+./src/Core/XmlMapping.d \
+./src/Core/XmlNode.d \
+./src/Core/XmlQuery.d \
+./src/Core/XmlReader.d \
+./src/Core/XmlTape.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,288 @@
+/*
+ * ChildIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "ChildIndex.h"
+
+#include "CoreAlgorithms.h"
+#include "../XmlDocument.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <new>          // For placement new
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+template<class ItemType>
+child_index<ItemType> *child_index<ItemType>::lookup(const xml_node<ItemType> *node, std::size_t &word)
+{
+#if XPROC_CHILD_INDEX_LOOKUPS == 0
+	// Nodes have no word to count lookups in
+	(void)node;
+	(void)word;
+	return 0;
+#else
+	// Count the lookup; until index is built, word holds twice the number of lookups plus one
+	child_index *index = get(word);
+	if (index)
+	{
+		if (!index->m_stale)
+			return index;
+		if (++index->m_lookups < XPROC_CHILD_INDEX_LOOKUPS)
+			return 0;
+		index->m_lookups = 0;
+	}
+	else
+	{
+		word += word ? 2 : 3;
+		if ((word >> 1) < XPROC_CHILD_INDEX_LOOKUPS)
+			return 0;
+		word = 1;
+	}
+
+	// Narrow nodes are walked faster than hashed, but may grow later, so lookups are counted again
+	std::size_t count = 0;
+	for (xml_node<ItemType> *child = node->first_node(); child; child = child->next_sibling())
+		++count;
+	if (count < XPROC_CHILD_INDEX_MIN_CHILDREN)
+		return 0;
+
+	// Stale index is reused if it leaves room for the children to grow by half
+	if (!index || index->m_capacity < count + count / 2)
+	{
+		child_index *created = create(node, count * 2);
+		if (!created)
+			return 0;
+		index = created;
+		word = reinterpret_cast<std::size_t>(index);
+	}
+	index->build(node);
+	return index;
+#endif
+}
+
+template<class ItemType>
+xml_node<ItemType> *child_index<ItemType>::first(const ItemType *name, std::size_t size) const
+{
+	unsigned slot = *find_chain(name, size, hash_name(name, size));
+	if (!slot || !m_chains[slot - 1].first)
+		return 0;
+	return const_cast<xml_node<ItemType> *>(m_entries[m_chains[slot - 1].first - 1].node);
+}
+
+template<class ItemType>
+xml_node<ItemType> *child_index<ItemType>::last(const ItemType *name, std::size_t size) const
+{
+	unsigned slot = *find_chain(name, size, hash_name(name, size));
+	if (!slot || !m_chains[slot - 1].first)
+		return 0;
+	return const_cast<xml_node<ItemType> *>(m_entries[m_chains[slot - 1].last - 1].node);
+}
+
+template<class ItemType>
+xml_node<ItemType> *child_index<ItemType>::next(const xml_node<ItemType> *child) const
+{
+	unsigned next = m_entries[*find_entry(child) - 1].next;
+	return next ? const_cast<xml_node<ItemType> *>(m_entries[next - 1].node) : 0;
+}
+
+template<class ItemType>
+xml_node<ItemType> *child_index<ItemType>::previous(const xml_node<ItemType> *child) const
+{
+	unsigned previous = m_entries[*find_entry(child) - 1].previous;
+	return previous ? const_cast<xml_node<ItemType> *>(m_entries[previous - 1].node) : 0;
+}
+
+template<class ItemType>
+void child_index<ItemType>::inserted(xml_node<ItemType> *child)
+{
+	if (m_stale)
+		return;
+	if (m_count == m_capacity)
+	{
+		invalidate();
+		return;
+	}
+	add(child, !child->next_sibling());
+}
+
+template<class ItemType>
+void child_index<ItemType>::removed(const xml_node<ItemType> *child)
+{
+	if (m_stale)
+		return;
+	entry &removed = m_entries[*find_entry(child) - 1];
+	chain &same = m_chains[*find_chain(child->name(), child->name_size(), hash_name(child->name(), child->name_size())) - 1];
+	if (removed.previous)
+		m_entries[removed.previous - 1].next = removed.next;
+	else
+		same.first = removed.next;
+	if (removed.next)
+		m_entries[removed.next - 1].previous = removed.previous;
+	else
+		same.last = removed.previous;
+
+	// Slot of the entry stays occupied, so children placed after it in the node table are still found
+	removed.node = 0;
+}
+
+template<class ItemType>
+child_index<ItemType> *child_index<ItemType>::create(const xml_node<ItemType> *node, std::size_t capacity)
+{
+	xml_document<ItemType> *document = node->document();
+	if (!document)
+		return 0;
+	unsigned bits = 1;
+	while ((std::size_t(1) << bits) < capacity * 2)
+		++bits;
+	std::size_t slots = std::size_t(1) << bits;
+
+	// Index and its tables take one block; it is aligned to pointer size even if pool alignment is smaller,
+	// because the lowest bit of index address tells it apart from lookup count in word of node
+	std::size_t size = sizeof(child_index) + capacity * (sizeof(entry) + sizeof(chain)) + slots * 2 * sizeof(unsigned);
+	char *memory = static_cast<char *>(static_cast<memory_pool<ItemType> *>(document)->allocate_aligned(size + sizeof(void *)));
+	memory += (sizeof(void *) - reinterpret_cast<std::size_t>(memory) % sizeof(void *)) % sizeof(void *);
+	child_index *index = new(memory) child_index;
+	memory += sizeof(child_index);
+	index->m_entries = reinterpret_cast<entry *>(memory);
+	memory += capacity * sizeof(entry);
+	index->m_chains = reinterpret_cast<chain *>(memory);
+	memory += capacity * sizeof(chain);
+	index->m_chain_slots = reinterpret_cast<unsigned *>(memory);
+	memory += slots * sizeof(unsigned);
+	index->m_node_slots = reinterpret_cast<unsigned *>(memory);
+	index->m_capacity = capacity;
+	index->m_slot_count = slots;
+	index->m_slot_bits = bits;
+	return index;
+}
+
+template<class ItemType>
+void child_index<ItemType>::build(const xml_node<ItemType> *node)
+{
+	m_count = 0;
+	m_chain_count = 0;
+	for (std::size_t i = 0; i < m_slot_count; ++i)
+		m_chain_slots[i] = m_node_slots[i] = 0;
+	for (xml_node<ItemType> *child = node->first_node(); child; child = child->next_sibling())
+		add(child, true);
+	m_lookups = 0;
+	m_stale = false;
+}
+
+template<class ItemType>
+void child_index<ItemType>::add(const xml_node<ItemType> *child, bool at_end)
+{
+	unsigned number = static_cast<unsigned>(++m_count);
+	entry &added = m_entries[number - 1];
+	added.node = child;
+	added.next = 0;
+	added.previous = 0;
+	std::size_t slot = node_slot(child);
+	while (m_node_slots[slot])
+		slot = (slot + 1) & (m_slot_count - 1);
+	m_node_slots[slot] = number;
+
+	// Child starts a chain if it is the only one with its name
+	unsigned code = hash_name(child->name(), child->name_size());
+	unsigned *chain_slot = find_chain(child->name(), child->name_size(), code);
+	if (!*chain_slot)
+	{
+		*chain_slot = static_cast<unsigned>(++m_chain_count);
+		m_chains[*chain_slot - 1].first = 0;
+	}
+	chain &same = m_chains[*chain_slot - 1];
+	if (!same.first)
+	{
+		same.hash = code;
+		same.first = same.last = number;
+		return;
+	}
+
+	// Otherwise it follows the nearest preceding sibling with the same name, or leads the chain if there is none
+	unsigned after = 0;
+	if (at_end)
+		after = same.last;
+	else
+	{
+		for (const xml_node<ItemType> *sibling = child->previous_sibling(); sibling; sibling = sibling->previous_sibling())
+			if (compare(sibling->name(), sibling->name_size(), child->name(), child->name_size(), true))
+			{
+				after = *find_entry(sibling);
+				break;
+			}
+	}
+	if (after)
+	{
+		added.previous = after;
+		added.next = m_entries[after - 1].next;
+		if (added.next)
+			m_entries[added.next - 1].previous = number;
+		else
+			same.last = number;
+		m_entries[after - 1].next = number;
+	}
+	else
+	{
+		added.next = same.first;
+		m_entries[same.first - 1].previous = number;
+		same.first = number;
+	}
+}
+
+template<class ItemType>
+unsigned *child_index<ItemType>::find_chain(const ItemType *name, std::size_t size, unsigned code) const
+{
+	// Empty chains keep their slots, so probing goes on past them; the first one is reused for a new name
+	unsigned *reusable = 0;
+	std::size_t slot = code & (m_slot_count - 1);
+	for (; m_chain_slots[slot]; slot = (slot + 1) & (m_slot_count - 1))
+	{
+		const chain &candidate = m_chains[m_chain_slots[slot] - 1];
+		if (!candidate.first)
+		{
+			if (!reusable)
+				reusable = m_chain_slots + slot;
+			continue;
+		}
+		if (candidate.hash != code)
+			continue;
+		const xml_node<ItemType> *node = m_entries[candidate.first - 1].node;
+		if (compare(node->name(), node->name_size(), name, size, true))
+			return m_chain_slots + slot;
+	}
+	return reusable ? reusable : m_chain_slots + slot;
+}
+
+template<class ItemType>
+unsigned *child_index<ItemType>::find_entry(const xml_node<ItemType> *child) const
+{
+	std::size_t slot = node_slot(child);
+	while (m_node_slots[slot] && m_entries[m_node_slots[slot] - 1].node != child)
+		slot = (slot + 1) & (m_slot_count - 1);
+	return m_node_slots + slot;
+}
+
+template<class ItemType>
+std::size_t child_index<ItemType>::node_slot(const xml_node<ItemType> *child) const
+{
+	// Fibonacci hashing of the address; nodes lie close together in the pool, so its high bits are taken
+	unsigned address = static_cast<unsigned>(reinterpret_cast<std::size_t>(child) / sizeof(void *));
+	return (address * 2654435769u) >> (32 - m_slot_bits);
+}
+
+// Explicit instantiations
+template class child_index<char>;
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
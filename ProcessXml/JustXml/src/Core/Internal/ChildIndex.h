@@ -0,0 +1,140 @@
+/*
+ * ChildIndex.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_CHILDINDEX_H_
+#define SRC_CORE_INTERNAL_CHILDINDEX_H_
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#endif
+
+#ifndef XPROC_CHILD_INDEX_LOOKUPS
+// Number of name lookups among children of a node after which an index of its children is built, or 0 to never build indexes.
+// Define XPROC_CHILD_INDEX_LOOKUPS for every translation unit to enable indexes; 8 suits repeated lookups among wide nodes.
+// Each node then holds a word for its index, and lookups, though const, count themselves in that word and build
+// the index from the memory pool of the document. Lookups on one document from several threads then race,
+// so they must be serialized; by default no node has the word, and lookups only read the tree.
+#define XPROC_CHILD_INDEX_LOOKUPS 0
+#endif
+
+#ifndef XPROC_CHILD_INDEX_MIN_CHILDREN
+// Smallest number of children of a node for which an index is built; walking fewer children is about as fast as hashing.
+// Define XPROC_CHILD_INDEX_MIN_CHILDREN before including XmlDocument.h if you want to override the default value.
+#define XPROC_CHILD_INDEX_MIN_CHILDREN 32
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<class ItemType> class xml_node;
+
+namespace xinternal
+{
+
+// Index of children of a wide node by name, making case-sensitive first_node(name) and last_node(name) lookups,
+// and next_sibling(name) and previous_sibling(name) lookups from a child with that name, O(1) on average.
+// Node keeps a word which holds the number of lookups made so far, until they reach XPROC_CHILD_INDEX_LOOKUPS
+// and the index is built from memory pool of the document.
+// Changes to children keep the index up to date; if there is no room left in it, or a child is renamed,
+// the index goes stale and is rebuilt after another XPROC_CHILD_INDEX_LOOKUPS lookups.
+template<class ItemType>
+class child_index
+{
+public:
+
+	// Gets index of node to use for a lookup among its children, or 0 to walk the children.
+	// Lookup is counted towards building or rebuilding the index.
+	static child_index *lookup(const xml_node<ItemType> *, std::size_t &);
+
+	// Gets index from word of node, or 0 if none was built
+	static child_index *get(std::size_t word)
+	{
+		return (word & 1) ? 0 : reinterpret_cast<child_index *>(word);
+	}
+
+	// First child with name, or 0 if none
+	xml_node<ItemType> *first(const ItemType *, std::size_t) const;
+
+	// Last child with name, or 0 if none
+	xml_node<ItemType> *last(const ItemType *, std::size_t) const;
+
+	// Next sibling of child with the same name, or 0 if none
+	xml_node<ItemType> *next(const xml_node<ItemType> *) const;
+
+	// Previous sibling of child with the same name, or 0 if none
+	xml_node<ItemType> *previous(const xml_node<ItemType> *) const;
+
+	// Adds child, which has already been linked among children of the node
+	void inserted(xml_node<ItemType> *);
+
+	// Removes child, which may already be unlinked from children of the node
+	void removed(const xml_node<ItemType> *);
+
+	// Marks index as out of date
+	void invalidate()
+	{
+		m_stale = true;
+		m_lookups = 0;
+	}
+
+private:
+
+	// Child in the index
+	struct entry
+	{
+		const xml_node<ItemType> *node;     // Child, or 0 if it was removed
+		unsigned next;                      // Next child with the same name, as entry number plus 1, or 0 if none
+		unsigned previous;                  // Previous child with the same name, as entry number plus 1, or 0 if none
+	};
+
+	// Children with the same name, in document order
+	struct chain
+	{
+		unsigned hash;                      // Hash of name
+		unsigned first;                     // First child, as entry number plus 1, or 0 if chain is empty and its slot can be reused
+		unsigned last;                      // Last child, as entry number plus 1; valid only if first is non-zero
+	};
+
+	// Allocates index from memory pool of document of node, with room for given number of children, or returns 0 if node has no document
+	static child_index *create(const xml_node<ItemType> *, std::size_t);
+
+	// Fills index with current children of node
+	void build(const xml_node<ItemType> *);
+
+	// Adds entry for child, placing it last among children with its name if it is known to be the last child
+	void add(const xml_node<ItemType> *, bool);
+
+	// Finds slot of chain of name, or empty slot where it belongs if there is none
+	unsigned *find_chain(const ItemType *, std::size_t, unsigned) const;
+
+	// Finds slot of entry of child, which must be in the index
+	unsigned *find_entry(const xml_node<ItemType> *) const;
+
+	// Slot in node table for child
+	std::size_t node_slot(const xml_node<ItemType> *) const;
+
+	entry *m_entries;                   // Children, in order of insertion
+	std::size_t m_count;                // Entries used, including those of removed children
+	std::size_t m_capacity;             // Entries allocated; number of chains is never larger
+	chain *m_chains;                    // Chains of children with the same name
+	std::size_t m_chain_count;          // Chains used
+	unsigned *m_chain_slots;            // Open addressing slots holding chain number plus 1, or 0 if empty
+	unsigned *m_node_slots;             // Open addressing slots holding entry number plus 1, or 0 if empty
+	std::size_t m_slot_count;           // Number of slots in each table, power of 2 at least twice the capacity
+	unsigned m_slot_bits;               // Base 2 logarithm of number of slots
+	unsigned m_lookups;                 // Lookups made since index went stale
+	bool m_stale;                       // Whether index is out of date and must not be used
+};
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_CHILDINDEX_H_ */
@@ -0,0 +1,280 @@
+/*
+ * CompactLayout.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_COMPACTLAYOUT_H_
+#define SRC_CORE_INTERNAL_COMPACTLAYOUT_H_
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#include <cassert>      // For assert
+#endif
+
+// Define XPROC_COMPACT_NODES to lay out nodes and attributes in about half the memory:
+// without a virtual destructor, with 32-bit lengths, and with 32-bit offsets in place of pointers to nodes, attributes and strings.
+// Each memory pool then takes its memory from a cage, 2 GB of address space aligned to its size, reserved when the pool first allocates.
+// Offsets are taken from the start of the cage holding the object, which is found by masking its address;
+// strings may instead lie in the text being parsed, up to 2 GB long, which the cage header records.
+// The document itself lies outside any cage, so it cannot have a name or value.
+// The macro must be defined the same way for every translation unit, and it needs a 64-bit system with mmap().
+// Limits and costs of the layout:
+// - text parsed may be at most 2 GB long, including its terminator, and a pool may hold at most 2 GB, so larger documents cannot be parsed;
+// - parsing does more work per node, encoding every link as an offset, and may take longer than with the default layout,
+//   while walking the tree touches half the memory (see test/bench/BenchParse.cpp and BenchQuery.cpp in both build variants);
+// - xml_document::parse_parallel() parses in one thread.
+#if defined(XPROC_COMPACT_NODES)
+#if !(defined(__unix__) || defined(__APPLE__) || defined(__CYGWIN__)) || !(defined(__x86_64__) || defined(__aarch64__) || defined(__powerpc64__))
+#error XPROC_COMPACT_NODES needs a 64-bit system with mmap()
+#endif
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+#if defined(XPROC_COMPACT_NODES)
+
+// Size and alignment of a cage, and the longest text strings can be kept in
+const std::size_t cage_size = std::size_t(1) << 31;
+
+// Start of a cage
+struct cage_header
+{
+	void *pool;                     // Memory pool owning the cage
+	void *document;                 // Document owning the pool, as xml_node, or 0 for a standalone pool
+	const char *text;               // Start of text of the last parse, or 0
+	const char *text_end;           // End of text of the last parse, including terminator
+};
+
+// Offset standing for the document, which is not in the cage; the header lies there, so no other object can
+const unsigned cage_document = 1;
+
+// Gets start of cage holding address
+inline char *cage_of(const void *address)
+{
+	return reinterpret_cast<char *>(reinterpret_cast<std::size_t>(address) & ~(cage_size - 1));
+}
+
+// Pointer stored as offset in the cage holding the pointer itself.
+// It may point outside the cage only to the document of its pool.
+template<class T>
+class cage_ptr
+{
+public:
+
+	cage_ptr(){}
+
+	explicit cage_ptr(T *pointer)
+	{
+		*this = pointer;
+	}
+
+	cage_ptr(const cage_ptr &other)
+	{
+		*this = static_cast<T *>(other);
+	}
+
+	operator T *() const
+	{
+		if (m_offset > cage_document)
+			return reinterpret_cast<T *>(cage_of(this) + m_offset);
+		return m_offset ? static_cast<T *>(reinterpret_cast<cage_header *>(cage_of(this))->document) : 0;
+	}
+
+	T *operator ->() const
+	{
+		return *this;
+	}
+
+	cage_ptr &operator =(T *pointer)
+	{
+		char *cage = cage_of(this);
+		if (!pointer)
+			m_offset = 0;
+		else if (cage_of(pointer) == cage)
+			m_offset = static_cast<unsigned>(reinterpret_cast<const char *>(pointer) - cage);
+		else
+		{
+			assert(static_cast<void *>(pointer) == reinterpret_cast<cage_header *>(cage)->document);
+			m_offset = cage_document;
+		}
+		return *this;
+	}
+
+	cage_ptr &operator =(const cage_ptr &other)
+	{
+		return *this = static_cast<T *>(other);
+	}
+
+private:
+
+	unsigned m_offset;              // Offset of target in the cage, cage_document, or 0 for null
+};
+
+// Pointer to string stored as offset in the cage holding the pointer itself, or with the top bit set, in the text of its header
+template<class T>
+class cage_string
+{
+public:
+
+	cage_string(){}
+
+	explicit cage_string(T *pointer)
+	{
+		*this = pointer;
+	}
+
+	cage_string(const cage_string &other)
+	{
+		*this = static_cast<T *>(other);
+	}
+
+	operator T *() const
+	{
+		if (m_offset & text_bit)
+			return reinterpret_cast<T *>(const_cast<char *>(reinterpret_cast<cage_header *>(cage_of(this))->text) + (m_offset & ~text_bit));
+		return m_offset ? reinterpret_cast<T *>(cage_of(this) + m_offset) : 0;
+	}
+
+	cage_string &operator =(T *pointer)
+	{
+		char *cage = cage_of(this);
+		const char *address = reinterpret_cast<const char *>(pointer);
+		if (!pointer)
+			m_offset = 0;
+		else if (cage_of(address) == cage)
+			m_offset = static_cast<unsigned>(address - cage);
+		else
+		{
+			assert(in_text(address));
+			m_offset = static_cast<unsigned>(address - reinterpret_cast<cage_header *>(cage)->text) | text_bit;
+		}
+		return *this;
+	}
+
+	cage_string &operator =(const cage_string &other)
+	{
+		return *this = static_cast<T *>(other);
+	}
+
+	// Checks if string can be stored without a copy, in the cage holding the pointer or in its text
+	bool in_text(const void *address) const
+	{
+		const cage_header *header = reinterpret_cast<cage_header *>(cage_of(this));
+		return address >= header->text && address < header->text_end;
+	}
+
+private:
+
+	static const unsigned text_bit = 1u << 31;
+
+	unsigned m_offset;              // Offset of target in the cage, or in the text with text_bit, or 0 for null
+};
+
+// Pointer from a node to the ends of its lists of children and attributes,
+// stored as offset in a cage given on access, because the document is not in a cage
+template<class T>
+class head_ptr
+{
+public:
+
+	head_ptr(){}
+
+	explicit head_ptr(T *pointer)
+	: m_offset(0)
+	{
+		assert(!pointer);
+	}
+
+	T *get(const char *cage) const
+	{
+		return m_offset ? reinterpret_cast<T *>(const_cast<char *>(cage) + m_offset) : 0;
+	}
+
+	void set(const char *cage, const T *pointer)
+	{
+		assert(!pointer || cage_of(pointer) == cage);     // Nodes of one tree must come from one pool
+		m_offset = pointer ? static_cast<unsigned>(reinterpret_cast<const char *>(pointer) - cage) : 0;
+	}
+
+private:
+
+	unsigned m_offset;              // Offset of target in the cage, or 0 for null
+};
+
+// Pointer from a node or attribute
+template<class T>
+struct link_ptr
+{
+	typedef cage_ptr<T> type;
+};
+
+// Pointer from a node or attribute to a string
+template<class T>
+struct string_ptr
+{
+	typedef cage_string<T> type;
+};
+
+// Length of a name or value
+typedef unsigned size_field;
+
+#else
+
+// Pointer from a node or attribute
+template<class T>
+struct link_ptr
+{
+	typedef T *type;
+};
+
+// Pointer from a node to the ends of its lists of children and attributes; cage is ignored
+template<class T>
+class head_ptr
+{
+public:
+
+	head_ptr(){}
+
+	explicit head_ptr(T *pointer)
+	: m_pointer(pointer){}
+
+	T *get(const char *) const
+	{
+		return m_pointer;
+	}
+
+	void set(const char *, T *pointer)
+	{
+		m_pointer = pointer;
+	}
+
+private:
+
+	T *m_pointer;
+};
+
+// Pointer from a node or attribute to a string
+template<class T>
+struct string_ptr
+{
+	typedef T *type;
+};
+
+// Length of a name or value
+typedef std::size_t size_field;
+
+#endif
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_COMPACTLAYOUT_H_ */
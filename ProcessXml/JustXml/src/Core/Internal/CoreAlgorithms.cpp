@@ -6,6 +6,20 @@
  */
 
 #include "CoreAlgorithms.h"
+#include "ScanKernels.h"        // For XPROC_SANITIZER
+
+#include <cstring>      // For std::memchr
+#include <cwchar>       // For std::wmemchr
+
+// SSE2 is part of the baseline instruction set on x86-64, so it needs no runtime dispatch.
+// measure() and compare_long() read whole blocks around strings, which sanitizers would report, so their builds do without.
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(XPROC_SANITIZER)
+#define XPROC_ALGORITHMS_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
 
 namespace xprocesser
 {
@@ -15,33 +29,242 @@ namespace xinternal
 {
 
 template<class ItemType>
-inline std::size_t measure(const ItemType *p)
+inline std::size_t measure_scalar(const ItemType *p)
 {
 	const ItemType *tmp = p;
 	while (*tmp) ++tmp;
 	return tmp - p;
 }
 
+// First zero among size characters, or 0 if none; library searches are vectorized and stop at the bound
+inline const char *find_zero(const char *p, std::size_t size)
+{
+	return static_cast<const char *>(std::memchr(p, 0, size));
+}
+
+inline const wchar_t *find_zero(const wchar_t *p, std::size_t size)
+{
+	return std::wmemchr(p, 0, size);
+}
+
 template<class ItemType>
-inline bool compare(const ItemType *first, std::size_t size1, const ItemType *second, std::size_t size2, bool case_sensitive)
+inline bool compare_scalar(const ItemType *first, std::size_t size, const ItemType *second, bool case_sensitive)
 {
-	if (size1 != size2)
-		return false;
 	if (case_sensitive)
 	{
-		for (const ItemType *end = first + size1; first < end; ++first, ++second)
+		for (const ItemType *end = first + size; first < end; ++first, ++second)
 			if (*first != *second)
 				return false;
 	}
 	else
 	{
-		for (const ItemType *end = first + size1; first < end; ++first, ++second)
+		for (const ItemType *end = first + size; first < end; ++first, ++second)
 			if (lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(*first)] != lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(*second)])
 				return false;
 	}
 	return true;
 }
 
+template<class ItemType>
+inline void count_markup_scalar(const ItemType *p, const ItemType *end, std::size_t &tags, std::size_t &equals)
+{
+	for (; p < end; ++p)
+	{
+		if (*p == ItemType('<'))
+			++tags;
+		else if (*p == ItemType('='))
+			++equals;
+	}
+}
+
+#if defined(XPROC_ALGORITHMS_SSE2)
+
+// Index of lowest set bit; mask must be non-zero
+inline unsigned first_bit(unsigned mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+// Operations on 16 byte vectors holding characters of the given width
+template<std::size_t Width>
+struct lanes;
+
+template<>
+struct lanes<1>
+{
+	static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+	static __m128i splat(int c) { return _mm_set1_epi8(static_cast<char>(c)); }
+	static __m128i low_byte(__m128i v) { return v; }
+};
+
+template<>
+struct lanes<2>
+{
+	static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+	static __m128i splat(int c) { return _mm_set1_epi16(static_cast<short>(c)); }
+	static __m128i low_byte(__m128i v) { return _mm_and_si128(v, _mm_set1_epi16(0xFF)); }
+};
+
+template<>
+struct lanes<4>
+{
+	static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+	static __m128i splat(int c) { return _mm_set1_epi32(c); }
+	static __m128i low_byte(__m128i v) { return _mm_and_si128(v, _mm_set1_epi32(0xFF)); }
+};
+
+// Case fold matching lookup_upcase: only the low byte of a character takes part and only a-z change
+template<std::size_t Width>
+inline __m128i upcase(__m128i v)
+{
+	v = lanes<Width>::low_byte(v);
+	__m128i lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+	return _mm_sub_epi8(v, _mm_and_si128(lower, _mm_set1_epi8(0x20)));
+}
+
+// Mask of bytes which differ between two 16 byte blocks
+template<std::size_t Width>
+inline unsigned mismatch(const char *first, const char *second, bool case_sensitive)
+{
+	__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+	__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second));
+	if (!case_sensitive)
+	{
+		a = upcase<Width>(a);
+		b = upcase<Width>(b);
+	}
+	return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) & 0xFFFF;
+}
+
+template<class ItemType>
+std::size_t measure_sse2(const ItemType *p)
+{
+	if (reinterpret_cast<std::size_t>(p) % sizeof(ItemType))
+		return measure_scalar(p);
+
+	// Scan aligned blocks, which never cross a page boundary; discard flags for bytes before p
+	const __m128i zero = _mm_setzero_si128();
+	std::size_t offset = reinterpret_cast<std::size_t>(p) & 15;
+	const char *block = reinterpret_cast<const char *>(p) - offset;
+	unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(lanes<sizeof(ItemType)>::eq(_mm_load_si128(reinterpret_cast<const __m128i *>(block)), zero))) >> offset;
+	if (mask)
+		return first_bit(mask) / sizeof(ItemType);
+	while (1)
+	{
+		block += 16;
+		mask = _mm_movemask_epi8(lanes<sizeof(ItemType)>::eq(_mm_load_si128(reinterpret_cast<const __m128i *>(block)), zero));
+		if (mask)
+			return (block + first_bit(mask) - reinterpret_cast<const char *>(p)) / sizeof(ItemType);
+	}
+}
+
+template<class ItemType>
+bool compare_sse2(const ItemType *first, std::size_t size, const ItemType *second, bool case_sensitive)
+{
+	const char *a = reinterpret_cast<const char *>(first);
+	const char *b = reinterpret_cast<const char *>(second);
+
+	// Whole blocks, then a final block overlapping the last one; strings are at least one block long
+	std::size_t last = size * sizeof(ItemType) - 16;
+	for (std::size_t i = 0; i < last; i += 16)
+		if (mismatch<sizeof(ItemType)>(a + i, b + i, case_sensitive))
+			return false;
+	return !mismatch<sizeof(ItemType)>(a + last, b + last, case_sensitive);
+}
+
+// Sum of the 16 bytes of a block
+inline std::size_t sum_bytes(__m128i v)
+{
+	__m128i sums = _mm_sad_epu8(v, _mm_setzero_si128());
+	return static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) + static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+}
+
+template<class ItemType>
+void count_markup_sse2(const ItemType *p, std::size_t size, std::size_t &tags, std::size_t &equals)
+{
+	// Matches are counted per byte, which counts each character once per byte of it,
+	// and counters are summed before they can overflow
+	const __m128i lt = lanes<sizeof(ItemType)>::splat('<');
+	const __m128i eq = lanes<sizeof(ItemType)>::splat('=');
+	const char *block = reinterpret_cast<const char *>(p);
+	std::size_t blocks = size * sizeof(ItemType) / 16;
+	std::size_t tag_bytes = 0, equal_bytes = 0;
+	while (blocks)
+	{
+		std::size_t run = blocks < 255 ? blocks : 255;
+		blocks -= run;
+		__m128i tag_counts = _mm_setzero_si128();
+		__m128i equal_counts = _mm_setzero_si128();
+		for (; run; --run, block += 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+			tag_counts = _mm_sub_epi8(tag_counts, lanes<sizeof(ItemType)>::eq(v, lt));
+			equal_counts = _mm_sub_epi8(equal_counts, lanes<sizeof(ItemType)>::eq(v, eq));
+		}
+		tag_bytes += sum_bytes(tag_counts);
+		equal_bytes += sum_bytes(equal_counts);
+	}
+	tags += tag_bytes / sizeof(ItemType);
+	equals += equal_bytes / sizeof(ItemType);
+	count_markup_scalar(reinterpret_cast<const ItemType *>(block), p + size, tags, equals);
+}
+
+#endif
+
+template<class ItemType>
+std::size_t measure(const ItemType *p)
+{
+#if defined(XPROC_ALGORITHMS_SSE2)
+	return measure_sse2(p);
+#else
+	return measure_scalar(p);
+#endif
+}
+
+template<class ItemType>
+std::size_t measure(const ItemType *p, std::size_t size)
+{
+	const ItemType *zero = size ? find_zero(p, size) : 0;
+	return zero ? zero - p : size;
+}
+
+template<class ItemType>
+bool compare_long(const ItemType *first, std::size_t size, const ItemType *second, bool case_sensitive)
+{
+#if defined(XPROC_ALGORITHMS_SSE2)
+	return compare_sse2(first, size, second, case_sensitive);
+#else
+	return compare_scalar(first, size, second, case_sensitive);
+#endif
+}
+
+template<class ItemType>
+void count_markup(const ItemType *p, std::size_t size, std::size_t &tags, std::size_t &equals)
+{
+	tags = equals = 0;
+#if defined(XPROC_ALGORITHMS_SSE2)
+	count_markup_sse2(p, size, tags, equals);
+#else
+	count_markup_scalar(p, p + size, tags, equals);
+#endif
+}
+
+// Explicit instantiations
+template std::size_t measure<char>(const char *);
+template std::size_t measure<wchar_t>(const wchar_t *);
+template std::size_t measure<char>(const char *, std::size_t);
+template std::size_t measure<wchar_t>(const wchar_t *, std::size_t);
+template bool compare_long<char>(const char *, std::size_t, const char *, bool);
+template bool compare_long<wchar_t>(const wchar_t *, std::size_t, const wchar_t *, bool);
+template void count_markup<char>(const char *, std::size_t, std::size_t &, std::size_t &);
+template void count_markup<wchar_t>(const wchar_t *, std::size_t, std::size_t &, std::size_t &);
+
 } /* namespace xinternal */
 } /* namespace xcore */
 } /* namespace xprocesser */
@@ -13,6 +13,7 @@
 // If standard library is disabled, user must provide implementations of required functions and typedefs
 #if !defined(XPROC_NO_STDLIB)
 #include <cstdlib>      // For std::size_t
+#include <cstring>      // For std::memcpy
 #endif
 
 namespace xprocesser
@@ -23,12 +24,124 @@ namespace xinternal
 {
 
 // Find length of the string
+// With SSE2 it reads whole aligned blocks around the terminator, never crossing a page boundary;
+// builds with sanitizers use the scalar loop instead
 template<class ItemType>
-inline std::size_t measure(const ItemType *);
+std::size_t measure(const ItemType *);
+
+// Find length of the string within its first size characters, or size if they hold no terminator
+// Nothing past size is read
+template<class ItemType>
+std::size_t measure(const ItemType *, std::size_t);
+
+// Compare strings of the same size, at least 16 bytes long, for equality
+// With SSE2 it compares 16 bytes at a time, folding case of a whole block at once
+template<class ItemType>
+bool compare_long(const ItemType *, std::size_t, const ItemType *, bool);
+
+// Compare strings of the same size, shorter than 16 bytes, one character at a time
+template<class ItemType>
+inline bool compare_short(const ItemType *first, std::size_t size, const ItemType *second, bool case_sensitive)
+{
+	if (case_sensitive)
+	{
+		for (const ItemType *end = first + size; first < end; ++first, ++second)
+			if (*first != *second)
+				return false;
+	}
+	else
+	{
+		for (const ItemType *end = first + size; first < end; ++first, ++second)
+			if (lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(*first)] != lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(*second)])
+				return false;
+	}
+	return true;
+}
+
+// Word of bytes read from unaligned memory
+template<class Word>
+inline Word load_word(const char *p)
+{
+	Word word;
+	std::memcpy(&word, p, sizeof(word));
+	return word;
+}
+
+// Compare words of bytes, folding ASCII letters as lookup_upcase does unless case sensitive
+// Without case, bytes may differ only in bit 0x20, and only where the first word holds a letter;
+// a byte below 0x80 is a lowercase letter if adding 0x80 - 'a' sets its high bit and adding 0x80 - 'z' - 1 does not
+inline bool equal_words(unsigned long long first, unsigned long long second, bool case_sensitive)
+{
+	unsigned long long diff = first ^ second;
+	if (case_sensitive)
+		return !diff;
+	const unsigned long long low = 0x7F7F7F7F7F7F7F7Full;
+	unsigned long long lower = first | 0x2020202020202020ull;
+	unsigned long long letters = ((lower & low) + 0x1F1F1F1F1F1F1F1Full) & ~((lower & low) + 0x0505050505050505ull) & ~lower & ~low;
+	return !(diff & ~(letters >> 2));
+}
+
+// Short char strings: two overlapping words cover 4 to 15 bytes without a loop
+inline bool compare_short(const char *first, std::size_t size, const char *second, bool case_sensitive)
+{
+	if (size >= 8)
+		return equal_words(load_word<unsigned long long>(first), load_word<unsigned long long>(second), case_sensitive) &&
+				equal_words(load_word<unsigned long long>(first + size - 8), load_word<unsigned long long>(second + size - 8), case_sensitive);
+	if (size >= 4)
+	{
+		// Both halves fit one word
+		unsigned long long word1 = load_word<unsigned>(first) | static_cast<unsigned long long>(load_word<unsigned>(first + size - 4)) << 32;
+		unsigned long long word2 = load_word<unsigned>(second) | static_cast<unsigned long long>(load_word<unsigned>(second + size - 4)) << 32;
+		return equal_words(word1, word2, case_sensitive);
+	}
+	return compare_short<char>(first, size, second, case_sensitive);
+}
 
 // Compare strings for equality
+// Case insensitive compare folds ASCII letters only, as lookup_upcase does
+// Names are mostly shorter than 16 bytes, so these are compared inline; longer strings go to compare_long()
+template<class ItemType>
+inline bool compare(const ItemType *first, std::size_t size1, const ItemType *second, std::size_t size2, bool case_sensitive)
+{
+	if (size1 != size2)
+		return false;
+	if (size1 * sizeof(ItemType) >= 16)
+		return compare_long(first, size1, second, case_sensitive);
+	return compare_short(first, size1, second, case_sensitive);
+}
+
+// Count < and = characters in text of given size, which estimate the numbers of nodes and attributes
 template<class ItemType>
-inline bool compare(const ItemType *, std::size_t, const ItemType *, std::size_t, bool);
+void count_markup(const ItemType *, std::size_t, std::size_t &, std::size_t &);
+
+// Hash of name, for tables keyed by names
+// FNV-1a; names are short, so one multiply per character is cheaper than a block hash
+template<class ItemType>
+inline unsigned hash_name(const ItemType *name, std::size_t size)
+{
+	unsigned code = 2166136261u;
+	for (std::size_t i = 0; i < size; ++i)
+		code = (code ^ static_cast<unsigned>(name[i])) * 16777619u;
+	return code;
+}
+
+// Grow array of trivially copyable items, of which the first used are kept, until it holds at least needed items
+// Capacity starts at initial and doubles, so appending one item at a time copies each item a constant number of times on average
+template<class Item>
+inline void grow_array(Item *&array, std::size_t used, std::size_t &capacity, std::size_t needed, std::size_t initial)
+{
+	if (needed <= capacity)
+		return;
+	std::size_t size = capacity ? capacity * 2 : initial;
+	while (size < needed)
+		size *= 2;
+	Item *grown = new Item[size];
+	if (used)
+		std::memcpy(grown, array, used * sizeof(Item));
+	delete[] array;
+	array = grown;
+	capacity = size;
+}
 
 } /* namespace xinternal */
 } /* namespace xcore */
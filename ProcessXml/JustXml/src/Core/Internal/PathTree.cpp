@@ -0,0 +1,119 @@
+/*
+ * PathTree.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "PathTree.h"
+
+#include "CoreAlgorithms.h"
+#include "../ParseError.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+template<class ItemType>
+const std::size_t path_tree<ItemType>::none;
+
+template<class ItemType>
+void path_tree<ItemType>::clear()
+{
+	m_names_size = 0;
+	m_count = 0;
+	grow_array(m_states, m_count, m_capacity, 1, 16);
+	state &root = m_states[m_count++];
+	root.name = root.name_size = 0;
+	root.parent = root.first_child = root.first_attribute = root.next = none;
+}
+
+template<class ItemType>
+void path_tree<ItemType>::check(const ItemType *path, const ItemType *end)
+{
+	for (const ItemType *text = path; ; ++text)
+	{
+		bool attribute = text != end && *text == ItemType('@');
+		if (attribute)
+			++text;
+		const ItemType *name = text;
+		while (text != end && *text != ItemType('/') && *text != ItemType('@'))
+			++text;
+		if (text == name)
+			RAPIDXML_PARSE_ERROR("expected name", const_cast<ItemType *>(text));
+		if (text == end)
+			break;
+		if (attribute)
+			RAPIDXML_PARSE_ERROR("attribute must end the path", const_cast<ItemType *>(text));
+		if (*text != ItemType('/'))
+			RAPIDXML_PARSE_ERROR("expected /", const_cast<ItemType *>(text));
+	}
+}
+
+template<class ItemType>
+std::size_t path_tree<ItemType>::add(std::size_t current, const ItemType *path, const ItemType *end)
+{
+	for (const ItemType *text = path; ; ++text)
+	{
+		bool attribute = *text == ItemType('@');
+		if (attribute)
+			++text;
+		const ItemType *name = text;
+		while (text != end && *text != ItemType('/'))
+			++text;
+		current = child(current, attribute, name, text - name);
+		if (text == end)
+			return current;
+	}
+}
+
+template<class ItemType>
+std::size_t path_tree<ItemType>::child(std::size_t parent, bool attribute, const ItemType *name, std::size_t size)
+{
+	// Existing state
+	std::size_t last = none;
+	for (std::size_t index = attribute ? m_states[parent].first_attribute : m_states[parent].first_child; index != none; index = m_states[index].next)
+	{
+		if (compare(m_names + m_states[index].name, m_states[index].name_size, name, size, true))
+			return index;
+		last = index;
+	}
+
+	// Append state after the last one of its parent and kind
+	grow_array(m_states, m_count, m_capacity, m_count + 1, 16);
+	grow_array(m_names, m_names_size, m_names_capacity, m_names_size + size, 256);
+	std::size_t index = m_count++;
+	state &added = m_states[index];
+	added.name = m_names_size;
+	added.name_size = size;
+	added.parent = parent;
+	added.first_child = added.first_attribute = added.next = none;
+	std::memcpy(m_names + m_names_size, name, size * sizeof(ItemType));
+	m_names_size += size;
+	if (last != none)
+		m_states[last].next = index;
+	else if (attribute)
+		m_states[parent].first_attribute = index;
+	else
+		m_states[parent].first_child = index;
+	return index;
+}
+
+template<class ItemType>
+std::size_t path_tree<ItemType>::find(std::size_t index, const ItemType *name, std::size_t size) const
+{
+	for (; index != none; index = m_states[index].next)
+		if (m_states[index].name_size == size && compare(m_names + m_states[index].name, size, name, size, true))
+			return index;
+	return none;
+}
+
+// Explicit instantiations
+template class path_tree<char>;
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,109 @@
+/*
+ * PathTree.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_PATHTREE_H_
+#define SRC_CORE_INTERNAL_PATHTREE_H_
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+// Tree of element and attribute names along paths, used by xml_extractor and xml_mapping.
+// Paths are merged as they are added, so each distinct prefix is one state, and reading a text follows states by the names found.
+// States are numbered in the order they are added, from the root, which is 0;
+// users keep their own data of each state in an array indexed the same way.
+template<class ItemType>
+class path_tree
+{
+public:
+
+	// Index standing for no state
+	static const std::size_t none = ~std::size_t(0);
+
+	// Element or attribute along paths
+	struct state
+	{
+		std::size_t name;               // Offset of name in names
+		std::size_t name_size;
+		std::size_t parent;             // State of parent element, or none for the root
+		std::size_t first_child;        // First state of child element, or none
+		std::size_t first_attribute;    // First state of attribute, or none
+		std::size_t next;               // Next state of the same parent and kind, or none
+	};
+
+	path_tree()
+	: m_names(0), m_names_size(0), m_names_capacity(0), m_states(0), m_count(0), m_capacity(0)
+	{
+		clear();
+	}
+
+	~path_tree()
+	{
+		delete[] m_names;
+		delete[] m_states;
+	}
+
+	// Removes all states but the root
+	void clear();
+
+	// Checks path of element names separated by /, optionally ending with @ and attribute name; throws parse_error pointing into it
+	static void check(const ItemType *, const ItemType *);
+
+	// Follows checked path from given state, adding the states missing; returns state of its last name
+	std::size_t add(std::size_t, const ItemType *, const ItemType *);
+
+	// Finds state of given parent, kind and name, or adds it; returns its index
+	std::size_t child(std::size_t, bool, const ItemType *, std::size_t);
+
+	// Finds state of given name among given state and its next siblings; returns none if there is no such state
+	std::size_t find(std::size_t, const ItemType *, std::size_t) const;
+
+	// Number of states, including the root
+	std::size_t size() const
+	{
+		return m_count;
+	}
+
+	// Gets state of index
+	const state &operator [](std::size_t index) const
+	{
+		return m_states[index];
+	}
+
+	// Gets name of state of index, which is not zero-terminated
+	const ItemType *name(std::size_t index) const
+	{
+		return m_names + m_states[index].name;
+	}
+
+private:
+
+	// Copying is not allowed
+	path_tree(const path_tree &);
+	void operator =(const path_tree &);
+
+	ItemType *m_names;                  // Names of states, back to back
+	std::size_t m_names_size;           // Characters used
+	std::size_t m_names_capacity;       // Characters allocated
+	state *m_states;                    // States, with the root first
+	std::size_t m_count;                // Number of states
+	std::size_t m_capacity;             // States allocated
+};
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_PATHTREE_H_ */
@@ -26,6 +26,13 @@
 #define RAPIDXML_DYNAMIC_POOL_SIZE (64 * 1024)
 #endif
 
+#ifndef RAPIDXML_RETAINED_POOL_SIZE
+// Default retention of memory_pool.
+// Define RAPIDXML_RETAINED_POOL_SIZE before including rapidxml.hpp if you want to override the default value.
+// Up to this many bytes of dynamic blocks are kept by memory_pool::clear() for further allocations, instead of being freed.
+#define RAPIDXML_RETAINED_POOL_SIZE 0
+#endif
+
 #ifndef RAPIDXML_ALIGNMENT
 // Memory allocation alignment.
 // Define RAPIDXML_ALIGNMENT before including rapidxml.hpp if you want to override the default value, which is the size of pointer.
@@ -34,7 +41,7 @@
 #define RAPIDXML_ALIGNMENT sizeof(void *)
 #endif
 
-namespace xprocess
+namespace xprocesser
 {
 namespace xcore
 {
@@ -137,6 +144,71 @@ const int parse_trim_whitespace = 0x400;
 //! See xml_document::parse() function.
 const int parse_normalize_whitespace = 0x800;
 
+//! Experimental process flag instructing the parser to work in two stages.
+//! First stage scans the whole text for <, >, quotes, = and & in one vectorized pass, and indexes positions of those which are markup:
+//! it follows tags, quoted attribute values, comments, CDATA sections, processing instructions and DOCTYPE as the parser reads them,
+//! so that quotes in text or < and > inside attribute values and comments are left out.
+//! Second stage builds the tree, taking runs of text and attribute values, and bodies of comments, CDATA sections and
+//! processing instructions, from the index instead of scanning them. Tags are still read by the parser.
+//! Resulting tree, and error in case of malformed text, is identical to the one produced without this flag.
+//! <br><br>
+//! Index holds 4 bytes per structural character and is built before the tree, so text is read twice.
+//! First stage runs at 1.4-2.7 GB/s, but the second stage gains less than that from the index:
+//! on the 32 MB catalog of test/bench/BenchIndex.cpp two-stage parsing is 15-35% slower than single stage parsing,
+//! and with a 200 byte comment and CDATA section per record it is 20% slower to 3% faster.
+//! So this mode is kept for experiments with the index, not as a faster parse.
+//! Index memory is kept by the document for reuse by further parses, until xml_document::clear() is called.
+//! Texts longer than 4 GB are parsed in single stage.
+//! Can be combined with other flags by use of | operator.
+//! <br><br>
+//! See xml_document::parse() function.
+const int parse_structural_index = 0x1000;
+
+//! Process flag instructing the parser to defer parsing of element contents which hold markup.
+//! Parser only finds the matching closing tag of such element, and remembers where its contents start.
+//! Contents are parsed into child nodes when they are first accessed by xml_node::first_node(), xml_node::last_node()
+//! or a function adding or removing children, so sparse access to a large document parses only the parts it touches.
+//! Elements holding only text are parsed at once, so that their values are available.
+//! Value of element whose contents are deferred is set when they are parsed.
+//! Errors inside deferred contents are reported by the function which triggers their parsing.
+//! Source text and the document must persist until all deferred contents are parsed.
+//! Contents are deferred only with <code>XPROC_LAZY_CONTENTS</code> defined, which costs every node a pointer
+//! and every access to children a test; without it this flag is ignored and contents are parsed at once.
+//! Can be combined with other flags by use of | operator.
+//! <br><br>
+//! See xml_document::parse() function.
+const int parse_lazy = 0x2000;
+
+//! Process flag instructing the parser to treat source text as read-only and bounded by its size instead of a zero terminator.
+//! It is added by xml_document::parse(const ItemType*, std::size_t), which is the only function that may be given it;
+//! there is no need to pass it explicitly.
+//! <br><br>
+//! See xml_document::parse() function.
+const int parse_const_input = 0x4000;
+
+//! Process flag instructing the parser to intern element and attribute names into the symbol table of the document.
+//! Each element and attribute then carries identifier of its name, see Xml_Base::name_id(),
+//! and can be found by xml_node::first_node(name_id) and similar functions, which compare identifiers instead of names.
+//! Identifiers of names to look for are obtained from xml_document::intern_name().
+//! Names are interned only with <code>XPROC_INTERN_NAMES</code> defined, which costs every node and attribute an identifier;
+//! without it this flag is ignored.
+//! Can be combined with other flags by use of | operator.
+//! <br><br>
+//! See xml_document::parse() function.
+const int parse_intern_names = 0x8000;
+
+//! Process flag instructing the parser to size the memory pool for the whole document before parsing.
+//! Parser counts < and = characters of the text, estimates from them the memory nodes and attributes will take,
+//! and makes the pool hold that much in one block, see memory_pool::presize().
+//! Nodes and attributes then lie in a single block in document order; should the estimate fall short, the pool grows as usual.
+//! Applies to text of known size, given to xml_document::parse(const ItemType*, std::size_t),
+//! and to zero-terminated text only with <code>XPROC_COMPACT_NODES</code> defined, which measures the text anyway;
+//! without the macro, xml_document::parse(ItemType*) accepts this flag and ignores it.
+//! Can be combined with other flags by use of | operator.
+//! <br><br>
+//! See xml_document::parse() function.
+const int parse_presize = 0x10000;
+
 // Compound flags
 
 //! Process flags which represent default behaviour of the parser.
@@ -176,4 +248,18 @@ const int parse_full = parse_declaration_node | parse_comment_nodes | parse_doct
 } /* namespace xcore */
 } /* namespace xprocesser */
 
+///////////////////////////////////////////////////////////////////////////
+// Run-time flags
+
+#ifndef XPROC_RUNTIME_FLAGS
+// Flags which xml_document::parse(ItemType*, int) takes at run time; every combination of them is instantiated.
+// Define XPROC_RUNTIME_FLAGS when compiling XmlDocument.cpp if you want to override the default value.
+// Each flag added doubles the number of instantiations of the parser, and the size of its code; the 5 flags below make 32.
+#define XPROC_RUNTIME_FLAGS (xprocesser::xcore::xinternal::xflags::parse_non_destructive | \
+		xprocesser::xcore::xinternal::xflags::parse_comment_nodes | \
+		xprocesser::xcore::xinternal::xflags::parse_validate_closing_tags | \
+		xprocesser::xcore::xinternal::xflags::parse_trim_whitespace | \
+		xprocesser::xcore::xinternal::xflags::parse_normalize_whitespace)
+#endif
+
 #endif /* SRC_CORE_INTERNAL_PROCESSFLAGS_H_ */
@@ -0,0 +1,300 @@
+/*
+ * ScanKernels.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "ScanKernels.h"
+
+#include "LookupTables.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#endif
+
+// Vector kernels are compiled with per-function target attributes, so that the translation unit
+// itself needs no -msse2/-mavx2 and the same binary runs on every x86 CPU.
+// Sanitizers would report their aligned reads around the text, so their builds use scalar kernels only.
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) && !defined(XPROC_SANITIZER)
+#define XPROC_SCAN_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define XPROC_TARGET_SSE2
+#define XPROC_TARGET_AVX2
+#else
+#define XPROC_TARGET_SSE2 __attribute__((target("sse2")))
+#define XPROC_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Lists kernel instantiations for all classes, in scan_class order
+#define XPROC_SCAN_KERNELS(kernel) \
+	&kernel<scan_whitespace>, \
+	&kernel<scan_node_name>, \
+	&kernel<scan_attribute_name>, \
+	&kernel<scan_text>, \
+	&kernel<scan_text_pure_no_ws>, \
+	&kernel<scan_text_pure_with_ws>, \
+	&kernel<scan_attribute_data_1>, \
+	&kernel<scan_attribute_data_1_pure>, \
+	&kernel<scan_attribute_data_2>, \
+	&kernel<scan_attribute_data_2_pure>
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+///////////////////////////////////////////////////////////////////////
+// Scalar kernels
+
+// Lookup table of the class
+template<scan_class Class>
+inline const unsigned char *scan_table()
+{
+	switch (Class)
+	{
+	case scan_whitespace:               return lookup_tables<0>::lookup_whitespace;
+	case scan_node_name:                return lookup_tables<0>::lookup_node_name;
+	case scan_attribute_name:           return lookup_tables<0>::lookup_attribute_name;
+	case scan_text:                     return lookup_tables<0>::lookup_text;
+	case scan_text_pure_no_ws:          return lookup_tables<0>::lookup_text_pure_no_ws;
+	case scan_text_pure_with_ws:        return lookup_tables<0>::lookup_text_pure_with_ws;
+	case scan_attribute_data_1:         return lookup_tables<0>::lookup_attribute_data_1;
+	case scan_attribute_data_1_pure:    return lookup_tables<0>::lookup_attribute_data_1_pure;
+	case scan_attribute_data_2:         return lookup_tables<0>::lookup_attribute_data_2;
+	default:                            return lookup_tables<0>::lookup_attribute_data_2_pure;
+	}
+}
+
+template<scan_class Class>
+const char *scan_scalar(const char *p)
+{
+	const unsigned char *table = scan_table<Class>();
+	while (table[static_cast<unsigned char>(*p)])
+		++p;
+	return p;
+}
+
+#if defined(XPROC_SCAN_X86)
+
+// Index of lowest set bit; mask must be non-zero
+inline unsigned first_bit(unsigned long long mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+#if defined(_M_X64)
+	_BitScanForward64(&index, mask);
+#else
+	if (!_BitScanForward(&index, static_cast<unsigned long>(mask)))
+	{
+		_BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+		index += 32;
+	}
+#endif
+	return index;
+#else
+	return __builtin_ctzll(mask);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////
+// SSE2 kernels
+
+XPROC_TARGET_SSE2 inline __m128i eq_sse2(__m128i v, char ch)
+{
+	return _mm_cmpeq_epi8(v, _mm_set1_epi8(ch));
+}
+
+// Space \n \r \t
+XPROC_TARGET_SSE2 inline __m128i whitespace_sse2(__m128i v)
+{
+	return _mm_or_si128(_mm_or_si128(eq_sse2(v, ' '), eq_sse2(v, '\n')), _mm_or_si128(eq_sse2(v, '\r'), eq_sse2(v, '\t')));
+}
+
+// Marks characters which do not belong to the class; mirrors the zeros of its lookup table
+template<scan_class Class>
+XPROC_TARGET_SSE2 inline __m128i stop_sse2(__m128i v)
+{
+	__m128i end = eq_sse2(v, '\0');
+	switch (Class)
+	{
+	case scan_whitespace:               return _mm_cmpeq_epi8(whitespace_sse2(v), _mm_setzero_si128());
+	case scan_node_name:                return _mm_or_si128(_mm_or_si128(end, whitespace_sse2(v)), _mm_or_si128(_mm_or_si128(eq_sse2(v, '/'), eq_sse2(v, '>')), eq_sse2(v, '?')));
+	case scan_attribute_name:           return _mm_or_si128(_mm_or_si128(_mm_or_si128(end, whitespace_sse2(v)), _mm_or_si128(eq_sse2(v, '/'), eq_sse2(v, '<'))),
+			_mm_or_si128(_mm_or_si128(eq_sse2(v, '>'), eq_sse2(v, '=')), _mm_or_si128(eq_sse2(v, '?'), eq_sse2(v, '!'))));
+	case scan_text:                     return _mm_or_si128(end, eq_sse2(v, '<'));
+	case scan_text_pure_no_ws:          return _mm_or_si128(_mm_or_si128(end, eq_sse2(v, '<')), eq_sse2(v, '&'));
+	case scan_text_pure_with_ws:        return _mm_or_si128(_mm_or_si128(end, eq_sse2(v, '<')), _mm_or_si128(eq_sse2(v, '&'), whitespace_sse2(v)));
+	case scan_attribute_data_1:         return _mm_or_si128(end, eq_sse2(v, '\''));
+	case scan_attribute_data_1_pure:    return _mm_or_si128(_mm_or_si128(end, eq_sse2(v, '\'')), eq_sse2(v, '&'));
+	case scan_attribute_data_2:         return _mm_or_si128(end, eq_sse2(v, '"'));
+	default:                            return _mm_or_si128(_mm_or_si128(end, eq_sse2(v, '"')), eq_sse2(v, '&'));
+	}
+}
+
+template<scan_class Class>
+XPROC_TARGET_SSE2 inline unsigned stop_mask_sse2(const char *block)
+{
+	return static_cast<unsigned>(_mm_movemask_epi8(stop_sse2<Class>(_mm_load_si128(reinterpret_cast<const __m128i *>(block)))));
+}
+
+template<scan_class Class>
+XPROC_TARGET_SSE2 const char *scan_sse2(const char *p)
+{
+	// Start at the enclosing aligned block and discard flags for characters before p
+	std::size_t offset = reinterpret_cast<std::size_t>(p) & 15;
+	const char *block = p - offset;
+	unsigned mask = stop_mask_sse2<Class>(block) >> offset;
+	if (mask)
+		return p + first_bit(mask);
+	while (1)
+	{
+		block += 16;
+		mask = stop_mask_sse2<Class>(block);
+		if (mask)
+			return block + first_bit(mask);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////
+// AVX2 kernels
+
+XPROC_TARGET_AVX2 inline __m256i eq_avx2(__m256i v, char ch)
+{
+	return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(ch));
+}
+
+// Space \n \r \t
+XPROC_TARGET_AVX2 inline __m256i whitespace_avx2(__m256i v)
+{
+	return _mm256_or_si256(_mm256_or_si256(eq_avx2(v, ' '), eq_avx2(v, '\n')), _mm256_or_si256(eq_avx2(v, '\r'), eq_avx2(v, '\t')));
+}
+
+// Marks characters which do not belong to the class; mirrors the zeros of its lookup table
+template<scan_class Class>
+XPROC_TARGET_AVX2 inline __m256i stop_avx2(__m256i v)
+{
+	__m256i end = eq_avx2(v, '\0');
+	switch (Class)
+	{
+	case scan_whitespace:               return _mm256_cmpeq_epi8(whitespace_avx2(v), _mm256_setzero_si256());
+	case scan_node_name:                return _mm256_or_si256(_mm256_or_si256(end, whitespace_avx2(v)), _mm256_or_si256(_mm256_or_si256(eq_avx2(v, '/'), eq_avx2(v, '>')), eq_avx2(v, '?')));
+	case scan_attribute_name:           return _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(end, whitespace_avx2(v)), _mm256_or_si256(eq_avx2(v, '/'), eq_avx2(v, '<'))),
+			_mm256_or_si256(_mm256_or_si256(eq_avx2(v, '>'), eq_avx2(v, '=')), _mm256_or_si256(eq_avx2(v, '?'), eq_avx2(v, '!'))));
+	case scan_text:                     return _mm256_or_si256(end, eq_avx2(v, '<'));
+	case scan_text_pure_no_ws:          return _mm256_or_si256(_mm256_or_si256(end, eq_avx2(v, '<')), eq_avx2(v, '&'));
+	case scan_text_pure_with_ws:        return _mm256_or_si256(_mm256_or_si256(end, eq_avx2(v, '<')), _mm256_or_si256(eq_avx2(v, '&'), whitespace_avx2(v)));
+	case scan_attribute_data_1:         return _mm256_or_si256(end, eq_avx2(v, '\''));
+	case scan_attribute_data_1_pure:    return _mm256_or_si256(_mm256_or_si256(end, eq_avx2(v, '\'')), eq_avx2(v, '&'));
+	case scan_attribute_data_2:         return _mm256_or_si256(end, eq_avx2(v, '"'));
+	default:                            return _mm256_or_si256(_mm256_or_si256(end, eq_avx2(v, '"')), eq_avx2(v, '&'));
+	}
+}
+
+// Stop flags for 64 characters, two 32 byte vectors per step
+template<scan_class Class>
+XPROC_TARGET_AVX2 inline unsigned long long stop_mask_avx2(const char *block)
+{
+	unsigned low = static_cast<unsigned>(_mm256_movemask_epi8(stop_avx2<Class>(_mm256_load_si256(reinterpret_cast<const __m256i *>(block)))));
+	unsigned high = static_cast<unsigned>(_mm256_movemask_epi8(stop_avx2<Class>(_mm256_load_si256(reinterpret_cast<const __m256i *>(block + 32)))));
+	return (static_cast<unsigned long long>(high) << 32) | low;
+}
+
+template<scan_class Class>
+XPROC_TARGET_AVX2 const char *scan_avx2(const char *p)
+{
+	// Start at the enclosing aligned block and discard flags for characters before p
+	std::size_t offset = reinterpret_cast<std::size_t>(p) & 63;
+	const char *block = p - offset;
+	unsigned long long mask = stop_mask_avx2<Class>(block) >> offset;
+	if (mask)
+		return p + first_bit(mask);
+	while (1)
+	{
+		block += 64;
+		mask = stop_mask_avx2<Class>(block);
+		if (mask)
+			return block + first_bit(mask);
+	}
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// Dispatch
+
+// Kernels for an instruction set, indexed by scan_class
+static scan_func *const *scan_table_of(scan_isa isa)
+{
+	static scan_func *const scalar[scan_class_count] = { XPROC_SCAN_KERNELS(scan_scalar) };
+#if defined(XPROC_SCAN_X86)
+	static scan_func *const sse2[scan_class_count] = { XPROC_SCAN_KERNELS(scan_sse2) };
+	static scan_func *const avx2[scan_class_count] = { XPROC_SCAN_KERNELS(scan_avx2) };
+	if (isa == scan_isa_avx2)
+		return avx2;
+	if (isa == scan_isa_sse2)
+		return sse2;
+#else
+	(void)isa;
+#endif
+	return scalar;
+}
+
+// Forwards the call to the kernel for the running CPU, leaving the table as it is.
+// Only scans made by static initializers running before scan_selected come here.
+template<scan_class Class>
+const char *scan_resolve(const char *p)
+{
+	return scan_table_of(scan_detect())[Class](p);
+}
+
+scan_func *scan_kernels[scan_class_count] = { XPROC_SCAN_KERNELS(scan_resolve) };
+
+scan_isa scan_detect()
+{
+#if defined(XPROC_SCAN_X86)
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int max_leaf = info[0];
+	__cpuid(info, 1);
+	bool sse2 = (info[3] & (1 << 26)) != 0;
+	bool avx2 = false;
+	if (max_leaf >= 7 && (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6)    // OSXSAVE, AVX and OS saves YMM state
+	{
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	bool sse2 = __builtin_cpu_supports("sse2");
+	bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+	if (avx2)
+		return scan_isa_avx2;
+	if (sse2)
+		return scan_isa_sse2;
+#endif
+	return scan_isa_scalar;
+}
+
+void scan_select(scan_isa isa)
+{
+	scan_func *const *selected = scan_table_of(isa);
+	for (int i = 0; i < scan_class_count; ++i)
+		scan_kernels[i] = selected[i];
+}
+
+// Kernels are selected during static initialization, before the program can start threads which scan,
+// so that the table is never written while it is read
+static const bool scan_selected = (scan_select(scan_detect()), true);
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,77 @@
+/*
+ * ScanKernels.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_SCANKERNELS_H_
+#define SRC_CORE_INTERNAL_SCANKERNELS_H_
+
+// Defined when compiling with AddressSanitizer or ThreadSanitizer, which report the aligned reads of vector code around strings:
+// as reads out of bounds, or as races with xml_document::parse_parallel() writing neighbouring parts of the text
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define XPROC_SANITIZER
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define XPROC_SANITIZER
+#endif
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+// Character classes skipped by the parser, one per lookup_tables table
+enum scan_class
+{
+	scan_whitespace,                // lookup_whitespace
+	scan_node_name,                 // lookup_node_name
+	scan_attribute_name,            // lookup_attribute_name
+	scan_text,                      // lookup_text
+	scan_text_pure_no_ws,           // lookup_text_pure_no_ws
+	scan_text_pure_with_ws,         // lookup_text_pure_with_ws
+	scan_attribute_data_1,          // lookup_attribute_data_1
+	scan_attribute_data_1_pure,     // lookup_attribute_data_1_pure
+	scan_attribute_data_2,          // lookup_attribute_data_2
+	scan_attribute_data_2_pure,     // lookup_attribute_data_2_pure
+	scan_class_count
+};
+
+// Instruction sets with a scanning kernel implementation
+enum scan_isa
+{
+	scan_isa_scalar,                // One table lookup per character
+	scan_isa_sse2,                  // 16 characters per step
+	scan_isa_avx2                   // 64 characters per step
+};
+
+// Scanning kernel.
+// Returns pointer to the first character at or after the argument which does not belong to the class.
+// Text must be zero terminated; zero never belongs to any class, so the scan always stops.
+// Vector kernels read whole aligned blocks, which may extend before the argument and past the terminator,
+// but never cross a page boundary, so they cannot fault; the characters outside the text only affect flags which are discarded.
+// To the language and to memory checkers these are still reads out of bounds, so builds with sanitizers
+// (XPROC_SANITIZER) compile scalar kernels only.
+typedef const char *(scan_func)(const char *);
+
+// Kernels in use, indexed by scan_class.
+// Kernels for the running CPU are installed during static initialization of ScanKernels.cpp.
+// Before that, every entry points to a stub which forwards to the kernel for the running CPU without modifying the table.
+extern scan_func *scan_kernels[scan_class_count];
+
+// Best instruction set supported by the running CPU and operating system
+scan_isa scan_detect();
+
+// Installs kernels for the given instruction set, which must be supported by the running CPU.
+// Table is written without synchronization, so no other thread may be scanning.
+void scan_select(scan_isa);
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_SCANKERNELS_H_ */
@@ -0,0 +1,336 @@
+/*
+ * StructuralIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "StructuralIndex.h"
+
+#include "../ParseError.h"
+
+#include <cstddef>      // For std::ptrdiff_t
+
+// SSE2 is part of the baseline instruction set on x86-64, so it needs no runtime dispatch.
+// Index is built from aligned blocks around the text, which sanitizers would report, so their builds do without.
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(XPROC_SANITIZER)
+#define XPROC_INDEX_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+// Largest offset representable in the index
+const std::size_t max_index_offset = 0xFFFFFFFFu;
+
+// Whitespace as the parser tests it after '<?xml' and '<!DOCTYPE'
+template<class ItemType>
+inline bool is_whitespace(ItemType ch)
+{
+	return ch == ItemType(' ') || ch == ItemType('\t') || ch == ItemType('\n') || ch == ItemType('\r');
+}
+
+template<class ItemType>
+void structural_index<ItemType>::build(ItemType *text, bool declarations)
+{
+	m_declarations = declarations;
+	build_scalar(text);
+}
+
+template<class ItemType>
+void structural_index<ItemType>::release()
+{
+	delete[] m_positions;
+	m_positions = 0;
+	m_cursor = 0;
+	m_size = 0;
+	m_capacity = 0;
+	m_active = false;
+}
+
+template<class ItemType>
+inline bool structural_index<ItemType>::accept(std::size_t offset)
+{
+	const ItemType *text = m_begin + offset;
+	ItemType ch = *text;
+	if (ch == ItemType('\0'))
+	{
+		m_positions[m_size++] = static_cast<unsigned>(offset);
+		return false;
+	}
+	switch (m_state)
+	{
+
+	// Text is ended by '<' only; entity references are expanded by the parser
+	case state_content:
+		if (ch == ItemType('<'))
+			m_state = open(offset);
+		else if (ch != ItemType('&'))
+			return true;
+		break;
+
+	// Every structural character of a tag is recorded; a quote after '=' opens a value, '>' ends the tag
+	case state_tag:
+		if (ch == ItemType('>'))
+			m_state = state_content;
+		else if ((ch == ItemType('"') || ch == ItemType('\'')) && opens_value(offset))
+		{
+			m_state = state_value;
+			m_quote = ch;
+		}
+		break;
+
+	// Value is ended by its own quote only
+	case state_value:
+		if (ch == m_quote)
+			m_state = state_tag;
+		else if (ch != ItemType('&'))
+			return true;
+		break;
+
+	// Body of other markup is ended by its closing sequence, which the parser searches from where it starts
+	case state_markup:
+		if (ch != ItemType('>') || offset < m_until ||
+				(m_close_1 && text[-1] != m_close_1) || (m_close_2 && text[-2] != m_close_2))
+			return true;
+		m_state = state_content;
+		break;
+
+	}
+	m_positions[m_size++] = static_cast<unsigned>(offset);
+	return true;
+}
+
+template<class ItemType>
+bool structural_index<ItemType>::opens_value(std::size_t offset)
+{
+	// Quotes are name characters, so only one following '=' and whitespace opens a value
+	const ItemType *text = m_begin + offset;
+	do
+		--text;
+	while (is_whitespace(*text));
+	if (*text != ItemType('='))
+		return false;
+
+	// Element name may hold '=' too; it ends at whitespace, '/' or '?', past which attributes start
+	for (const ItemType *name = m_begin + m_name; !m_named && name != text; ++name)
+		m_named = is_whitespace(*name) || *name == ItemType('/') || *name == ItemType('?');
+	m_name = text - m_begin;
+	return m_named;
+}
+
+template<class ItemType>
+typename structural_index<ItemType>::build_state structural_index<ItemType>::open(std::size_t offset)
+{
+	// Kinds of markup are told apart as xml_document::parse_node() does
+	const ItemType *text = m_begin + offset + 1;
+	m_close_1 = m_close_2 = 0;
+	m_name = offset + (text[0] == ItemType('/') ? 2 : 1);
+	m_named = false;
+	if (text[0] == ItemType('?'))
+	{
+		if ((text[1] == ItemType('x') || text[1] == ItemType('X')) &&
+				(text[2] == ItemType('m') || text[2] == ItemType('M')) &&
+				(text[3] == ItemType('l') || text[3] == ItemType('L')) &&
+				is_whitespace(text[4]))
+		{
+			// '<?xml ' - declaration, read as a tag with no name if its attributes are parsed
+			m_named = true;
+			if (m_declarations)
+				return state_tag;
+			m_until = offset + 7;
+		}
+		else
+			m_until = offset + 3;     // '?>' searched after '<?'
+		m_close_1 = ItemType('?');
+		return state_markup;
+	}
+	if (text[0] == ItemType('!'))
+	{
+		if (text[1] == ItemType('-') && text[2] == ItemType('-'))
+		{
+			// '-->' searched after '<!--'
+			m_until = offset + 6;
+			m_close_1 = m_close_2 = ItemType('-');
+		}
+		else if (text[1] == ItemType('[') && text[2] == ItemType('C') && text[3] == ItemType('D') && text[4] == ItemType('A') &&
+				text[5] == ItemType('T') && text[6] == ItemType('A') && text[7] == ItemType('['))
+		{
+			// ']]>' searched after '<![CDATA['
+			m_until = offset + 11;
+			m_close_1 = m_close_2 = ItemType(']');
+		}
+		else if (text[1] == ItemType('D') && text[2] == ItemType('O') && text[3] == ItemType('C') && text[4] == ItemType('T') &&
+				text[5] == ItemType('Y') && text[6] == ItemType('P') && text[7] == ItemType('E') &&
+				is_whitespace(text[8]))
+			m_until = doctype_end(offset + 10);
+		else
+			m_until = offset + 2;     // '>' searched after '<!'
+		return state_markup;
+	}
+	return state_tag;
+}
+
+template<class ItemType>
+std::size_t structural_index<ItemType>::doctype_end(std::size_t offset) const
+{
+	// Brackets nest as in xml_document::parse_doctype(), where quotes are not special
+	const ItemType *text = m_begin + offset;
+	while (*text != ItemType('>') && *text != ItemType('\0'))
+	{
+		if (*text++ != ItemType('['))
+			continue;
+		for (int depth = 1; depth > 0 && *text != ItemType('\0'); ++text)
+		{
+			if (*text == ItemType('['))
+				++depth;
+			else if (*text == ItemType(']'))
+				--depth;
+		}
+	}
+	return text - m_begin;
+}
+
+template<class ItemType>
+void structural_index<ItemType>::build_scalar(ItemType *text)
+{
+	m_begin = text;
+	m_size = 0;
+	m_active = false;
+	m_state = state_content;
+	for (ItemType *p = text; ; ++p)
+	{
+		ItemType ch = *p;
+		if (ch == ItemType('<') || ch == ItemType('>') || ch == ItemType('"') || ch == ItemType('\'') ||
+				ch == ItemType('=') || ch == ItemType('&') || ch == ItemType('\0'))
+		{
+			if (static_cast<std::size_t>(p - text) > max_index_offset)
+				return;
+			reserve(1);
+			if (!accept(p - text))
+				break;
+		}
+	}
+	m_cursor = m_positions;
+	m_active = true;
+}
+
+template<class ItemType>
+void structural_index<ItemType>::reserve(std::size_t count)
+{
+	if (m_size + count <= m_capacity)
+		return;
+	std::size_t capacity = m_capacity * 2;
+	if (capacity < 4096)
+		capacity = 4096;
+	if (capacity < m_size + count)
+		capacity = m_size + count;
+	unsigned *positions = new unsigned[capacity];
+#ifdef RAPIDXML_NO_EXCEPTIONS
+	if (!positions)         // If exceptions are disabled, verify memory allocation, because new will not be able to throw bad_alloc
+		RAPIDXML_PARSE_ERROR("out of memory", 0);
+#endif
+	for (std::size_t i = 0; i < m_size; ++i)
+		positions[i] = m_positions[i];
+	delete[] m_positions;
+	m_positions = positions;
+	m_capacity = capacity;
+}
+
+#if defined(XPROC_INDEX_SSE2)
+
+// Index of lowest set bit; mask must be non-zero
+inline unsigned first_bit(unsigned long long mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+#if defined(_M_X64)
+	_BitScanForward64(&index, mask);
+#else
+	if (!_BitScanForward(&index, static_cast<unsigned long>(mask)))
+	{
+		_BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+		index += 32;
+	}
+#endif
+	return index;
+#else
+	return __builtin_ctzll(mask);
+#endif
+}
+
+// Flags candidates, terminator included, in 16 characters at block
+inline unsigned block_mask(const char *block)
+{
+	__m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(block));
+	__m128i tags = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('<')), _mm_cmpeq_epi8(v, _mm_set1_epi8('>'))),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('=')));
+	__m128i values = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\''))),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('&')));
+	__m128i zero = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(tags, values), zero)));
+}
+
+// Flags candidates, terminator included, in 64 characters at block
+inline unsigned long long block_mask_64(const char *block)
+{
+	unsigned long long candidates = 0;
+	for (int i = 0; i < 64; i += 16)
+		candidates |= static_cast<unsigned long long>(block_mask(block + i)) << i;
+	return candidates;
+}
+
+#endif
+
+template<>
+void structural_index<char>::build(char *text, bool declarations)
+{
+	m_declarations = declarations;
+#if defined(XPROC_INDEX_SSE2)
+	m_begin = text;
+	m_size = 0;
+	m_active = false;
+	m_state = state_content;
+
+	// Aligned 64 byte blocks never cross a page boundary, so reading around the text is safe.
+	// Flags for bytes before text are discarded; the terminator is a candidate, and stage 1 stops there.
+	std::ptrdiff_t base = -static_cast<std::ptrdiff_t>(reinterpret_cast<std::size_t>(text) & 63);
+	unsigned long long valid = ~0ull << -base;
+	while (1)
+	{
+		unsigned long long candidates = block_mask_64(text + base) & valid;
+		reserve(64);
+		while (candidates)
+		{
+			if (!accept(static_cast<std::size_t>(base + first_bit(candidates))))
+			{
+				m_cursor = m_positions;
+				m_active = true;
+				return;
+			}
+			candidates &= candidates - 1;
+		}
+		base += 64;
+		valid = ~0ull;
+		if (static_cast<std::size_t>(base) > max_index_offset - 64)
+			return;
+	}
+#else
+	build_scalar(text);
+#endif
+}
+
+// Explicit instantiations
+template class structural_index<char>;
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
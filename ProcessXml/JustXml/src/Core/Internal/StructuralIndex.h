@@ -0,0 +1,181 @@
+/*
+ * StructuralIndex.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_STRUCTURALINDEX_H_
+#define SRC_CORE_INTERNAL_STRUCTURALINDEX_H_
+
+#include "ScanKernels.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+// Position index of structural characters, used by xflags::parse_structural_index.
+// Stage 1 (build) scans the whole text once for '<', '>', '"', '\'', '=' and '&', and records offsets of those which are markup,
+// up to and including the terminating zero.
+// Candidates are found 64 characters per step, then followed by a state machine which reads tags, quoted attribute values,
+// comments, CDATA sections, processing instructions and DOCTYPE the way the parser does, and drops what is not markup there:
+// quotes, '>' and '=' in text; all but the closing quote and '&' in attribute values, which only a quote after '=' opens;
+// all but the closing '>' in comments, CDATA sections, processing instructions and DOCTYPE.
+// Stage 2 answers scans of the parser by walking the index instead of the text:
+// next() skips runs of text and attribute values, markup_end() skips bodies of comments, CDATA sections and processing instructions.
+// Tags are short and still read by the parser, so '=' and the '>' ending a tag are recorded but not consulted.
+// Index entries are only read ahead of the parser, which never modifies text it has not yet passed.
+template<class ItemType>
+class structural_index
+{
+public:
+
+	structural_index()
+	: m_begin(0), m_positions(0), m_cursor(0), m_size(0), m_capacity(0), m_active(false),
+	  m_declarations(false), m_state(state_content), m_quote(0), m_name(0), m_named(false), m_until(0), m_close_1(0), m_close_2(0) {}
+
+	~structural_index()
+	{
+		delete[] m_positions;
+	}
+
+	// Runs stage 1 over zero-terminated text.
+	// Declarations tells if the parser reads attributes of the XML declaration, as with xflags::parse_declaration_node,
+	// or skips it as a processing instruction.
+	// Leaves index inactive if text is too long for 32 bit offsets.
+	void build(ItemType *, bool);
+
+	// Frees index memory
+	void release();
+
+	// True if built and usable for the last text
+	bool active() const
+	{
+		return m_active;
+	}
+
+	// Number of recorded positions, including the terminator
+	std::size_t size() const
+	{
+		return m_size;
+	}
+
+	// True if skips of the class can be answered from the index
+	static bool covers(scan_class kind)
+	{
+		return kind == scan_text || kind == scan_text_pure_no_ws ||
+				kind == scan_attribute_data_1 || kind == scan_attribute_data_1_pure ||
+				kind == scan_attribute_data_2 || kind == scan_attribute_data_2_pure;
+	}
+
+	// Returns first position at or after text which does not belong to the class; class must be covered
+	template<scan_class Class>
+	ItemType *next(ItemType *text)
+	{
+		const unsigned *position = seek(text);
+		while (!stops<Class>(m_begin[*position]))
+			++position;
+		m_cursor = position;
+		return m_begin + *position;
+	}
+
+	// Returns first recorded position at or after text.
+	// Within the body of a comment, CDATA section or processing instruction, this is the '>' ending it, or the terminator.
+	ItemType *markup_end(ItemType *text)
+	{
+		m_cursor = seek(text);
+		return m_begin + *m_cursor;
+	}
+
+private:
+
+	// State of stage 1 at a candidate
+	enum build_state
+	{
+		state_content,      // Text between markup
+		state_tag,          // Inside a tag, or an XML declaration whose attributes are read
+		state_value,        // Inside an attribute value quoted by m_quote
+		state_markup        // Inside markup ended by the first '>' at or after m_until which follows m_close_1 and m_close_2
+	};
+
+	// First entry at or after text
+	const unsigned *seek(ItemType *text) const
+	{
+		unsigned offset = static_cast<unsigned>(text - m_begin);
+		const unsigned *position = m_cursor;
+		while (*position < offset)
+			++position;
+		return position;
+	}
+
+	// Stop test of a covered class, for recorded characters only
+	template<scan_class Class>
+	static bool stops(ItemType ch)
+	{
+		switch (Class)
+		{
+		case scan_text:                     return ch == ItemType('<') || ch == ItemType('\0');
+		case scan_text_pure_no_ws:          return ch == ItemType('<') || ch == ItemType('&') || ch == ItemType('\0');
+		case scan_attribute_data_1:         return ch == ItemType('\'') || ch == ItemType('\0');
+		case scan_attribute_data_1_pure:    return ch == ItemType('\'') || ch == ItemType('&') || ch == ItemType('\0');
+		case scan_attribute_data_2:         return ch == ItemType('"') || ch == ItemType('\0');
+		default:                            return ch == ItemType('"') || ch == ItemType('&') || ch == ItemType('\0');
+		}
+	}
+
+	// Stage 1 step for the candidate at offset; space for the position must be reserved.
+	// Returns false at the terminator.
+	bool accept(std::size_t);
+
+	// State after '<' at offset
+	build_state open(std::size_t);
+
+	// True if quote at offset in a tag opens an attribute value
+	bool opens_value(std::size_t);
+
+	// Offset of '>' ending DOCTYPE whose body starts at offset, or of the terminator
+	std::size_t doctype_end(std::size_t) const;
+
+	// Stage 1, one character at a time
+	void build_scalar(ItemType *);
+
+	// Makes room for at least given number of further positions
+	void reserve(std::size_t);
+
+	// Copying is not allowed
+	structural_index(const structural_index &);
+	void operator =(const structural_index &);
+
+	ItemType *m_begin;                  // Text the index was built for
+	unsigned *m_positions;              // Offsets of structural characters, ending with offset of terminator
+	const unsigned *m_cursor;           // First entry which may still lie at or after the parser
+	std::size_t m_size;                 // Number of offsets
+	std::size_t m_capacity;             // Capacity of offsets array
+	bool m_active;                      // Built for current text
+	bool m_declarations;                // Attributes of XML declaration are read, see build()
+	build_state m_state;                // Stage 1 state
+	ItemType m_quote;                   // Quote of attribute value, in state_value
+	std::size_t m_name;                 // Offset in name of current tag up to which it is known to go on, in state_tag
+	bool m_named;                       // Name of current tag is known to end before m_name
+	std::size_t m_until;                // Least offset of '>' ending markup, in state_markup
+	ItemType m_close_1;                 // Character before '>' ending markup, or 0 if any
+	ItemType m_close_2;                 // Character before m_close_1, or 0 if any
+};
+
+// Narrow text is indexed 64 characters per step
+template<>
+void structural_index<char>::build(char *, bool);
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_STRUCTURALINDEX_H_ */
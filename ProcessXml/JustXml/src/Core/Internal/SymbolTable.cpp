@@ -0,0 +1,133 @@
+/*
+ * SymbolTable.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "SymbolTable.h"
+
+#include "CoreAlgorithms.h"
+#include "../ParseError.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+template<class ItemType>
+unsigned symbol_table<ItemType>::intern(const ItemType *name, std::size_t size)
+{
+	unsigned code = hash_name(name, size);
+
+	// Probe for name; table is never more than half full, so an empty slot is always found
+	if (m_slot_count)
+	{
+		for (std::size_t slot = code & (m_slot_count - 1); m_slots[slot]; slot = (slot + 1) & (m_slot_count - 1))
+		{
+			const entry &candidate = m_entries[m_slots[slot] - 1];
+			if (candidate.hash != code || candidate.size != size)
+				continue;
+			const ItemType *stored = m_chars + candidate.offset;
+			std::size_t i = 0;
+			while (i < size && stored[i] == name[i])
+				++i;
+			if (i == size)
+				return m_slots[slot];
+		}
+	}
+
+	// Add name
+	if ((m_count + 1) * 2 > m_slot_count)
+		grow();
+	if (m_count == m_entry_capacity)
+	{
+		std::size_t capacity = m_entry_capacity ? m_entry_capacity * 2 : 256;
+		entry *entries = new entry[capacity];
+#ifdef RAPIDXML_NO_EXCEPTIONS
+		if (!entries)           // If exceptions are disabled, verify memory allocation, because new will not be able to throw bad_alloc
+			RAPIDXML_PARSE_ERROR("out of memory", 0);
+#endif
+		for (std::size_t i = 0; i < m_count; ++i)
+			entries[i] = m_entries[i];
+		delete[] m_entries;
+		m_entries = entries;
+		m_entry_capacity = capacity;
+	}
+	if (m_chars_size + size > m_chars_capacity)
+	{
+		std::size_t capacity = m_chars_capacity ? m_chars_capacity * 2 : 4096;
+		if (capacity < m_chars_size + size)
+			capacity = m_chars_size + size;
+		ItemType *chars = new ItemType[capacity];
+#ifdef RAPIDXML_NO_EXCEPTIONS
+		if (!chars)             // If exceptions are disabled, verify memory allocation, because new will not be able to throw bad_alloc
+			RAPIDXML_PARSE_ERROR("out of memory", 0);
+#endif
+		for (std::size_t i = 0; i < m_chars_size; ++i)
+			chars[i] = m_chars[i];
+		delete[] m_chars;
+		m_chars = chars;
+		m_chars_capacity = capacity;
+	}
+	entry &added = m_entries[m_count];
+	added.offset = m_chars_size;
+	added.size = size;
+	added.hash = code;
+	for (std::size_t i = 0; i < size; ++i)
+		m_chars[m_chars_size++] = name[i];
+	unsigned id = static_cast<unsigned>(++m_count);
+	std::size_t slot = code & (m_slot_count - 1);
+	while (m_slots[slot])
+		slot = (slot + 1) & (m_slot_count - 1);
+	m_slots[slot] = id;
+	return id;
+}
+
+template<class ItemType>
+void symbol_table<ItemType>::release()
+{
+	delete[] m_slots;
+	delete[] m_entries;
+	delete[] m_chars;
+	m_slots = 0;
+	m_slot_count = 0;
+	m_entries = 0;
+	m_count = 0;
+	m_entry_capacity = 0;
+	m_chars = 0;
+	m_chars_size = 0;
+	m_chars_capacity = 0;
+}
+
+template<class ItemType>
+void symbol_table<ItemType>::grow()
+{
+	std::size_t count = m_slot_count ? m_slot_count * 2 : 1024;
+	unsigned *slots = new unsigned[count];
+#ifdef RAPIDXML_NO_EXCEPTIONS
+	if (!slots)             // If exceptions are disabled, verify memory allocation, because new will not be able to throw bad_alloc
+		RAPIDXML_PARSE_ERROR("out of memory", 0);
+#endif
+	for (std::size_t i = 0; i < count; ++i)
+		slots[i] = 0;
+	for (std::size_t i = 0; i < m_count; ++i)
+	{
+		std::size_t slot = m_entries[i].hash & (count - 1);
+		while (slots[slot])
+			slot = (slot + 1) & (count - 1);
+		slots[slot] = static_cast<unsigned>(i + 1);
+	}
+	delete[] m_slots;
+	m_slots = slots;
+	m_slot_count = count;
+}
+
+// Explicit instantiations
+template class symbol_table<char>;
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,95 @@
+/*
+ * SymbolTable.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_SYMBOLTABLE_H_
+#define SRC_CORE_INTERNAL_SYMBOLTABLE_H_
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdlib>      // For std::size_t
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+// Table of distinct names, used by xflags::parse_intern_names.
+// Names are copied into the table, so their identifiers do not depend on the text they were found in,
+// and stay valid until the table is released.
+// Identifiers are issued consecutively from 1; 0 stands for no name.
+template<class ItemType>
+class symbol_table
+{
+public:
+
+	symbol_table()
+	: m_slots(0), m_slot_count(0), m_entries(0), m_count(0), m_entry_capacity(0), m_chars(0), m_chars_size(0), m_chars_capacity(0) {}
+
+	~symbol_table()
+	{
+		release();
+	}
+
+	// Returns identifier of name, adding name if it is not in the table yet
+	unsigned intern(const ItemType *, std::size_t);
+
+	// Number of names in the table; identifiers range from 1 to this number
+	std::size_t size() const
+	{
+		return m_count;
+	}
+
+	// Gets name of identifier, which must have been issued by the table
+	const ItemType *name(unsigned id) const
+	{
+		return m_chars + m_entries[id - 1].offset;
+	}
+
+	// Gets size of name of identifier, which must have been issued by the table
+	std::size_t name_size(unsigned id) const
+	{
+		return m_entries[id - 1].size;
+	}
+
+	// Frees table memory; all identifiers become invalid
+	void release();
+
+private:
+
+	// Name stored in the table
+	struct entry
+	{
+		std::size_t offset;             // Start of name in m_chars
+		std::size_t size;               // Size of name
+		unsigned hash;                  // Hash of name
+	};
+
+	// Doubles number of hash slots and reinserts all names
+	void grow();
+
+	// Copying is not allowed
+	symbol_table(const symbol_table &);
+	void operator =(const symbol_table &);
+
+	unsigned *m_slots;                  // Open addressing hash slots holding identifiers, 0 if empty
+	std::size_t m_slot_count;           // Number of slots, power of 2
+	entry *m_entries;                   // Names, indexed by identifier minus 1
+	std::size_t m_count;                // Number of names
+	std::size_t m_entry_capacity;       // Capacity of names array
+	ItemType *m_chars;                  // Characters of all names, back to back
+	std::size_t m_chars_size;           // Characters used
+	std::size_t m_chars_capacity;       // Characters allocated
+};
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_SYMBOLTABLE_H_ */
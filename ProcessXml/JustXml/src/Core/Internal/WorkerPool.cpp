@@ -0,0 +1,90 @@
+/*
+ * WorkerPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "WorkerPool.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+#if defined(XPROC_PARALLEL_PARSE)
+
+worker_pool::~worker_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (std::size_t i = 0; i < m_threads.size(); ++i)
+		m_threads[i].join();
+}
+
+void worker_pool::run(std::size_t count, const task &function)
+{
+	while (m_threads.size() + 1 < count)
+	{
+		try
+		{
+			m_threads.push_back(std::thread(&worker_pool::work, this));
+		}
+		catch (...)
+		{
+			break;
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_task = &function;
+	m_count = count;
+	m_next = 0;
+	m_done = 0;
+	m_wake.notify_all();
+
+	// Calling thread takes indices as the pool threads do
+	while (m_next < m_count)
+	{
+		std::size_t index = m_next++;
+		lock.unlock();
+		function(index);
+		lock.lock();
+		++m_done;
+	}
+	while (m_done < m_count)
+		m_finished.wait(lock);
+	m_task = 0;
+	m_count = 0;
+	m_next = 0;
+}
+
+void worker_pool::work()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (1)
+	{
+		while (!m_stop && m_next >= m_count)
+			m_wake.wait(lock);
+		if (m_stop)
+			return;
+		std::size_t index = m_next++;
+		const task &function = *m_task;
+		lock.unlock();
+		function(index);
+		lock.lock();
+		if (++m_done == m_count)
+			m_finished.notify_one();
+	}
+}
+
+#endif
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,78 @@
+/*
+ * WorkerPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_INTERNAL_WORKERPOOL_H_
+#define SRC_CORE_INTERNAL_WORKERPOOL_H_
+
+// Parallel parsing needs C++11 threads, and exceptions to report failures of workers
+#if !defined(XPROC_NO_STDLIB) && !defined(RAPIDXML_NO_EXCEPTIONS) && (__cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L))
+#define XPROC_PARALLEL_PARSE
+#include <condition_variable>   // For std::condition_variable
+#include <cstdlib>              // For std::size_t
+#include <functional>           // For std::function
+#include <mutex>                // For std::mutex
+#include <thread>               // For std::thread
+#include <vector>               // For std::vector
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+namespace xinternal
+{
+
+#if defined(XPROC_PARALLEL_PARSE)
+
+// Threads kept by xml_document for xml_document::parse_parallel().
+// Threads are started when a run first needs them, and wait on a condition variable between runs,
+// so that repeated parses neither start threads nor spin while other threads work.
+class worker_pool
+{
+public:
+
+	// Task run for each index of a run; it must not throw
+	typedef std::function<void (std::size_t)> task;
+
+	worker_pool()
+	: m_task(0), m_count(0), m_next(0), m_done(0), m_stop(false) {}
+
+	// Stops and joins all threads
+	~worker_pool();
+
+	// Runs task for every index below count, on the calling thread and on up to count - 1 threads of the pool,
+	// and returns once all indices are done, so that effects of every task are visible to the caller.
+	// Threads are started as needed; if one cannot be started, the remaining indices are run by the threads there are.
+	void run(std::size_t, const task &);
+
+private:
+
+	// Runs indices of runs until the pool is stopped
+	void work();
+
+	// Copying is not allowed
+	worker_pool(const worker_pool &);
+	void operator =(const worker_pool &);
+
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;                     // Guards all members below
+	std::condition_variable m_wake;         // Signalled when a run starts or the pool stops
+	std::condition_variable m_finished;     // Signalled when the last index of a run is done
+	const task *m_task;                     // Task of current run
+	std::size_t m_count;                    // Number of indices of current run, 0 between runs
+	std::size_t m_next;                     // Next index to be taken
+	std::size_t m_done;                     // Number of indices done
+	bool m_stop;                            // Set by destructor
+};
+
+#endif
+
+} /* namespace xinternal */
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_INTERNAL_WORKERPOOL_H_ */
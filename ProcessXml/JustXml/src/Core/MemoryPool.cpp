@@ -7,71 +7,73 @@
 
 #include "MemoryPool.h"
 
+#include "XmlNode.h"
+#include "XmlAttribute.h"
+#include "ParseError.h"
 #include "Internal/CoreAlgorithms.h"
 
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <new>          // For placement new
+#endif
+
+// Cage of compact layout
+#if defined(XPROC_COMPACT_NODES)
+#include <sys/mman.h>   // For mmap, mprotect, madvise
+#include <unistd.h>     // For sysconf
+
+// Blocks mapped for huge pages
+#elif defined(__unix__) || defined(__APPLE__) || defined(__CYGWIN__)
+#define XPROC_POOL_MMAP
+#include <sys/mman.h>   // For mmap, munmap, madvise
+#endif
+
 namespace xprocesser
 {
 namespace xcore
 {
 
+namespace xinternal
+{
+
+// Size and alignment of huge pages
+const std::size_t huge_page_size = 2 * 1024 * 1024;
+
+}
+
 template<typename ItemType>
 memory_pool<ItemType>::memory_pool()
-: m_alloc_func(0)
+: m_retention(RAPIDXML_RETAINED_POOL_SIZE)
+  , m_first_block(RAPIDXML_DYNAMIC_POOL_SIZE)
+  , m_growth(1)
+  , m_largest_block(RAPIDXML_DYNAMIC_POOL_SIZE)
+  , m_block_size(RAPIDXML_DYNAMIC_POOL_SIZE)
+  , m_huge_pages(false)
+  , m_alloc_func(0)
   , m_free_func(0)
   {
+#if defined(XPROC_COMPACT_NODES)
+	m_cage = 0;
+	m_document = 0;
+	m_growth = 2;
+	m_largest_block = xinternal::cage_size;
+#else
+	m_free = 0;
+	m_retained = 0;
+#endif
+#if defined(XPROC_POOL_STATISTICS)
+	reset_statistics();
+#endif
 	init();
   }
 
 template<typename ItemType>
 memory_pool<ItemType>::~memory_pool()
 {
+	set_retention(0);
 	clear();
 }
 
-template<typename ItemType>
-xml_node<ItemType> *memory_pool<ItemType>::allocate_node(node_type type, const ItemType *name, const ItemType *value, std::size_t name_size, std::size_t value_size)
-{
-	void *memory = allocate_aligned(sizeof(xml_node<ItemType>));
-	xml_node<ItemType> *node = new(memory) xml_node<ItemType>(type);
-	if (name)
-	{
-		if (name_size > 0)
-			node->name(name, name_size);
-		else
-			node->name(name);
-	}
-	if (value)
-	{
-		if (value_size > 0)
-			node->value(value, value_size);
-		else
-			node->value(value);
-	}
-	return node;
-}
-
-template<typename ItemType>
-xml_attribute<ItemType> *memory_pool<ItemType>::allocate_attribute(const ItemType *name, const ItemType *value, std::size_t name_size, std::size_t value_size)
-{
-	void *memory = allocate_aligned(sizeof(xml_attribute<ItemType>));
-	xml_attribute<ItemType> *attribute = new(memory) xml_attribute<ItemType>;
-	if (name)
-	{
-		if (name_size > 0)
-			attribute->name(name, name_size);
-		else
-			attribute->name(name);
-	}
-	if (value)
-	{
-		if (value_size > 0)
-			attribute->value(value, value_size);
-		else
-			attribute->value(value);
-	}
-	return attribute;
-}
-
 template<typename ItemType>
 ItemType *memory_pool<ItemType>::allocate_string(const ItemType *source , std::size_t size )
 {
@@ -79,6 +81,9 @@ ItemType *memory_pool<ItemType>::allocate_string(const ItemType *source , std::s
 	if (size == 0)
 		size = xinternal::measure(source) + 1;
 	ItemType *result = static_cast<ItemType *>(allocate_aligned(size * sizeof(ItemType)));
+#if defined(XPROC_POOL_STATISTICS)
+	m_statistics.string_bytes += size * sizeof(ItemType);
+#endif
 	if (source)
 		for (std::size_t i = 0; i < size; ++i)
 			result[i] = source[i];
@@ -111,25 +116,296 @@ xml_node<ItemType> *memory_pool<ItemType>::clone_node(const xml_node<ItemType> *
 	return result;
 }
 
+template<typename ItemType>
+void memory_pool<ItemType>::set_block_sizes(std::size_t first, std::size_t growth, std::size_t largest)
+{
+	assert(first && growth >= 1 && largest >= first);
+	m_first_block = first;
+	m_growth = growth;
+	m_largest_block = largest;
+	m_block_size = first;
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::set_huge_pages(bool enable)
+{
+	m_huge_pages = enable;
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::grow_block()
+{
+	if (m_block_size > m_largest_block / m_growth)
+		m_block_size = m_largest_block;
+	else
+		m_block_size *= m_growth;
+}
+
+#if defined(XPROC_POOL_STATISTICS)
+
+template<typename ItemType>
+void memory_pool<ItemType>::reset_statistics()
+{
+	m_statistics = pool_statistics();
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::count_allocation(char *result, std::size_t size)
+{
+	m_statistics.bytes += size;
+	m_statistics.padding_bytes += result - m_ptr;
+	m_statistics.used_bytes += result - m_ptr + size;
+	if (m_statistics.peak_bytes < m_statistics.used_bytes)
+		m_statistics.peak_bytes = m_statistics.used_bytes;
+	++m_statistics.allocations;
+#if !defined(XPROC_COMPACT_NODES)
+	if (m_begin == m_static_memory)
+		++m_statistics.static_allocations;
+#endif
+}
+
+#endif
+
+#if defined(XPROC_COMPACT_NODES)
+
+template<typename ItemType>
+void memory_pool<ItemType>::clear()
+{
+#if defined(XPROC_POOL_STATISTICS)
+	m_statistics.used_bytes = 0;
+#endif
+	if (m_cage && m_retention)
+	{
+		// Cage is kept, and its accessible part beyond retention is given back
+		std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+		std::size_t kept = (m_retention + page - 1) / page * page;
+		if (kept < static_cast<std::size_t>(m_end - m_cage))
+		{
+			madvise(m_cage + kept, m_end - m_cage - kept, MADV_DONTNEED);
+			mprotect(m_cage + kept, m_end - m_cage - kept, PROT_NONE);
+			m_end = m_cage + kept;
+		}
+		xinternal::cage_header *header = reinterpret_cast<xinternal::cage_header *>(m_cage);
+		header->text = 0;
+		header->text_end = 0;
+		m_text = 0;
+		m_text_end = 0;
+		m_ptr = m_cage + sizeof(xinternal::cage_header);
+		m_block_size = m_first_block;
+		return;
+	}
+	if (m_cage)
+		munmap(m_cage, xinternal::cage_size);
+	m_cage = 0;
+	init();
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::set_retention(std::size_t size)
+{
+	// Cage in use is kept until the next clear()
+	m_retention = size;
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::set_allocator(alloc_func *af, free_func *ff)
+{
+	assert(!m_cage);    // Verify that no memory is allocated yet
+	m_alloc_func = af;
+	m_free_func = ff;
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::init()
+{
+	m_ptr = 0;
+	m_end = 0;
+	m_text = 0;
+	m_text_end = 0;
+	m_block_size = m_first_block;
+}
+
+namespace xinternal
+{
+
+// Map inaccessible address space exactly at address, or return 0.
+// Mappings already there are never replaced; a system which does not know MAP_FIXED_NOREPLACE takes the address as a hint.
+inline char *reserve_at(char *address, std::size_t size)
+{
+#if defined(MAP_FIXED_NOREPLACE)
+	const int fixed = MAP_FIXED_NOREPLACE;
+#else
+	const int fixed = 0;
+#endif
+	void *reserved = mmap(address, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | fixed, -1, 0);
+	if (reserved == MAP_FAILED)
+		return 0;
+	if (reserved != address)
+	{
+		munmap(reserved, size);
+		return 0;
+	}
+	return address;
+}
+
+// Reserve aligned cage.
+// Reserved memory is inaccessible, so it does not count against limits of the system until it is made accessible.
+inline char *reserve_cage()
+{
+	char *reserved = static_cast<char *>(mmap(0, cage_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+	if (reserved == MAP_FAILED)
+		return 0;
+	char *cage = cage_of(reserved);
+	if (cage == reserved)
+		return cage;
+
+	// Aligned address below the reservation is usually free, since mappings are placed top down,
+	// so the reservation is given back and made again there
+	munmap(reserved, cage_size);
+	if (reserve_at(cage, cage_size))
+		return cage;
+
+	// Otherwise reserve twice the size of the cage, so an aligned cage fits in, and give back the rest
+	reserved = static_cast<char *>(mmap(0, 2 * cage_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+	if (reserved == MAP_FAILED)
+		return 0;
+	cage = cage_of(reserved + cage_size - 1);
+	if (cage != reserved)
+		munmap(reserved, cage - reserved);
+	munmap(cage + cage_size, reserved + cage_size - cage);
+	return cage;
+}
+
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::reserve()
+{
+	char *cage = xinternal::reserve_cage();
+	if (!cage)
+	{
+#ifdef RAPIDXML_NO_EXCEPTIONS
+		RAPIDXML_PARSE_ERROR("out of memory", 0);
+#else
+		throw std::bad_alloc();
+#endif
+	}
+#if defined(MADV_HUGEPAGE)
+	if (m_huge_pages)
+		madvise(cage, xinternal::cage_size, MADV_HUGEPAGE);
+#endif
+	m_cage = cage;
+	m_end = cage;
+	commit(cage + sizeof(xinternal::cage_header));
+
+	// Header lets nodes find the pool, the document and the text from their addresses
+	xinternal::cage_header *header = reinterpret_cast<xinternal::cage_header *>(m_cage);
+	header->pool = this;
+	header->document = m_document;
+	header->text = m_text;
+	header->text_end = m_text_end;
+	m_ptr = cage + sizeof(xinternal::cage_header);
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::commit(char *end)
+{
+	// Accessible part grows by the size of the next block, in whole pages, to keep calls to the system few
+	std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	std::size_t grow = m_block_size;
+	grow_block();
+#if defined(XPROC_POOL_STATISTICS)
+	++m_statistics.blocks;
+#endif
+	if (grow < static_cast<std::size_t>(end - m_end))
+		grow = end - m_end;
+	grow = (grow + page - 1) / page * page;
+	if (grow > static_cast<std::size_t>(m_cage + xinternal::cage_size - m_end))
+		grow = m_cage + xinternal::cage_size - m_end;
+	if (mprotect(m_end, grow, PROT_READ | PROT_WRITE) != 0)
+	{
+#ifdef RAPIDXML_NO_EXCEPTIONS
+		RAPIDXML_PARSE_ERROR("out of memory", 0);
+#else
+		throw std::bad_alloc();
+#endif
+	}
+	m_end += grow;
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::cage_text(const ItemType *text, std::size_t size)
+{
+	// Header gets the text when the cage is reserved, so parsing text which makes no nodes reserves nothing
+	m_text = reinterpret_cast<const char *>(text);
+	m_text_end = reinterpret_cast<const char *>(text + size);
+	if (m_cage)
+	{
+		xinternal::cage_header *header = reinterpret_cast<xinternal::cage_header *>(m_cage);
+		header->text = m_text;
+		header->text_end = m_text_end;
+	}
+}
+
+template<typename ItemType>
+void memory_pool<ItemType>::presize(std::size_t size)
+{
+	if (!m_cage)
+		reserve();
+
+	// Allocations beyond the cage fail anyway, when they are made
+	char *result = align(m_ptr);
+	if (size > static_cast<std::size_t>(m_cage + xinternal::cage_size - result))
+		size = m_cage + xinternal::cage_size - result;
+	if (result + size > m_end)
+		commit(result + size);
+}
+
+#else
+
 template<typename ItemType>
 void memory_pool<ItemType>::clear()
 {
+#if defined(XPROC_POOL_STATISTICS)
+	m_statistics.used_bytes = 0;
+#endif
+	// Blocks are kept on the free chain while they fit in retention
 	while (m_begin != m_static_memory)
 	{
-		char *previous_begin = reinterpret_cast<header *>(align(m_begin))->previous_begin;
-		if (m_free_func)
-			m_free_func(m_begin);
+		header *block = reinterpret_cast<header *>(align(m_begin));
+		char *previous_begin = block->previous_begin;
+		if (m_retained + block->size <= m_retention)
+		{
+			block->previous_begin = m_free;
+			m_free = m_begin;
+			m_retained += block->size;
+		}
 		else
-			delete[] m_begin;
+			free_raw(m_begin);
 		m_begin = previous_begin;
 	}
 	init();
 }
 
+template<typename ItemType>
+void memory_pool<ItemType>::set_retention(std::size_t size)
+{
+	// Blocks kept beyond new retention are freed
+	m_retention = size;
+	while (m_retained > m_retention)
+	{
+		header *block = reinterpret_cast<header *>(align(m_free));
+		char *next = block->previous_begin;
+		m_retained -= block->size;
+		free_raw(m_free);
+		m_free = next;
+	}
+}
+
 template<typename ItemType>
 void memory_pool<ItemType>::set_allocator(alloc_func *af, free_func *ff)
 {
-	assert(m_begin == m_static_memory && m_ptr == align(m_begin));    // Verify that no memory is allocated yet
+	assert(m_begin == m_static_memory && m_ptr == align(m_begin) && !m_free);    // Verify that no memory is allocated yet
 	m_alloc_func = af;
 	m_free_func = ff;
 }
@@ -137,18 +413,12 @@ void memory_pool<ItemType>::set_allocator(alloc_func *af, free_func *ff)
 template<typename ItemType>
 void memory_pool<ItemType>::init()
 {
+	m_block_size = m_first_block;
 	m_begin = m_static_memory;
 	m_ptr = align(m_begin);
 	m_end = m_static_memory + sizeof(m_static_memory);
 }
 
-template<typename ItemType>
-char *memory_pool<ItemType>::align(char *ptr)
-{
-	std::size_t alignment = ((RAPIDXML_ALIGNMENT - (std::size_t(ptr) & (RAPIDXML_ALIGNMENT - 1))) & (RAPIDXML_ALIGNMENT - 1));
-	return ptr + alignment;
-}
-
 template<typename ItemType>
 char *memory_pool<ItemType>::allocate_raw(std::size_t size)
 {
@@ -171,40 +441,111 @@ char *memory_pool<ItemType>::allocate_raw(std::size_t size)
 }
 
 template<typename ItemType>
-void *memory_pool<ItemType>::allocate_aligned(std::size_t size)
+char *memory_pool<ItemType>::map_raw(std::size_t size)
 {
-	// Calculate aligned pointer
-	char *result = align(m_ptr);
+#if defined(XPROC_POOL_MMAP)
+	// Map more than needed, and give back what lies around the aligned part
+	char *mapped = static_cast<char *>(mmap(0, size + xinternal::huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	if (mapped == MAP_FAILED)
+		return 0;
+	char *memory = mapped + (xinternal::huge_page_size - (std::size_t(mapped) & (xinternal::huge_page_size - 1))) % xinternal::huge_page_size;
+	if (memory != mapped)
+		munmap(mapped, memory - mapped);
+	if (memory + size != mapped + size + xinternal::huge_page_size)
+		munmap(memory + size, mapped + xinternal::huge_page_size - memory);
+#if defined(MADV_HUGEPAGE)
+	madvise(memory, size, MADV_HUGEPAGE);
+#endif
+	return memory;
+#else
+	(void)size;
+	return 0;
+#endif
+}
 
-	// If not enough memory left in current pool, allocate a new pool
-	if (result + size > m_end)
+template<typename ItemType>
+void memory_pool<ItemType>::free_raw(char *memory)
+{
+#if defined(XPROC_POOL_MMAP)
+	header *block = reinterpret_cast<header *>(align(memory));
+	if (block->mapped)
 	{
-		// Calculate required pool size (may be bigger than RAPIDXML_DYNAMIC_POOL_SIZE)
-		std::size_t pool_size = RAPIDXML_DYNAMIC_POOL_SIZE;
-		if (pool_size < size)
-			pool_size = size;
-
-		// Allocate
-		std::size_t alloc_size = sizeof(header) + (2 * RAPIDXML_ALIGNMENT - 2) + pool_size;     // 2 alignments required in worst case: one for header, one for actual allocation
-		char *raw_memory = allocate_raw(alloc_size);
-
-		// Setup new pool in allocated memory
-		char *pool = align(raw_memory);
-		header *new_header = reinterpret_cast<header *>(pool);
-		new_header->previous_begin = m_begin;
-		m_begin = raw_memory;
-		m_ptr = pool + sizeof(header);
-		m_end = raw_memory + alloc_size;
-
-		// Calculate aligned pointer again using new pool
-		result = align(m_ptr);
+		munmap(memory, block->size);
+		return;
 	}
+#endif
+	if (m_free_func)
+		m_free_func(memory);
+	else
+		delete[] memory;
+}
 
-	// Update pool and return aligned pointer
-	m_ptr = result + size;
-	return result;
+template<typename ItemType>
+void memory_pool<ItemType>::presize(std::size_t size)
+{
+	if (align(m_ptr) + size > m_end)
+		allocate_block(size);
 }
 
+template<typename ItemType>
+void memory_pool<ItemType>::allocate_block(std::size_t size)
+{
+#if defined(XPROC_POOL_STATISTICS)
+	// What remains of the current block is left unused
+	m_statistics.tail_bytes += m_end - m_ptr;
+	m_statistics.used_bytes += m_end - m_ptr;
+	++m_statistics.blocks;
+#endif
+
+	// Calculate required pool size (may be bigger than the next block)
+	std::size_t pool_size = m_block_size;
+	if (pool_size < size)
+		pool_size = size;
+
+	// Reuse the first block kept by clear() which is big enough, or allocate
+	std::size_t alloc_size = sizeof(header) + (2 * RAPIDXML_ALIGNMENT - 2) + pool_size;     // 2 alignments required in worst case: one for header, one for actual allocation
+	char *raw_memory = 0;
+	for (char **link = &m_free; *link; link = &reinterpret_cast<header *>(align(*link))->previous_begin)
+	{
+		header *block = reinterpret_cast<header *>(align(*link));
+		if (block->size >= alloc_size)
+		{
+			raw_memory = *link;
+			alloc_size = block->size;
+			m_retained -= alloc_size;
+			*link = block->previous_begin;
+			break;
+		}
+	}
+	bool mapped = false;
+	if (raw_memory)
+		mapped = reinterpret_cast<header *>(align(raw_memory))->mapped;
+	else if (m_huge_pages && !m_alloc_func && alloc_size >= xinternal::huge_page_size)
+	{
+		// Large block in whole huge pages, or allocated as others if it cannot be mapped
+		alloc_size = (alloc_size + xinternal::huge_page_size - 1) / xinternal::huge_page_size * xinternal::huge_page_size;
+		raw_memory = map_raw(alloc_size);
+		mapped = raw_memory != 0;
+	}
+	if (!raw_memory)
+		raw_memory = allocate_raw(alloc_size);
+	grow_block();
+
+	// Setup new pool in allocated memory
+	char *pool = align(raw_memory);
+	header *new_header = reinterpret_cast<header *>(pool);
+	new_header->previous_begin = m_begin;
+	new_header->size = alloc_size;
+	new_header->mapped = mapped;
+	m_begin = raw_memory;
+	m_ptr = pool + sizeof(header);
+	m_end = raw_memory + alloc_size;
+}
+
+#endif
+
+// Explicit instantiations
+template class memory_pool<char>;
 
 } /* namespace xcore */
 } /* namespace xprocesser */
@@ -24,6 +24,12 @@ namespace xcore
 // Forward declarations
 template<class ItemType> class xml_node;
 template<class ItemType> class xml_attribute;
+template<class ItemType> class xml_document;
+template<class ItemType> class xml_tape;
+namespace xinternal
+{
+template<class ItemType> class child_index;
+}
 
 enum node_type
 {
@@ -37,6 +43,30 @@ enum node_type
 	node_pi             //!< A PI node. Name contains target. Value contains instructions.
 };
 
+///////////////////////////////////////////////////////////////////////
+// Memory pool statistics
+
+// Define XPROC_POOL_STATISTICS to have memory_pool count what it allocates, see memory_pool::statistics().
+// Counting takes a few additions per allocation; without the macro, no counting code nor the functions reporting counts are compiled.
+
+//! Statistics of memory_pool, reported by memory_pool::statistics() when <code>XPROC_POOL_STATISTICS</code> is defined.
+//! Counts are kept from construction of the pool, or from memory_pool::reset_statistics(), over any number of clear() calls;
+//! only used_bytes starts again from 0 on clear().
+struct pool_statistics
+{
+	std::size_t node_bytes;             //!< Bytes allocated for nodes, by allocate_node() and clone_node()
+	std::size_t attribute_bytes;        //!< Bytes allocated for attributes, by allocate_attribute() and clone_node()
+	std::size_t string_bytes;           //!< Bytes allocated for strings, by allocate_string(); these include names and values copied or decoded by the parser
+	std::size_t bytes;                  //!< Bytes allocated in all; above the sum of bytes for nodes, attributes and strings by internal tables such as child indexes
+	std::size_t padding_bytes;          //!< Bytes skipped to align allocations
+	std::size_t tail_bytes;             //!< Bytes left unused at ends of blocks, when allocations needed more than remained in them
+	std::size_t allocations;            //!< Number of allocations
+	std::size_t static_allocations;     //!< Number of allocations made from static memory; with allocations, gives the hit rate of static memory
+	std::size_t blocks;                 //!< Number of dynamic blocks started, allocated or kept by clear(); with <code>XPROC_COMPACT_NODES</code>, of parts of the cage made accessible
+	std::size_t used_bytes;             //!< Bytes taken from memory since the last clear(), counting padding and tails
+	std::size_t peak_bytes;             //!< Most bytes taken from memory between two clear() calls, the high-water mark of used_bytes
+};
+
 ///////////////////////////////////////////////////////////////////////
 // Memory pool
 
@@ -60,7 +90,9 @@ enum node_type
 //! Pool maintains <code>RAPIDXML_STATIC_POOL_SIZE</code> bytes of statically allocated memory.
 //! Until static memory is exhausted, no dynamic memory allocations are done.
 //! When static memory is exhausted, pool allocates additional blocks of memory of size <code>RAPIDXML_DYNAMIC_POOL_SIZE</code> each,
-//! by using global <code>new[]</code> and <code>delete[]</code> operators.
+//! by using global <code>new[]</code> and <code>delete[]</code> operators; set_block_sizes() lets blocks grow geometrically instead,
+//! and set_huge_pages() has large blocks mapped for huge pages.
+//! clear() can keep these blocks for further allocations instead of freeing them, see set_retention().
 
 
 //! This behaviour can be changed by setting custom allocation routines.
@@ -79,10 +111,24 @@ typedef void (free_func)(void *);              // Type of user-defined function
 //! If required, you can tweak <code>RAPIDXML_STATIC_POOL_SIZE</code>, <code>RAPIDXML_DYNAMIC_POOL_SIZE</code> and <code>RAPIDXML_ALIGNMENT</code>
 //! to obtain best wasted memory to performance compromise.
 //! To do it, define their values before rapidxml.hpp file is included.
+//! <br><br>
+//! With <code>XPROC_COMPACT_NODES</code> defined, the pool takes all its memory from a single cage,
+//! 2 GB of address space reserved by mmap() on the first allocation and made accessible as the pool grows,
+//! so that nodes can refer to each other by 32-bit offsets. Pools which never allocate, as those of the scanning components,
+//! reserve no cage at all. Static memory and allocation functions are not used then,
+//! names and values given to nodes are copied into the pool unless they already lie in it or in the text last parsed,
+//! and nodes of one tree must all come from one pool.
 //! \param ItemType Character type of created nodes.
 template<class ItemType = char>
 class memory_pool
 {
+	friend class xinternal::child_index<ItemType>;
+#if defined(XPROC_COMPACT_NODES)
+	friend class xml_node<ItemType>;
+	friend class xml_document<ItemType>;
+	friend class xml_tape<ItemType>;
+#endif
+
 public:
 	//! Constructs empty pool with default allocator functions.
 	memory_pool();
@@ -137,10 +183,58 @@ public:
 	xml_node<ItemType> *clone_node(const xml_node<ItemType> *, xml_node<ItemType> * = 0);
 
 	//! Clears the pool.
-	//! This causes memory occupied by nodes allocated by the pool to be freed.
+	//! This causes memory occupied by nodes allocated by the pool to be freed,
+	//! or kept for further allocations up to the retention set by set_retention().
 	//! Any nodes or strings allocated from the pool will no longer be valid.
 	void clear();
 
+	//! Sets how much memory clear() keeps for further allocations, instead of freeing it.
+	//! A pool cleared and filled again, as by a loop parsing similar documents, then allocates no memory once it has grown enough.
+	//! Dynamic blocks are kept while their total size fits in retention, and reused for allocations they are big enough for;
+	//! with <code>XPROC_COMPACT_NODES</code> defined, the cage is kept with up to retention bytes of it accessible.
+	//! Memory kept beyond new retention is freed at once. Retention defaults to <code>RAPIDXML_RETAINED_POOL_SIZE</code>.
+	//! \param size Retention in bytes, or 0 to free all memory on clear().
+	void set_retention(std::size_t);
+
+	//! Sets sizes of dynamic blocks, so that a big document takes few blocks.
+	//! The first block allocated after static memory, or after clear(), has the first size;
+	//! each further block is larger by the growth factor, up to the largest size. A block is larger still if an allocation needs it.
+	//! Defaults are <code>RAPIDXML_DYNAMIC_POOL_SIZE</code> for both sizes and a factor of 1, so that all blocks are of that size.
+	//! With <code>XPROC_COMPACT_NODES</code> defined, sizes apply to the parts of the cage made accessible as the pool grows,
+	//! and defaults are a factor of 2 and no largest size.
+	//! \param first Size of the first block, in bytes.
+	//! \param growth Factor by which each block is larger than the one before, at least 1.
+	//! \param largest Largest size of block, in bytes, reached by growth; at least the first size.
+	void set_block_sizes(std::size_t, std::size_t, std::size_t);
+
+	//! Makes sure that the pool can allocate given number of bytes from the block it allocates from, without growing.
+	//! If the block has not that much left, a new block of at least this size is allocated at once,
+	//! so that nodes allocated next, for example by the parser given xflags::parse_presize, lie together in document order.
+	//! Memory left in the block before is not used then.
+	//! With <code>XPROC_COMPACT_NODES</code> defined, as much of the cage is made accessible in one step.
+	//! \param size Number of bytes to make available.
+	void presize(std::size_t);
+
+	//! Sets whether blocks of at least 2 MB are mapped from the system aligned to 2 MB and advised for huge pages,
+	//! which cuts TLB misses while a big document is parsed and traversed. It has effect where the system supports mmap(),
+	//! and for blocks allocated later, unless allocation functions are set by set_allocator().
+	//! With <code>XPROC_COMPACT_NODES</code> defined, the whole cage is advised for huge pages when it is reserved.
+	//! \param enable True to map large blocks for huge pages, false to allocate them as other blocks (default).
+	void set_huge_pages(bool);
+
+#if defined(XPROC_POOL_STATISTICS)
+	//! Gets statistics of memory allocated from the pool, for sizing its memory or spotting documents that take too much of it.
+	//! Memory of worker documents of xml_document::parse_parallel() is counted by their own pools, and not reported here.
+	//! \return Statistics of the pool.
+	const pool_statistics &statistics() const
+	{
+		return m_statistics;
+	}
+
+	//! Resets all counts of statistics to 0.
+	void reset_statistics();
+#endif
+
 	//! Sets or resets the user-defined memory allocation functions for the pool.
 	//! This can only be called when no memory is allocated from the pool yet, otherwise results are undefined.
 	//! Allocation function must not return invalid pointer on failure. It should either throw,
@@ -161,22 +255,72 @@ private:
 	struct header
 	{
 		char *previous_begin;
+		std::size_t size;                               // Size of raw memory of the block
+		bool mapped;                                    // Whether the block is mapped for huge pages
 	};
 
 	void init();
 
+	// Defined in XmlNode.h with allocate_node() and allocate_attribute(), so that the parser inlines them
 	char *align(char *);
 
 	char *allocate_raw(std::size_t);
 
+	// Defined in XmlNode.h, as align()
 	void *allocate_aligned(std::size_t);
 
+	// Start a new block, which size bytes fit in after alignment; reuse a block kept by clear() if one is big enough
+	void allocate_block(std::size_t);
+
+	// Map raw memory of given size for huge pages; return 0 if it cannot be mapped
+	char *map_raw(std::size_t);
+
+	// Free raw memory of block
+	void free_raw(char *);
+
+	// Make the next dynamic block larger by the growth factor, up to the largest size
+	void grow_block();
+
+#if defined(XPROC_POOL_STATISTICS)
+	// Count allocation of given size at result, which m_ptr was aligned to
+	void count_allocation(char *, std::size_t);
+#endif
+
+#if defined(XPROC_COMPACT_NODES)
+	// Reserve the cage, make its first part accessible and write its header
+	void reserve();
+
+	// Make more of the cage accessible, so that it extends at least to end
+	void commit(char *);
+
+	// Record text being parsed, in which strings of nodes are kept by offset; 0 if none. Reserves nothing.
+	void cage_text(const ItemType *, std::size_t);
+
+	char *m_cage;                                       // Start of cage, or 0 until the first allocation
+	char *m_ptr;                                        // First free byte in the cage
+	char *m_end;                                        // One past last byte of the cage made accessible so far
+	void *m_document;                                   // Document owning the pool, as xml_node, or 0
+	const char *m_text;                                 // Start of text of the last parse, written to the cage header when it is reserved
+	const char *m_text_end;                             // End of text of the last parse
+#else
 	char *m_begin;                                      // Start of raw memory making up current pool
 	char *m_ptr;                                        // First free byte in current pool
 	char *m_end;                                        // One past last available byte in current pool
+	char *m_free;                                       // Raw memory of the first block kept by clear(), or 0
+	std::size_t m_retained;                             // Total size of blocks kept by clear()
 	char m_static_memory[RAPIDXML_STATIC_POOL_SIZE];    // Static raw memory
+#endif
+	std::size_t m_retention;                            // Most memory clear() keeps, in bytes
+	std::size_t m_first_block;                          // Size of the first dynamic block
+	std::size_t m_growth;                               // Factor of growth of dynamic blocks
+	std::size_t m_largest_block;                        // Largest size of dynamic block reached by growth
+	std::size_t m_block_size;                           // Size of the next dynamic block
+	bool m_huge_pages;                                  // Whether large blocks are mapped for huge pages
 	alloc_func *m_alloc_func;                           // Allocator function, or 0 if default is to be used
 	free_func *m_free_func;                             // Free function, or 0 if default is to be used
+#if defined(XPROC_POOL_STATISTICS)
+	pool_statistics m_statistics;                       // Counts of allocations
+#endif
 };
 
 
@@ -0,0 +1,31 @@
+/*
+ * ParseError.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "ParseError.h"
+
+#if !defined(RAPIDXML_NO_EXCEPTIONS)
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+parse_error::parse_error(const char *what, void *where)
+: m_what(what)
+  , m_where(where)
+  {
+  }
+
+const char *parse_error::what() const throw()
+{
+	return m_what;
+}
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * ParseError.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_PARSEERROR_H_
+#define SRC_CORE_PARSEERROR_H_
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cassert>      // For assert
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// RAPIDXML_PARSE_ERROR
+
+#if defined(RAPIDXML_NO_EXCEPTIONS)
+
+#define RAPIDXML_PARSE_ERROR(what, where) { parse_error_handler(what, where); assert(0); }
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+//! When exceptions are disabled by defining RAPIDXML_NO_EXCEPTIONS,
+//! this function is called to notify user about the error.
+//! It must be defined by the user.
+//! <br><br>
+//! This function cannot return. If it does, the results are undefined.
+//! \param what Human readable description of the error.
+//! \param where Pointer to character data where error was detected.
+void parse_error_handler(const char *, void *);
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#else
+
+#include <exception>    // For std::exception
+
+#define RAPIDXML_PARSE_ERROR(what, where) throw parse_error(what, where)
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+//! Parse error exception.
+//! This exception is thrown by the parser when an error occurs.
+//! Use what() function to get human-readable error message.
+//! Use where() function to get a pointer to position within source text where error was detected.
+//! <br><br>
+//! If throwing exceptions by the parser is undesirable,
+//! it can be disabled by defining RAPIDXML_NO_EXCEPTIONS macro.
+//! This will cause the parser to call parse_error_handler() function instead of throwing an exception.
+//! This function must be defined by the user.
+class parse_error: public std::exception
+{
+public:
+
+	//! Constructs parse error
+	parse_error(const char *, void *);
+
+	//! Gets human readable description of error.
+	//! \return Pointer to null terminated description of the error.
+	virtual const char *what() const throw();
+
+	//! Gets pointer to character data where error happened.
+	//! ItemType should be the same as char type of xml_document that produced the error.
+	//! \return Pointer to location within the parsed string where error occured.
+	template<class ItemType>
+	ItemType *where() const
+	{
+		return reinterpret_cast<ItemType *>(m_where);
+	}
+
+private:
+
+	const char *m_what;
+	void *m_where;
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif
+
+#endif /* SRC_CORE_PARSEERROR_H_ */
@@ -0,0 +1,93 @@
+/*
+ * XmlAttribute.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlAttribute.h"
+
+#include "XmlDocument.h"
+#include "Internal/CoreAlgorithms.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<typename ItemType>
+xml_document<ItemType>* xml_attribute<ItemType>::document() const
+{
+	if (xml_node<ItemType>* node = this->parent())
+	{
+		while (node->parent())
+			node = node->parent();
+		return node->type() == node_document ? static_cast<xml_document<ItemType>*>(node) : 0;
+	}
+	else
+		return 0;
+}
+
+template<typename ItemType>
+xml_attribute<ItemType>* xml_attribute<ItemType>::previous_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		for (xml_attribute<ItemType>* attribute = m_prev_attribute; attribute; attribute = attribute->m_prev_attribute)
+			if (xinternal::compare(attribute->name(), attribute->name_size(), name, name_size, case_sensitive))
+				return attribute;
+		return 0;
+	}
+	else
+		return this->m_parent ? static_cast<xml_attribute<ItemType>*>(m_prev_attribute) : 0;
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_attribute<ItemType>* xml_attribute<ItemType>::previous_attribute(xcore::name_id id) const
+{
+	if (!this->m_parent)
+		return 0;
+	for (xml_attribute<ItemType>* attribute = m_prev_attribute; attribute; attribute = attribute->m_prev_attribute)
+		if (attribute->m_name_id == id)
+			return attribute;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_attribute<ItemType>* xml_attribute<ItemType>::next_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		for (xml_attribute<ItemType>* attribute = m_next_attribute; attribute; attribute = attribute->m_next_attribute)
+			if (xinternal::compare(attribute->name(), attribute->name_size(), name, name_size, case_sensitive))
+				return attribute;
+		return 0;
+	}
+	else
+		return this->m_parent ? static_cast<xml_attribute<ItemType>*>(m_next_attribute) : 0;
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_attribute<ItemType>* xml_attribute<ItemType>::next_attribute(xcore::name_id id) const
+{
+	if (!this->m_parent)
+		return 0;
+	for (xml_attribute<ItemType>* attribute = m_next_attribute; attribute; attribute = attribute->m_next_attribute)
+		if (attribute->m_name_id == id)
+			return attribute;
+	return 0;
+}
+#endif
+
+// Explicit instantiations
+template class xml_attribute<char>;
+
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,94 @@
+/*
+ * XmlAttribute.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLATTRIBUTE_H_
+#define SRC_CORE_XMLATTRIBUTE_H_
+
+#include "XmlBase.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<class ItemType> class xml_node;
+template<class ItemType> class xml_document;
+
+///////////////////////////////////////////////////////////////////////////
+// XML attribute
+
+//! Class representing attribute node of XML document.
+//! Each attribute has name and value strings, which are available through name() and value() functions (inherited from Xml_Base).
+//! Note that after parse, both name and value of attribute will point to interior of source text used for parsing.
+//! Thus, this text must persist in memory for the lifetime of attribute.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_attribute: public Xml_Base<ItemType>
+{
+	friend class xml_node<ItemType>;
+	friend class xml_document<ItemType>;
+
+public:
+
+	///////////////////////////////////////////////////////////////////////////
+	// Construction & destruction
+
+	//! Constructs an empty attribute with the specified type.
+	//! Consider using memory_pool of appropriate xml_document if allocating attributes manually.
+	xml_attribute(){}
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// Related nodes access
+
+	//! Gets document of which attribute is a child.
+	//! \return Pointer to document that contains this attribute, or 0 if there is no parent document.
+	xml_document<ItemType>* document() const;
+
+
+	//! Gets previous attribute, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return previous attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* previous_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets previous attribute with interned name.
+	//! \param id Identifier of name, see xml_node::first_node(xcore::name_id).
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* previous_attribute(xcore::name_id) const;
+#endif
+
+
+	//! Gets next attribute, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return next attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* next_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets next attribute with interned name.
+	//! \param id Identifier of name, see xml_node::first_node(xcore::name_id).
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* next_attribute(xcore::name_id) const;
+#endif
+
+
+private:
+
+	typename xinternal::link_ptr<xml_attribute<ItemType> >::type m_prev_attribute;   // Pointer to previous sibling of attribute, or 0 if none; only valid if parent is non-zero
+	typename xinternal::link_ptr<xml_attribute<ItemType> >::type m_next_attribute;   // Pointer to next sibling of attribute, or 0 if none; only valid if parent is non-zero
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLATTRIBUTE_H_ */
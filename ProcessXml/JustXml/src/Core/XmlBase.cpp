@@ -7,51 +7,15 @@
 
 #include "XmlBase.h"
 
-#include "internal/CoreAlgorithms.h"
+#include "MemoryPool.h"
+#include "XmlNode.h"
+#include "Internal/CoreAlgorithms.h"
 
 namespace xprocesser
 {
 namespace xcore
 {
 
-template<typename ItemType>
-Xml_Base<ItemType>::Xml_Base()
-: m_name(0)
-  , m_value(0)
-  , m_parent(0){}
-
-
-template<typename ItemType>
-ItemType* Xml_Base<ItemType>::name() const
-{
-	return m_name ? m_name : nullstr();
-}
-
-template<typename ItemType>
-std::size_t Xml_Base<ItemType>::name_size() const
-{
-	return m_name ? m_name_size : 0;
-}
-
-template<typename ItemType>
-ItemType* Xml_Base<ItemType>::value() const
-{
-	return m_value ? m_value : nullstr();
-}
-
-template<typename ItemType>
-std::size_t Xml_Base<ItemType>::value_size() const
-{
-	return m_value ? m_value_size : 0;
-}
-
-template<typename ItemType>
-void Xml_Base<ItemType>::name(const ItemType* name, std::size_t size)
-{
-	m_name = const_cast<ItemType*>(name);
-	m_name_size = size;
-}
-
 template<typename ItemType>
 void Xml_Base<ItemType>::name(const ItemType* name)
 {
@@ -59,31 +23,45 @@ void Xml_Base<ItemType>::name(const ItemType* name)
 }
 
 template<typename ItemType>
-void Xml_Base<ItemType>::value(const ItemType* value, std::size_t size)
+void Xml_Base<ItemType>::value(const ItemType* value)
 {
-	m_value = const_cast<ItemType*>(value);
-	m_value_size = size;
+	this->value(value, xinternal::measure(value));
 }
 
 template<typename ItemType>
-void Xml_Base<ItemType>::value(const ItemType* value)
+ItemType* Xml_Base<ItemType>::nullstr()
 {
-	this->value(value, xinternal::measure(value));
+	static ItemType zero = ItemType('\0');
+	return &zero;
 }
 
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
 template<typename ItemType>
-xml_node<ItemType>* Xml_Base<ItemType>::parent() const
+void Xml_Base<ItemType>::renamed()
 {
-	return m_parent;
+	// Attributes are not told from nodes here, so renaming an attribute sends index of children of its node out of date too
+	if (xinternal::child_index<ItemType>* index = m_parent->children_index())
+		index->invalidate();
 }
+#endif
 
+#if defined(XPROC_COMPACT_NODES)
 template<typename ItemType>
-ItemType* Xml_Base<ItemType>::nullstr()
+ItemType* Xml_Base<ItemType>::copy_to_cage(const ItemType* string, std::size_t size)
 {
-	static ItemType zero = ItemType('\0');
-	return &zero;
+	// Strings of the user, and in the input window of xml_reader, are copied; a terminator is added as parser would place it
+	assert(size < xinternal::cage_size);
+	memory_pool<ItemType>* pool = static_cast<memory_pool<ItemType>*>(reinterpret_cast<xinternal::cage_header*>(xinternal::cage_of(this))->pool);
+	ItemType* copy = pool->allocate_string(0, size + 1);
+	for (std::size_t i = 0; i < size; ++i)
+		copy[i] = string[i];
+	copy[size] = ItemType('\0');
+	return copy;
 }
+#endif
 
+// Explicit instantiations
+template class Xml_Base<char>;
 
 } /* namespace xcore */
 } /* namespace xprocesser */
@@ -13,17 +13,70 @@
 #include <cstdlib>      // For std::size_t
 #endif
 
+#include "Internal/CompactLayout.h"
+#include "Internal/ChildIndex.h"
+
 namespace xprocesser
 {
 namespace xcore
 {
 
 template<class ItemType> class xml_node;
+
+///////////////////////////////////////////////////////////////////////////
+// Name identifier
+
+// Define XPROC_INTERN_NAMES to have xflags::parse_intern_names give elements and attributes identifiers of their names,
+// which xml_node::first_node(name_id) and similar functions compare instead of names.
+// Each node and attribute then holds its identifier, and the document a symbol table;
+// without the macro, those functions and xml_document::intern_name() are not available, and xflags::parse_intern_names is ignored.
+// The macro must be defined the same way for every translation unit.
+
+//! Identifier of an element or attribute name in the symbol table of a document.
+//! Identifiers are issued by xml_document::intern_name(), and given to nodes and attributes
+//! parsed with xflags::parse_intern_names.
+//! Default constructed identifier stands for no name; it is carried by all other nodes and attributes.
+class name_id
+{
+public:
+
+	//! Constructs identifier of no name
+	name_id()
+	: m_value(0){}
+
+	//! Constructs identifier with given number
+	//! \param value Number of identifier, or 0 for no name.
+	explicit name_id(unsigned value)
+	: m_value(value){}
+
+	//! Gets number of identifier.
+	//! \return Number of identifier, or 0 if it stands for no name.
+	unsigned value() const
+	{
+		return m_value;
+	}
+
+	bool operator==(name_id other) const
+	{
+		return m_value == other.m_value;
+	}
+
+	bool operator!=(name_id other) const
+	{
+		return m_value != other.m_value;
+	}
+
+private:
+
+	unsigned m_value;                   // Number of identifier, or 0 for no name
+};
 ///////////////////////////////////////////////////////////////////////////
 // XML base
 
 //! Base class for xml_node and xml_attribute implementing common functions:
 //! name(), name_size(), value(), value_size() and parent().
+//! Nodes and attributes live in the memory pool of their document and are never destroyed one by one,
+//! so the class has no virtual destructor and its objects carry no pointer to a virtual table.
 //! \param ItemType Character type to use
 template<class ItemType = char>
 class Xml_Base
@@ -34,8 +87,10 @@ public:
 	// Construction & destruction
 
 	// Construct a base with empty name, value and parent
-	explicit Xml_Base();
-	virtual ~Xml_Base(){};
+	explicit Xml_Base()
+	: m_name(0)
+	  , m_value(0)
+	  , m_parent(0){}
 
 
 	///////////////////////////////////////////////////////////////////////////
@@ -47,13 +102,19 @@ public:
 	//! <br><br>
 	//! Use name_size() function to determine length of the name.
 	//! \return Name of node, or empty string if node has no name.
-	ItemType* name() const;
+	ItemType* name() const
+	{
+		return m_name ? m_name : nullstr();
+	}
 
 
 	//! Gets size of node name, not including terminator character.
 	//! This function works correctly irrespective of whether name is or is not zero terminated.
 	//! \return Size of node name, in characters.
-	std::size_t name_size() const;
+	std::size_t name_size() const
+	{
+		return m_name ? m_name_size : 0;
+	}
 
 
 	//! Gets value of node.
@@ -62,13 +123,19 @@ public:
 	//! <br><br>
 	//! Use value_size() function to determine length of the value.
 	//! \return Value of node, or empty string if node has no value.
-	ItemType* value() const;
+	ItemType* value() const
+	{
+		return m_value ? m_value : nullstr();
+	}
 
 
 	//! Gets size of node value, not including terminator character.
 	//! This function works correctly irrespective of whether value is or is not zero terminated.
 	//! \return Size of node value, in characters.
-	std::size_t value_size() const;
+	std::size_t value_size() const
+	{
+		return m_value ? m_value_size : 0;
+	}
 
 
 	///////////////////////////////////////////////////////////////////////////
@@ -85,9 +152,22 @@ public:
 	//! <br><br>
 	//! Size of name must be specified separately, because name does not have to be zero terminated.
 	//! Use name(const ItemType *) function to have the length automatically calculated (string must be zero terminated).
+	//! <br><br>
+	//! Index of children of the parent, if one was built (see xml_node::first_node()), goes out of date.
 	//! \param name Name of node to set. Does not have to be zero terminated.
 	//! \param size Size of name, in characters. This does not include zero terminator, if one is present.
-	void name(const ItemType *, std::size_t);
+	void name(const ItemType *name, std::size_t size)
+	{
+		m_name = in_cage(name, size);
+		m_name_size = static_cast<xinternal::size_field>(size);
+#if defined(XPROC_INTERN_NAMES)
+		m_name_id = xcore::name_id();
+#endif
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+		if (m_parent)
+			renamed();
+#endif
+	}
 
 
 	//! Sets name of node to a zero-terminated string.
@@ -112,7 +192,11 @@ public:
 	//! If you want to manipulate data of elements using values, use parser flag rapidxml::parse_no_data_nodes to prevent creation of data nodes by the parser.
 	//! \param value value of node to set. Does not have to be zero terminated.
 	//! \param size Size of value, in characters. This does not include zero terminator, if one is present.
-	void value(const ItemType *, std::size_t);
+	void value(const ItemType *value, std::size_t size)
+	{
+		m_value = in_cage(value, size);
+		m_value_size = static_cast<xinternal::size_field>(size);
+	}
 
 
 	//! Sets value of node to a zero-terminated string.
@@ -126,18 +210,59 @@ public:
 
 	//! Gets node parent.
 	//! \return Pointer to parent node, or 0 if there is no parent.
-	xml_node<ItemType>* parent() const;
+	xml_node<ItemType>* parent() const
+	{
+		return m_parent;
+	}
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets identifier of name interned by xflags::parse_intern_names.
+	//! Setting name of node removes its identifier.
+	//! \return Identifier of name, or identifier of no name if name was not interned.
+	xcore::name_id name_id() const
+	{
+		return m_name_id;
+	}
+#endif
 
 
 protected:
 	// Return empty string
 	static ItemType* nullstr();
 
-	ItemType* m_name;                   // Name of node, or 0 if no name
-	ItemType* m_value;                  // Value of node, or 0 if no value
-	std::size_t m_name_size;            // Length of node name, or undefined of no name
-	std::size_t m_value_size;           // Length of node value, or undefined if no value
-	xml_node<ItemType>* m_parent;       // Pointer to parent node, or 0 if none
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+	// Send index of children of the parent out of date after the name changed
+	void renamed();
+#endif
+
+#if defined(XPROC_COMPACT_NODES)
+	// Return string if it lies in the cage of this object or in the text parsed into it, or its copy allocated from the pool of the cage otherwise
+	ItemType* in_cage(const ItemType* string, std::size_t size)
+	{
+		if (!string || xinternal::cage_of(string) == xinternal::cage_of(this) || m_name.in_text(string))
+			return const_cast<ItemType*>(string);
+		return copy_to_cage(string, size);
+	}
+
+	// Return copy of string allocated from the pool of the cage of this object
+	ItemType* copy_to_cage(const ItemType*, std::size_t);
+#else
+	// Return string, which is used where it is
+	static ItemType* in_cage(const ItemType* string, std::size_t)
+	{
+		return const_cast<ItemType*>(string);
+	}
+#endif
+
+	typename xinternal::string_ptr<ItemType>::type m_name;              // Name of node, or 0 if no name
+	typename xinternal::string_ptr<ItemType>::type m_value;             // Value of node, or 0 if no value
+	xinternal::size_field m_name_size;                                  // Length of node name, or undefined of no name
+	xinternal::size_field m_value_size;                                 // Length of node value, or undefined if no value
+	typename xinternal::link_ptr<xml_node<ItemType> >::type m_parent;   // Pointer to parent node, or 0 if none
+#if defined(XPROC_INTERN_NAMES)
+	xcore::name_id m_name_id;           // Identifier of interned name; default constructed if name is not interned
+#endif
 };
 
 } /* namespace xcore */
@@ -0,0 +1,573 @@
+/*
+ * XmlBinder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlBinder.h"
+
+#include "Internal/CoreAlgorithms.h"
+#include "Internal/LookupTables.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <climits>      // For INT_MAX, UINT_MAX, LONG_MAX, ULONG_MAX
+#include <clocale>      // For std::localeconv
+#include <cstdlib>      // For std::strtod
+#include <cstring>      // For std::memcpy, std::strlen
+#include <limits>       // For std::numeric_limits
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+namespace xinternal
+{
+
+// Flags of scanning functions for flags of binder: nothing is placed in the text but expanded values
+template<int Flags>
+struct bind_flags
+{
+	static const int value = (Flags & (parse_no_entity_translation | parse_no_utf8 | parse_trim_whitespace |
+			parse_normalize_whitespace | parse_validate_closing_tags)) | parse_no_string_terminators;
+};
+
+// Remove whitespace around value
+template<class ItemType>
+inline void trim_value(const ItemType*& value, const ItemType*& end)
+{
+	while (value != end && lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*value)])
+		++value;
+	while (end != value && lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*(end - 1))])
+		--end;
+}
+
+// Convert decimal digits, with optional sign, to magnitude not greater than limit for its sign
+template<class Unsigned, class ItemType>
+inline Unsigned convert_digits(const ItemType* value, std::size_t size, Unsigned limit, Unsigned negative_limit, bool& negative)
+{
+	const ItemType* end = value + size;
+	trim_value(value, end);
+	negative = value != end && *value == ItemType('-');
+	if (value != end && (*value == ItemType('-') || *value == ItemType('+')))
+		++value;
+	if (value == end)
+		RAPIDXML_PARSE_ERROR("invalid number", const_cast<ItemType*>(value));
+	if (negative)
+		limit = negative_limit;
+	Unsigned magnitude = 0;
+	for (; value != end; ++value)
+	{
+		if (*value < ItemType('0') || *value > ItemType('9'))
+			RAPIDXML_PARSE_ERROR("invalid number", const_cast<ItemType*>(value));
+		Unsigned digit = static_cast<Unsigned>(*value - ItemType('0'));
+		if (magnitude > limit / 10 || (magnitude == limit / 10 && digit > limit % 10))
+			RAPIDXML_PARSE_ERROR("number out of range", const_cast<ItemType*>(value));
+		magnitude = magnitude * 10 + digit;
+	}
+	return magnitude;
+}
+
+// Convert to signed integer
+template<class Signed, class Unsigned, class ItemType>
+inline Signed convert_signed(const ItemType* value, std::size_t size, Unsigned max)
+{
+	bool negative;
+	Unsigned magnitude = convert_digits<Unsigned>(value, size, max, max + 1, negative);
+	if (negative && magnitude)
+		return -static_cast<Signed>(magnitude - 1) - 1;
+	return static_cast<Signed>(magnitude);
+}
+
+// Convert to unsigned integer; -0 is allowed, as in XML Schema
+template<class Unsigned, class ItemType>
+inline Unsigned convert_unsigned(const ItemType* value, std::size_t size, Unsigned max)
+{
+	bool negative;
+	return convert_digits<Unsigned>(value, size, max, Unsigned(0), negative);
+}
+
+// Check that value from begin to end is given string of ASCII characters
+template<class ItemType>
+inline bool is_word(const ItemType* begin, const ItemType* end, const char* word)
+{
+	for (; begin != end && *word; ++begin, ++word)
+		if (*begin != ItemType(*word))
+			return false;
+	return begin == end && !*word;
+}
+
+// Skip decimal digits, and return their number
+template<class ItemType>
+inline std::size_t skip_digits(const ItemType*& value, const ItemType* end)
+{
+	const ItemType* start = value;
+	while (value != end && *value >= ItemType('0') && *value <= ItemType('9'))
+		++value;
+	return value - start;
+}
+
+// Convert to double from the lexical form of xs:double: optional sign, digits with optional decimal point,
+// optional exponent, or one of INF, +INF, -INF and NaN.
+// Form is checked here, so strtod never takes hexadecimal numbers or its own spellings of infinity and NaN,
+// and it is given the decimal point of the current locale, so that the result does not depend on the locale.
+template<class ItemType>
+inline double convert_floating(const ItemType* value, std::size_t size)
+{
+	const ItemType* end = value + size;
+	trim_value(value, end);
+	if (is_word(value, end, "INF") || is_word(value, end, "+INF"))
+		return std::numeric_limits<double>::infinity();
+	if (is_word(value, end, "-INF"))
+		return -std::numeric_limits<double>::infinity();
+	if (is_word(value, end, "NaN"))
+		return std::numeric_limits<double>::quiet_NaN();
+
+	const ItemType* text = value;
+	if (text != end && (*text == ItemType('-') || *text == ItemType('+')))
+		++text;
+	std::size_t digits = skip_digits(text, end);
+	const ItemType* point = 0;
+	if (text != end && *text == ItemType('.'))
+	{
+		point = text++;
+		digits += skip_digits(text, end);
+	}
+	if (!digits)
+		RAPIDXML_PARSE_ERROR("invalid number", const_cast<ItemType*>(text));
+	if (text != end && (*text == ItemType('e') || *text == ItemType('E')))
+	{
+		++text;
+		if (text != end && (*text == ItemType('-') || *text == ItemType('+')))
+			++text;
+		if (!skip_digits(text, end))
+			RAPIDXML_PARSE_ERROR("invalid number", const_cast<ItemType*>(text));
+	}
+	if (text != end)
+		RAPIDXML_PARSE_ERROR("invalid number", const_cast<ItemType*>(text));
+
+	// Zero-terminated copy for strtod, with the decimal point of the locale
+	const char* decimal_point = std::localeconv()->decimal_point;
+	std::size_t point_size = std::strlen(decimal_point);
+	std::size_t length = end - value;
+	char buffer[64];
+	char* copy = length + point_size < sizeof(buffer) ? buffer : new char[length + point_size + 1];
+	char* out = copy;
+	for (const ItemType* in = value; in != end; ++in)
+	{
+		if (in == point)
+		{
+			std::memcpy(out, decimal_point, point_size);
+			out += point_size;
+		}
+		else
+			*out++ = static_cast<char>(*in);
+	}
+	*out = '\0';
+	double result = std::strtod(copy, 0);
+	if (copy != buffer)
+		delete[] copy;
+	return result;
+}
+
+} /* namespace xinternal */
+
+///////////////////////////////////////////////////////////////////////
+// XML binder
+
+template<typename ItemType>
+xml_binder<ItemType>::xml_binder()
+: m_text(0)
+  , m_tag(0)
+  , m_tag_size(0)
+  , m_attributes(false)
+  , m_name(0)
+  , m_name_size(0)
+  , m_value(0)
+  , m_value_size(0)
+  , m_frames(new frame[16])
+  , m_depth(0)
+  , m_capacity(16)
+{
+}
+
+template<typename ItemType>
+xml_binder<ItemType>::~xml_binder()
+{
+	delete[] m_frames;
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_binder<ItemType>::begin(ItemType* text)
+{
+	assert(text);
+	const int BindFlags = xinternal::bind_flags<Flags>::value;
+	m_depth = 0;
+	m_attributes = false;
+	m_value = 0;
+	m_value_size = 0;
+
+	// Skip UTF-8 BOM
+	if (static_cast<unsigned char>(text[0]) == 0xEF &&
+			static_cast<unsigned char>(text[1]) == 0xBB &&
+			static_cast<unsigned char>(text[2]) == 0xBF)
+		text += 3;
+
+	// Skip declaration, PIs, comments and DOCTYPE before root element
+	while (1)
+	{
+		while (xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+			++text;
+		if (*text != ItemType('<'))
+			RAPIDXML_PARSE_ERROR(*text ? "expected <" : "expected root element", text);
+		++text;     // Skip '<'
+		if (*text != ItemType('?') && *text != ItemType('!'))
+			break;
+		m_document.template skip_node<BindFlags>(text);
+	}
+
+	// Root element is current
+	m_tag = text;
+	m_name = text;
+	m_name_size = m_document.template scan_element_name<BindFlags>(text);
+	m_tag_size = m_name_size;
+	m_text = text;
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_binder<ItemType>::next_attribute()
+{
+	if (!m_tag)
+		return false;
+	if (!m_document.template scan_attribute<xinternal::bind_flags<Flags>::value>(m_text, m_name, m_name_size, m_value, m_value_size))
+		return false;
+	m_attributes = true;
+	return true;
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_binder<ItemType>::enter()
+{
+	assert(m_tag);
+	ItemType* name = m_tag;
+	bool contents = finish_start_tag<Flags>();
+
+	// Empty element has empty value
+	if (!contents)
+	{
+		m_value = m_text;
+		m_value_size = 0;
+		return false;
+	}
+
+	push(name, m_tag_size);
+	return true;
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_binder<ItemType>::next_element()
+{
+	assert(m_depth && !m_tag);
+	const int BindFlags = xinternal::bind_flags<Flags>::value;
+	frame& element = m_frames[m_depth - 1];
+	ItemType* text = m_text;
+	while (1)
+	{
+		// Skip whitespace before node
+		ItemType* contents_start = text;
+		while (xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+			++text;
+		if (*text == ItemType('\0'))
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		// Text; the first one is value of the element
+		if (*text != ItemType('<'))
+		{
+			ItemType* value;
+			ItemType* end = m_document.template scan_data<BindFlags>(text, contents_start, value);
+			if (!element.value)
+			{
+				element.value = value;
+				element.value_size = end - value;
+			}
+			continue;
+		}
+		++text;     // Skip '<'
+
+		// Closing tag leaves the element; element without text has empty value
+		if (*text == ItemType('/'))
+		{
+			++text;     // Skip '/'
+			m_document.template scan_closing_tag<BindFlags>(text, element.name, element.name_size);
+			m_text = text;
+			m_value = element.value ? element.value : text;
+			m_value_size = element.value_size;
+			--m_depth;
+			return false;
+		}
+
+		// PI, comment, CDATA or DOCTYPE
+		if (*text == ItemType('?') || *text == ItemType('!'))
+		{
+			m_document.template skip_node<BindFlags>(text);
+			continue;
+		}
+
+		// Child element is current
+		m_tag = text;
+		m_name = text;
+		m_name_size = m_document.template scan_element_name<BindFlags>(text);
+		m_tag_size = m_name_size;
+		m_attributes = false;
+		m_text = text;
+		return true;
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_binder<ItemType>::read_value()
+{
+	assert(m_tag);
+	const int BindFlags = xinternal::bind_flags<Flags>::value;
+	ItemType* name = m_tag;
+	std::size_t name_size = m_tag_size;
+	if (!finish_start_tag<Flags>())
+	{
+		m_value = m_text;
+		m_value_size = 0;
+		return;
+	}
+
+	// Value is usually the only text before the closing tag, which is then read without entering the element
+	ItemType* text = m_text;
+	ItemType* contents_start = text;
+	while (xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+		++text;
+	ItemType* value = 0;
+	std::size_t value_size = 0;
+	if (*text != ItemType('<') && *text != ItemType('\0'))
+	{
+		ItemType* end = m_document.template scan_data<BindFlags>(text, contents_start, value);
+		value_size = end - value;
+	}
+	if (text[0] == ItemType('<') && text[1] == ItemType('/'))
+	{
+		text += 2;      // Skip '</'
+		m_document.template scan_closing_tag<BindFlags>(text, name, name_size);
+		m_text = text;
+		m_value = value ? value : text;
+		m_value_size = value_size;
+		return;
+	}
+
+	// Otherwise the element is entered, and its child elements are skipped
+	m_text = text;
+	frame& element = push(name, name_size);
+	element.value = value;
+	element.value_size = value_size;
+	while (next_element<Flags>())
+		skip<Flags>();
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_binder<ItemType>::skip()
+{
+	assert(m_tag);
+	ItemType* name = m_tag;
+	if (finish_start_tag<Flags>())
+		m_document.template skip_contents<xinternal::bind_flags<Flags>::value>(m_text, name, m_tag_size);
+}
+
+template<typename ItemType>
+void xml_binder<ItemType>::error(const char* what) const
+{
+	RAPIDXML_PARSE_ERROR(what, m_text);
+}
+
+template<typename ItemType>
+typename xml_binder<ItemType>::frame& xml_binder<ItemType>::push(ItemType* name, std::size_t name_size)
+{
+	xinternal::grow_array(m_frames, m_depth, m_capacity, m_depth + 1, 16);
+	frame& element = m_frames[m_depth++];
+	element.name = name;
+	element.name_size = name_size;
+	element.value = 0;
+	element.value_size = 0;
+	return element;
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_binder<ItemType>::finish_start_tag()
+{
+	const int BindFlags = xinternal::bind_flags<Flags>::value;
+	bool contents;
+	if (m_attributes)
+	{
+		// Rest of attributes, which are checked and expanded as the ones read
+		ItemType* name, *value;
+		std::size_t name_size, value_size;
+		while (m_document.template scan_attribute<BindFlags>(m_text, name, name_size, value, value_size))
+			;
+		contents = m_document.template scan_tag_end<BindFlags>(m_text);
+	}
+	else
+	{
+		// No attribute was read, so none is expanded
+		contents = m_document.template skip_attributes<BindFlags>(m_text);
+	}
+	m_tag = 0;
+	return contents;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Value conversion
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, int& result)
+{
+	result = xinternal::convert_signed<int>(value, size, static_cast<unsigned>(INT_MAX));
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, unsigned& result)
+{
+	result = xinternal::convert_unsigned(value, size, static_cast<unsigned>(UINT_MAX));
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, long& result)
+{
+	result = xinternal::convert_signed<long>(value, size, static_cast<unsigned long>(LONG_MAX));
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, unsigned long& result)
+{
+	result = xinternal::convert_unsigned(value, size, static_cast<unsigned long>(ULONG_MAX));
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, double& result)
+{
+	result = xinternal::convert_floating(value, size);
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, float& result)
+{
+	result = static_cast<float>(xinternal::convert_floating(value, size));
+}
+
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, bool& result)
+{
+	const ItemType* end = value + size;
+	xinternal::trim_value(value, end);
+	static const ItemType true_text[] = { ItemType('t'), ItemType('r'), ItemType('u'), ItemType('e') };
+	static const ItemType false_text[] = { ItemType('f'), ItemType('a'), ItemType('l'), ItemType('s'), ItemType('e') };
+	std::size_t length = end - value;
+	if ((length == 1 && *value == ItemType('1')) || xinternal::compare(value, length, true_text, 4, true))
+		result = true;
+	else if ((length == 1 && *value == ItemType('0')) || xinternal::compare(value, length, false_text, 5, true))
+		result = false;
+	else
+		RAPIDXML_PARSE_ERROR("invalid truth value", const_cast<ItemType*>(value));
+}
+
+#if !defined(XPROC_NO_STDLIB)
+template<class ItemType>
+void convert_value(const ItemType* value, std::size_t size, std::basic_string<ItemType>& result)
+{
+	result.assign(value, size);
+}
+#endif
+
+// Explicit instantiations
+template class xml_binder<char>;
+
+template void xml_binder<char>::begin<parse_default>(char*);
+template void xml_binder<char>::begin<parse_non_destructive>(char*);
+template void xml_binder<char>::begin<parse_fastest>(char*);
+template void xml_binder<char>::begin<parse_full>(char*);
+template void xml_binder<char>::begin<parse_no_data_nodes>(char*);
+template void xml_binder<char>::begin<parse_trim_whitespace>(char*);
+template void xml_binder<char>::begin<parse_trim_whitespace | parse_normalize_whitespace>(char*);
+template void xml_binder<char>::begin<parse_validate_closing_tags>(char*);
+template void xml_binder<char>::begin<parse_comment_nodes>(char*);
+template void xml_binder<char>::begin<parse_declaration_node>(char*);
+template bool xml_binder<char>::next_attribute<parse_default>();
+template bool xml_binder<char>::next_attribute<parse_non_destructive>();
+template bool xml_binder<char>::next_attribute<parse_fastest>();
+template bool xml_binder<char>::next_attribute<parse_full>();
+template bool xml_binder<char>::next_attribute<parse_no_data_nodes>();
+template bool xml_binder<char>::next_attribute<parse_trim_whitespace>();
+template bool xml_binder<char>::next_attribute<parse_trim_whitespace | parse_normalize_whitespace>();
+template bool xml_binder<char>::next_attribute<parse_validate_closing_tags>();
+template bool xml_binder<char>::next_attribute<parse_comment_nodes>();
+template bool xml_binder<char>::next_attribute<parse_declaration_node>();
+template bool xml_binder<char>::enter<parse_default>();
+template bool xml_binder<char>::enter<parse_non_destructive>();
+template bool xml_binder<char>::enter<parse_fastest>();
+template bool xml_binder<char>::enter<parse_full>();
+template bool xml_binder<char>::enter<parse_no_data_nodes>();
+template bool xml_binder<char>::enter<parse_trim_whitespace>();
+template bool xml_binder<char>::enter<parse_trim_whitespace | parse_normalize_whitespace>();
+template bool xml_binder<char>::enter<parse_validate_closing_tags>();
+template bool xml_binder<char>::enter<parse_comment_nodes>();
+template bool xml_binder<char>::enter<parse_declaration_node>();
+template bool xml_binder<char>::next_element<parse_default>();
+template bool xml_binder<char>::next_element<parse_non_destructive>();
+template bool xml_binder<char>::next_element<parse_fastest>();
+template bool xml_binder<char>::next_element<parse_full>();
+template bool xml_binder<char>::next_element<parse_no_data_nodes>();
+template bool xml_binder<char>::next_element<parse_trim_whitespace>();
+template bool xml_binder<char>::next_element<parse_trim_whitespace | parse_normalize_whitespace>();
+template bool xml_binder<char>::next_element<parse_validate_closing_tags>();
+template bool xml_binder<char>::next_element<parse_comment_nodes>();
+template bool xml_binder<char>::next_element<parse_declaration_node>();
+template void xml_binder<char>::read_value<parse_default>();
+template void xml_binder<char>::read_value<parse_non_destructive>();
+template void xml_binder<char>::read_value<parse_fastest>();
+template void xml_binder<char>::read_value<parse_full>();
+template void xml_binder<char>::read_value<parse_no_data_nodes>();
+template void xml_binder<char>::read_value<parse_trim_whitespace>();
+template void xml_binder<char>::read_value<parse_trim_whitespace | parse_normalize_whitespace>();
+template void xml_binder<char>::read_value<parse_validate_closing_tags>();
+template void xml_binder<char>::read_value<parse_comment_nodes>();
+template void xml_binder<char>::read_value<parse_declaration_node>();
+template void xml_binder<char>::skip<parse_default>();
+template void xml_binder<char>::skip<parse_non_destructive>();
+template void xml_binder<char>::skip<parse_fastest>();
+template void xml_binder<char>::skip<parse_full>();
+template void xml_binder<char>::skip<parse_no_data_nodes>();
+template void xml_binder<char>::skip<parse_trim_whitespace>();
+template void xml_binder<char>::skip<parse_trim_whitespace | parse_normalize_whitespace>();
+template void xml_binder<char>::skip<parse_validate_closing_tags>();
+template void xml_binder<char>::skip<parse_comment_nodes>();
+template void xml_binder<char>::skip<parse_declaration_node>();
+
+template void convert_value<char>(const char*, std::size_t, int&);
+template void convert_value<char>(const char*, std::size_t, unsigned&);
+template void convert_value<char>(const char*, std::size_t, long&);
+template void convert_value<char>(const char*, std::size_t, unsigned long&);
+template void convert_value<char>(const char*, std::size_t, double&);
+template void convert_value<char>(const char*, std::size_t, float&);
+template void convert_value<char>(const char*, std::size_t, bool&);
+#if !defined(XPROC_NO_STDLIB)
+template void convert_value<char>(const char*, std::size_t, std::basic_string<char>&);
+#endif
+
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,202 @@
+/*
+ * XmlBinder.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLBINDER_H_
+#define SRC_CORE_XMLBINDER_H_
+
+#include "XmlDocument.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <string>       // For std::basic_string
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+///////////////////////////////////////////////////////////////////////////
+// XML binder
+
+//! This class walks XML text element by element, in one pass and without building a DOM tree,
+//! for code which binds elements and attributes directly to members of C++ structures.
+//! Such code is written by xml_binding_generator from a schema, and calls the binder like this:
+//! <pre>
+//! binder.begin<Flags>(text);                  // Root element is current
+//! while (binder.next_attribute<Flags>())      // Attributes of current element, by name() and value()
+//!     ...
+//! if (binder.enter<Flags>())                  // Contents of current element, unless it is empty
+//!     while (binder.next_element<Flags>())    // Each child element becomes current
+//!         if (binder.name_is("item", 4))
+//!             ...                             // Recursively, or read_value<Flags>() or skip<Flags>()
+//! </pre>
+//! Names and values point into the text and are not zero-terminated; they are valid until the next call.
+//! Elements skipped are not expanded, and no node is created and no memory is allocated.
+//! Text after the root element is not read.
+//! <br><br>
+//! Member templates are defined in XmlBinder.cpp, so only the Flags combinations
+//! explicitly instantiated at the bottom of that file are available to the linker.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_binder
+{
+public:
+
+	//! Constructs binder
+	xml_binder();
+
+	//! Destroys binder
+	~xml_binder();
+
+
+	//! Starts reading zero-terminated XML string according to given flags; root element becomes current.
+	//! Passed string will be modified, as by xml_document::parse(), unless xflags::parse_non_destructive flag is used.
+	//! Flags other than xflags::parse_no_entity_translation, xflags::parse_no_utf8, xflags::parse_trim_whitespace,
+	//! xflags::parse_normalize_whitespace and xflags::parse_validate_closing_tags have no effect.
+	//! In case of error, here or in any following call, parse_error exception will be thrown.
+	//! \param text XML data to read; pointer is non-const to denote fact that this data may be modified.
+	template<int Flags>
+	void begin(ItemType*);
+
+	//! Reads next attribute of current element, if its start tag was not entered yet.
+	//! Attribute name is then available from name(), and its value from value().
+	//! \return True if attribute was read, false if start tag has no more attributes.
+	template<int Flags>
+	bool next_attribute();
+
+	//! Reads rest of start tag of current element, and enters its contents unless it is an empty element.
+	//! Contents entered must be read with next_element() until it returns false.
+	//! \return True if contents were entered.
+	template<int Flags>
+	bool enter();
+
+	//! Reads contents of the innermost element entered up to the start tag of its next child element, which becomes current.
+	//! When closing tag of the element is reached instead, the element is left, and its value is available from value().
+	//! \return True if child element was found, false if the element was left.
+	template<int Flags>
+	bool next_element();
+
+	//! Reads current element, from wherever in its start tag the binder is, up to its closing tag;
+	//! its value is then available from value().
+	template<int Flags>
+	void read_value();
+
+	//! Skips current element, from wherever in its start tag the binder is, up to its closing tag.
+	template<int Flags>
+	void skip();
+
+
+	//! Gets name of current element, or of the last attribute read.
+	//! \return Pointer to name, which is not zero-terminated.
+	const ItemType* name() const
+	{
+		return m_name;
+	}
+
+	//! Gets size of name of current element, or of the last attribute read.
+	//! \return Size of name, in characters.
+	std::size_t name_size() const
+	{
+		return m_name_size;
+	}
+
+	//! Compares name of current element, or of the last attribute read, with given name.
+	//! \param name Name to compare with; this string doesn't have to be zero-terminated.
+	//! \param size Size of name, in characters.
+	//! \return True if names are equal, case-sensitively.
+	bool name_is(const ItemType* name, std::size_t size) const
+	{
+		if (size != m_name_size)
+			return false;
+		for (std::size_t i = 0; i < size; ++i)
+			if (name[i] != m_name[i])
+				return false;
+		return true;
+	}
+
+	//! Gets value of the last attribute read, or of the last element left or read.
+	//! Value of an element is its first data node, as xml_node::value() after parse(), or empty if the element has none.
+	//! \return Pointer to value, which is not zero-terminated.
+	ItemType* value() const
+	{
+		return m_value;
+	}
+
+	//! Gets size of value of the last attribute read, or of the last element left or read.
+	//! \return Size of value, in characters.
+	std::size_t value_size() const
+	{
+		return m_value_size;
+	}
+
+	//! Reports error at the current position, for example a required element missing in the element just left.
+	//! \param what Human readable description of the error; must be a string literal, or otherwise outlive the exception.
+	void error(const char*) const;
+
+private:
+
+	// Element entered, whose closing tag ends next_element()
+	struct frame
+	{
+		ItemType* name;
+		std::size_t name_size;
+		ItemType* value;            // First data in contents, or 0 if none yet
+		std::size_t value_size;
+	};
+
+	// Restrictive copy constructor and assignment operator
+	xml_binder(const xml_binder&);
+	void operator=(const xml_binder&);
+
+	// Enter element of given name, with no value found yet
+	frame& push(ItemType*, std::size_t);
+
+	// Read rest of start tag of current element; return true if contents follow
+	template<int Flags>
+	bool finish_start_tag();
+
+	xml_document<ItemType> m_document;         // Scanning functions, which create no nodes
+	ItemType* m_text;                           // Current position
+	ItemType* m_tag;                            // Name of current element, while in its start tag
+	std::size_t m_tag_size;
+	bool m_attributes;                          // Whether attributes of current element were read
+	ItemType* m_name;
+	std::size_t m_name_size;
+	ItemType* m_value;
+	std::size_t m_value_size;
+	frame* m_frames;                            // Elements entered, innermost last
+	std::size_t m_depth;                        // Number of elements entered
+	std::size_t m_capacity;                     // Frames allocated in m_frames
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Value conversion
+
+//! Converts value read by xml_binder, or any other text, to a number, truth value or string.
+//! Whitespace around numbers and truth values is ignored; truth values are true, false, 1 and 0, as in XML Schema.
+//! Floating point numbers take the lexical form of xs:double, with <code>.</code> as decimal point whatever the locale,
+//! and INF, -INF and NaN for the special values; hexadecimal numbers and other spellings are rejected.
+//! In case of error, parse_error exception will be thrown, pointing into the value.
+//! \param value Text to convert; this string doesn't have to be zero-terminated.
+//! \param size Size of text, in characters.
+//! \param result Converted value.
+template<class ItemType> void convert_value(const ItemType*, std::size_t, int&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, unsigned&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, long&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, unsigned long&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, double&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, float&);
+template<class ItemType> void convert_value(const ItemType*, std::size_t, bool&);
+#if !defined(XPROC_NO_STDLIB)
+template<class ItemType> void convert_value(const ItemType*, std::size_t, std::basic_string<ItemType>&);
+#endif
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLBINDER_H_ */
@@ -0,0 +1,510 @@
+/*
+ * XmlBindingGenerator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlBindingGenerator.h"
+
+// Code generation needs the standard library
+#if !defined(XPROC_NO_STDLIB)
+#include "XmlBinder.h"
+#include "Internal/CoreAlgorithms.h"
+
+#include <cstdio>       // For std::sprintf
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+namespace xinternal
+{
+
+// Simple types of the schema and their C++ types
+static const char* const simple_types[][2] =
+{
+	{ "string", "std::string" },
+	{ "int", "int" },
+	{ "unsigned", "unsigned" },
+	{ "long", "long" },
+	{ "unsigned long", "unsigned long" },
+	{ "double", "double" },
+	{ "float", "float" },
+	{ "bool", "bool" }
+};
+
+// C++ type of simple type of the schema, or 0 if type is not simple
+inline const char* simple_type(const char* type)
+{
+	for (std::size_t i = 0; i < sizeof(simple_types) / sizeof(simple_types[0]); ++i)
+		if (std::string(type) == simple_types[i][0])
+			return simple_types[i][1];
+	return 0;
+}
+
+// Check that text is a C++ identifier
+inline bool is_identifier(const char* text)
+{
+	if (!((*text >= 'a' && *text <= 'z') || (*text >= 'A' && *text <= 'Z') || *text == '_'))
+		return false;
+	for (++text; *text; ++text)
+		if (!((*text >= 'a' && *text <= 'z') || (*text >= 'A' && *text <= 'Z') || (*text >= '0' && *text <= '9') || *text == '_'))
+			return false;
+	return true;
+}
+
+// Check that text can be an XML name, and be written into a string literal as it is
+inline bool is_name(const char* text)
+{
+	if (!*text)
+		return false;
+	for (; *text; ++text)
+		if (lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)] || *text == '"' || *text == '\'' ||
+				*text == '\\' || *text == '<' || *text == '>' || *text == '&' || *text == '/' || *text == '=')
+			return false;
+	return true;
+}
+
+// Value of attribute of node, or 0 if there is none
+inline char* attribute_value(xml_node<char>* node, const char* name)
+{
+	xml_attribute<char>* attribute = node->first_attribute(name);
+	return attribute ? attribute->value() : 0;
+}
+
+// Value of attribute of node, which must be present
+inline char* required_value(xml_node<char>* node, const char* name, const char* what)
+{
+	char* value = attribute_value(node, name);
+	if (!value)
+		RAPIDXML_PARSE_ERROR(what, node->name());
+	return value;
+}
+
+// Number of occurrences, which is 0 for unbounded if allowed
+inline unsigned long occurrences(char* value, bool unbounded)
+{
+	if (unbounded && std::string(value) == "unbounded")
+		return 0;
+	unsigned long result;
+	convert_value(value, measure(value), result);
+	return result;
+}
+
+// Append number to text
+inline void append_number(std::string& text, unsigned long number)
+{
+	char buffer[24];
+	std::sprintf(buffer, "%lu", number);
+	text += buffer;
+}
+
+} /* namespace xinternal */
+
+const std::size_t xml_binding_generator::none;
+
+xml_binding_generator::xml_binding_generator()
+{
+}
+
+void xml_binding_generator::parse_schema(char* schema)
+{
+	xml_document<char> document;
+	document.parse<0>(schema);
+	xml_node<char>* binding = document.first_node("binding");
+	if (!binding)
+		RAPIDXML_PARSE_ERROR("expected binding element", schema);
+
+	// Namespace, include path and guard
+	const char* name_space = xinternal::attribute_value(binding, "namespace");
+	if (name_space && !xinternal::is_identifier(name_space))
+		RAPIDXML_PARSE_ERROR("invalid namespace", const_cast<char*>(name_space));
+	const char* include = xinternal::attribute_value(binding, "include");
+	const char* guard = xinternal::attribute_value(binding, "guard");
+	if (guard && !xinternal::is_identifier(guard))
+		RAPIDXML_PARSE_ERROR("invalid guard", const_cast<char*>(guard));
+	std::string default_guard;
+	for (const char* text = name_space; text && *text; ++text)
+		default_guard += *text >= 'a' && *text <= 'z' ? static_cast<char>(*text - 'a' + 'A') : *text;
+	default_guard += name_space ? "_BINDING_H_" : "XML_BINDING_H_";
+
+	// Structures, in order of the schema
+	std::vector<structure> structures;
+	for (xml_node<char>* node = binding->first_node(); node; node = node->next_sibling())
+	{
+		if (node->type() != node_element)
+			continue;
+		if (std::string(node->name()) != "struct")
+			RAPIDXML_PARSE_ERROR("expected struct element", node->name());
+		char* name = xinternal::required_value(node, "name", "struct has no name");
+		if (!xinternal::is_identifier(name) || xinternal::simple_type(name))
+			RAPIDXML_PARSE_ERROR("invalid struct name", name);
+		for (std::size_t i = 0; i < structures.size(); ++i)
+			if (structures[i].name == name)
+				RAPIDXML_PARSE_ERROR("duplicate struct", name);
+		char* element = xinternal::attribute_value(node, "element");
+		if (element && !xinternal::is_name(element))
+			RAPIDXML_PARSE_ERROR("invalid element name", element);
+		structures.push_back(structure());
+		structure& added = structures.back();
+		added.name = name;
+		added.element = element ? element : name;
+		for (xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+			if (child->type() == node_element)
+				parse_member(child, added);
+	}
+
+	// Types which are not simple are names of structures
+	for (std::size_t i = 0; i < structures.size(); ++i)
+		for (std::size_t j = 0; j < structures[i].members.size(); ++j)
+		{
+			member& current = structures[i].members[j];
+			if (current.structure == none)
+				continue;
+			for (current.structure = 0; current.structure < structures.size(); ++current.structure)
+				if (structures[current.structure].name == current.type)
+					break;
+			if (current.structure == structures.size())
+				RAPIDXML_PARSE_ERROR("unknown type", current.where);
+		}
+
+	// Structures contained by value must be defined first, so they cannot contain themselves
+	std::vector<int> marks(structures.size(), 0);
+	std::vector<structure> ordered;
+	for (std::size_t i = 0; i < structures.size(); ++i)
+		if (!marks[i])
+			order_structures(structures, i, marks, ordered);
+
+	m_namespace = name_space ? name_space : "";
+	m_include = include ? include : "Core/XmlBinder.h";
+	m_guard = guard ? guard : default_guard;
+	m_structures.swap(ordered);
+}
+
+std::string xml_binding_generator::header() const
+{
+	std::string text;
+	text += "// Generated by xml_binding_generator; do not edit.\n";
+	text += "// Structures below are read from XML in one pass by xprocesser::xcore::xml_binder.\n\n";
+	text += "#ifndef " + m_guard + "\n";
+	text += "#define " + m_guard + "\n\n";
+	text += "#include \"" + m_include + "\"\n\n";
+	text += "#include <string>\n";
+	text += "#include <vector>\n\n";
+	if (!m_namespace.empty())
+		text += "namespace " + m_namespace + "\n{\n\n";
+
+	// Structures, each after those it contains, and functions, which may call each other
+	for (std::size_t i = 0; i < m_structures.size(); ++i)
+		write_structure(m_structures[i], text);
+	for (std::size_t i = 0; i < m_structures.size(); ++i)
+		text += "template<int Flags>\nvoid read(xprocesser::xcore::xml_binder<char>&, " + m_structures[i].name + "&);\n\n";
+	for (std::size_t i = 0; i < m_structures.size(); ++i)
+		write_read(m_structures[i], text);
+	for (std::size_t i = 0; i < m_structures.size(); ++i)
+		write_parse(m_structures[i], text);
+
+	if (!m_namespace.empty())
+		text += "} /* namespace " + m_namespace + " */\n\n";
+	text += "#endif /* " + m_guard + " */\n";
+	return text;
+}
+
+void xml_binding_generator::parse_member(xml_node<char>* node, structure& target)
+{
+	member added;
+	std::string kind(node->name());
+	if (kind == "attribute")
+		added.kind = member_attribute;
+	else if (kind == "element")
+		added.kind = member_element;
+	else if (kind == "text")
+		added.kind = member_text;
+	else
+		RAPIDXML_PARSE_ERROR("expected attribute, element or text element", node->name());
+
+	// Names; value of the element has no name
+	char* name = 0;
+	if (added.kind != member_text)
+	{
+		name = xinternal::required_value(node, "name", "member has no name");
+		if (!xinternal::is_name(name))
+			RAPIDXML_PARSE_ERROR("invalid name", name);
+		added.name = name;
+	}
+	char* member_name = added.kind == member_text ? xinternal::required_value(node, "member", "text has no member") : xinternal::attribute_value(node, "member");
+	if (!member_name)
+		member_name = name;
+	if (!xinternal::is_identifier(member_name))
+		RAPIDXML_PARSE_ERROR("invalid member name", member_name);
+	added.member_name = member_name;
+
+	// Type, which is looked up among structures when they are all read
+	added.where = xinternal::required_value(node, "type", "member has no type");
+	const char* simple = xinternal::simple_type(added.where);
+	added.type = simple ? simple : added.where;
+	added.structure = simple ? none : 0;
+	if (!simple && added.kind != member_element)
+		RAPIDXML_PARSE_ERROR("attribute and text must have a simple type", added.where);
+
+	// Occurrences, as in XML Schema
+	char* min = xinternal::attribute_value(node, "min");
+	char* max = xinternal::attribute_value(node, "max");
+	added.min = min ? xinternal::occurrences(min, false) : added.kind == member_element ? 1 : 0;
+	added.max = max ? xinternal::occurrences(max, added.kind == member_element) : 1;
+	if (added.kind == member_text && (min || max))
+		RAPIDXML_PARSE_ERROR("text cannot have occurrences", min ? min : max);
+	if (added.kind == member_attribute && (added.max != 1 || added.min > 1))
+		RAPIDXML_PARSE_ERROR("attribute can occur once at most", max ? max : min);
+	if (added.max == 0 && max && std::string(max) != "unbounded")
+		RAPIDXML_PARSE_ERROR("max must be positive", max);
+	if (added.max && added.min > added.max)
+		RAPIDXML_PARSE_ERROR("min greater than max", min);
+
+	// Members, and attributes or elements, are distinct
+	for (std::size_t i = 0; i < target.members.size(); ++i)
+	{
+		const member& other = target.members[i];
+		if (other.member_name == added.member_name)
+			RAPIDXML_PARSE_ERROR("duplicate member", member_name);
+		if (other.member_name == added.member_name + "_type" || other.member_name + "_type" == added.member_name)
+			RAPIDXML_PARSE_ERROR("member name taken by type of another member", member_name);
+		if (other.kind == added.kind && (added.kind == member_text || other.name == added.name))
+			RAPIDXML_PARSE_ERROR(added.kind == member_text ? "duplicate text" : "duplicate name", node->name());
+	}
+	target.members.push_back(added);
+}
+
+void xml_binding_generator::order_structures(const std::vector<structure>& structures, std::size_t index, std::vector<int>& marks, std::vector<structure>& ordered)
+{
+	marks[index] = 1;
+	const structure& current = structures[index];
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		std::size_t contained = current.members[i].structure;
+		if (contained == none || marks[contained] == 2)
+			continue;
+		if (marks[contained] == 1)
+			RAPIDXML_PARSE_ERROR("struct contains itself", current.members[i].where);
+		order_structures(structures, contained, marks, ordered);
+	}
+	marks[index] = 2;
+	ordered.push_back(current);
+}
+
+void xml_binding_generator::write_structure(const structure& current, std::string& text) const
+{
+	text += "// Element <" + current.element + ">\n";
+	text += "struct " + current.name + "\n{\n";
+
+	// Type of each member is named, since types like unsigned long cannot be written before () to make a value
+	bool constructor = false;
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+		text += "\ttypedef " + current.members[i].type + " " + current.members[i].member_name + "_type;\n";
+	text += "\n";
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		const member& field = current.members[i];
+		if (field.max != 1)
+			text += "\tstd::vector<" + field.member_name + "_type> " + field.member_name + ";\n";
+		else
+			text += "\t" + field.member_name + "_type " + field.member_name + ";\n";
+		constructor |= field.max == 1 && field.structure == none && field.type != "std::string";
+	}
+
+	// Numbers and truth values start as zero
+	if (constructor)
+	{
+		text += "\n\t" + current.name + "()\n";
+		const char* separator = "\t: ";
+		for (std::size_t i = 0; i < current.members.size(); ++i)
+		{
+			const member& field = current.members[i];
+			if (field.max == 1 && field.structure == none && field.type != "std::string")
+			{
+				text += separator + field.member_name + "()\n";
+				separator = "\t  , ";
+			}
+		}
+		text += "\t{\n\t}\n";
+	}
+	text += "};\n\n";
+}
+
+void xml_binding_generator::write_read(const structure& current, std::string& text) const
+{
+	bool attributes = false, elements = false, value = false;
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		attributes |= current.members[i].kind == member_attribute;
+		elements |= current.members[i].kind == member_element;
+		value |= current.members[i].kind == member_text;
+	}
+
+	text += "// Reads element, whose start tag is current in binder, into value\n";
+	text += "template<int Flags>\n";
+	text += "void read(xprocesser::xcore::xml_binder<char>& binder, " + current.name + "& value)\n{\n";
+
+	// Members which might not be read start over
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		const member& field = current.members[i];
+		if (field.max != 1)
+			text += "\tvalue." + field.member_name + ".clear();\n";
+		else if (field.min == 0 && field.kind != member_text)
+			text += "\tvalue." + field.member_name + " = " + current.name + "::" + field.member_name + "_type();\n";
+	}
+
+	// Attributes, of which the required ones are checked once all are read
+	if (attributes)
+	{
+		for (std::size_t i = 0; i < current.members.size(); ++i)
+			if (current.members[i].kind == member_attribute && current.members[i].min)
+				text += "\tbool has_" + current.members[i].member_name + " = false;\n";
+		text += "\twhile (binder.next_attribute<Flags>())\n\t{\n";
+		write_switch(current, member_attribute, "\t\t", text);
+		text += "\t}\n";
+		for (std::size_t i = 0; i < current.members.size(); ++i)
+			if (current.members[i].kind == member_attribute && current.members[i].min)
+				text += "\tif (!has_" + current.members[i].member_name + ")\n\t\tbinder.error(\"missing required attribute\");\n";
+	}
+
+	// Child elements, of which single ones are checked when they repeat
+	if (elements)
+	{
+		for (std::size_t i = 0; i < current.members.size(); ++i)
+			if (current.members[i].kind == member_element && current.members[i].max == 1)
+				text += "\tbool has_" + current.members[i].member_name + " = false;\n";
+		text += "\tif (binder.enter<Flags>())\n\t{\n";
+		text += "\t\twhile (binder.next_element<Flags>())\n\t\t{\n";
+		write_switch(current, member_element, "\t\t\t", text);
+		text += "\t\t\tbinder.skip<Flags>();\n";
+		text += "\t\t}\n\t}\n";
+	}
+	else if (value)
+		text += "\tbinder.read_value<Flags>();\n";
+	else
+		text += "\tbinder.skip<Flags>();\n";
+
+	// Value of the element, and the elements which are too few
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		const member& field = current.members[i];
+		if (field.kind == member_text)
+			text += "\txprocesser::xcore::convert_value(binder.value(), binder.value_size(), value." + field.member_name + ");\n";
+		else if (field.kind == member_element && field.max == 1 && field.min)
+			text += "\tif (!has_" + field.member_name + ")\n\t\tbinder.error(\"missing required element\");\n";
+		else if (field.kind == member_element && field.max != 1 && field.min)
+		{
+			text += "\tif (value." + field.member_name + ".size() < ";
+			xinternal::append_number(text, field.min);
+			text += ")\n\t\tbinder.error(\"too few elements\");\n";
+		}
+	}
+	text += "}\n\n";
+}
+
+void xml_binding_generator::write_switch(const structure& current, member_kind kind, const char* indent, std::string& text) const
+{
+	// Names are told apart by size first, and by characters only among names of the same size
+	std::string tabs(indent);
+	std::vector<bool> written(current.members.size(), false);
+	text += tabs + "switch (binder.name_size())\n" + tabs + "{\n";
+	for (std::size_t i = 0; i < current.members.size(); ++i)
+	{
+		if (current.members[i].kind != kind || written[i])
+			continue;
+		std::size_t size = current.members[i].name.size();
+		text += tabs + "case ";
+		xinternal::append_number(text, size);
+		text += ":\n";
+		for (std::size_t j = i; j < current.members.size(); ++j)
+		{
+			const member& field = current.members[j];
+			if (field.kind != kind || field.name.size() != size)
+				continue;
+			written[j] = true;
+			std::string target = "value." + field.member_name;
+			text += tabs + "\tif (binder.name_is(\"" + field.name + "\", ";
+			xinternal::append_number(text, size);
+			text += "))\n" + tabs + "\t{\n";
+			std::string body = tabs + "\t\t";
+			if (kind == member_attribute)
+			{
+				text += body + "xprocesser::xcore::convert_value(binder.value(), binder.value_size(), " + target + ");\n";
+				if (field.min)
+					text += body + "has_" + field.member_name + " = true;\n";
+			}
+			else if (field.max == 1)
+			{
+				// Single element
+				text += body + "if (has_" + field.member_name + ")\n" + body + "\tbinder.error(\"repeated element\");\n";
+				if (field.structure != none)
+					text += body + "read<Flags>(binder, " + target + ");\n";
+				else
+				{
+					text += body + "binder.read_value<Flags>();\n";
+					text += body + "xprocesser::xcore::convert_value(binder.value(), binder.value_size(), " + target + ");\n";
+				}
+				text += body + "has_" + field.member_name + " = true;\n";
+			}
+			else
+			{
+				// Repeated element, appended to vector; std::vector<bool> has no references to its items
+				if (field.max)
+				{
+					text += body + "if (" + target + ".size() == ";
+					xinternal::append_number(text, field.max);
+					text += ")\n" + body + "\tbinder.error(\"too many elements\");\n";
+				}
+				if (field.structure != none)
+				{
+					text += body + target + ".push_back(" + current.name + "::" + field.member_name + "_type());\n";
+					text += body + "read<Flags>(binder, " + target + ".back());\n";
+				}
+				else if (field.type == "bool")
+				{
+					text += body + "bool item;\n";
+					text += body + "binder.read_value<Flags>();\n";
+					text += body + "xprocesser::xcore::convert_value(binder.value(), binder.value_size(), item);\n";
+					text += body + target + ".push_back(item);\n";
+				}
+				else
+				{
+					text += body + target + ".push_back(" + current.name + "::" + field.member_name + "_type());\n";
+					text += body + "binder.read_value<Flags>();\n";
+					text += body + "xprocesser::xcore::convert_value(binder.value(), binder.value_size(), " + target + ".back());\n";
+				}
+			}
+			text += body + "continue;\n";
+			text += tabs + "\t}\n";
+		}
+		text += tabs + "\tbreak;\n";
+	}
+	text += tabs + "}\n";
+}
+
+void xml_binding_generator::write_parse(const structure& current, std::string& text) const
+{
+	text += "// Parses zero-terminated text, whose root element is <" + current.element + ">, into value\n";
+	text += "template<int Flags>\n";
+	text += "void parse(xprocesser::xcore::xml_binder<char>& binder, char* text, " + current.name + "& value)\n{\n";
+	text += "\tbinder.begin<Flags>(text);\n";
+	text += "\tif (!binder.name_is(\"" + current.element + "\", ";
+	xinternal::append_number(text, current.element.size());
+	text += "))\n\t\tbinder.error(\"unexpected root element\");\n";
+	text += "\tread<Flags>(binder, value);\n}\n\n";
+
+	text += "// Parses zero-terminated text, whose root element is <" + current.element + ">, into value, with a binder of its own\n";
+	text += "template<int Flags>\n";
+	text += "void parse(char* text, " + current.name + "& value)\n{\n";
+	text += "\txprocesser::xcore::xml_binder<char> binder;\n";
+	text += "\tparse<Flags>(binder, text, value);\n}\n\n";
+}
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* !defined(XPROC_NO_STDLIB) */
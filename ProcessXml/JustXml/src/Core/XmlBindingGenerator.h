@@ -0,0 +1,147 @@
+/*
+ * XmlBindingGenerator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLBINDINGGENERATOR_H_
+#define SRC_CORE_XMLBINDINGGENERATOR_H_
+
+#include "XmlDocument.h"
+
+// Code generation needs the standard library
+#if !defined(XPROC_NO_STDLIB)
+#include <string>       // For std::string
+#include <vector>       // For std::vector
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+///////////////////////////////////////////////////////////////////////////
+// XML binding generator
+
+//! This class generates C++ code binding XML to structures, from a schema describing the structures.
+//! The code defines the structures, and reads XML text straight into them with xml_binder,
+//! in one pass without a DOM tree; elements are told apart by a switch on the size of their names.
+//! Run it as a build step, and include the header it writes where the structures are needed.
+//! <br><br>
+//! Schema is an XML document like this:
+//! <pre>
+//! <binding namespace="shop">
+//!     <struct name="Order" element="order">
+//!         <attribute name="id" type="unsigned long" min="1"/>
+//!         <element name="customer" type="Customer"/>
+//!         <element name="item" member="items" type="Item" min="0" max="unbounded"/>
+//!         <element name="note" type="string" min="0"/>
+//!     </struct>
+//!     <struct name="Item" element="item">
+//!         <attribute name="sku" type="string" min="1"/>
+//!         <text member="quantity" type="int"/>
+//!     </struct>
+//!     ...
+//! </binding>
+//! </pre>
+//! Each struct is bound to an element, named by the <code>element</code> attribute or else like the struct.
+//! It has a member for each attribute and child element of interest, and optionally one for value of the element.
+//! Member is named by the <code>member</code> attribute or else like the attribute or element,
+//! and its type is named by the member name followed by <code>_type</code>, which no other member may take.
+//! Type is <code>string</code>, <code>int</code>, <code>unsigned</code>, <code>long</code>, <code>unsigned long</code>,
+//! <code>double</code>, <code>float</code>, <code>bool</code> or a struct of the schema; attributes and values have simple types.
+//! Occurrences are given by <code>min</code> and <code>max</code>, which is a number or <code>unbounded</code>, as in XML Schema:
+//! an attribute is optional by default, an element must occur once. Element which may occur more than once is bound to a std::vector.
+//! <br><br>
+//! For each struct the code defines functions, templates of flags as xml_binder functions are:
+//! <code>read<Flags>(binder, value)</code> reads element whose start tag is current in binder,
+//! and <code>parse<Flags>(text, value)</code> parses zero-terminated text whose root is the element of the struct.
+//! They throw parse_error if an attribute or element occurs fewer or more times than allowed, or a value cannot be converted.
+//! Other attributes and elements are skipped. Vectors are cleared and optional members are reset before reading,
+//! so a value can be read into again, reusing memory of its vectors.
+class xml_binding_generator
+{
+public:
+
+	//! Constructs generator with no schema
+	xml_binding_generator();
+
+
+	//! Reads schema from zero-terminated string, replacing schema read before.
+	//! In case of error, parse_error exception will be thrown, pointing into the schema.
+	//! \param schema Schema to read; it is parsed in place, so it is modified.
+	void parse_schema(char*);
+
+	//! Generates header with structures of the schema and functions binding them.
+	//! \return Text of header.
+	std::string header() const;
+
+private:
+
+	// Kinds of members
+	enum member_kind
+	{
+		member_attribute,
+		member_element,
+		member_text
+	};
+
+	// Member of structure
+	struct member
+	{
+		member_kind kind;
+		std::string name;           // Name of attribute or element
+		std::string member_name;
+		std::string type;           // C++ type of one value
+		std::size_t structure;      // Index of structure of the type in the schema, or none for simple types
+		unsigned long min;
+		unsigned long max;          // Maximal number of occurrences, or 0 for unbounded
+		char* where;                // Type in the schema, while it is read
+	};
+
+	// Structure bound to element
+	struct structure
+	{
+		std::string name;
+		std::string element;
+		std::vector<member> members;
+	};
+
+	// Restrictive copy constructor and assignment operator
+	xml_binding_generator(const xml_binding_generator&);
+	void operator=(const xml_binding_generator&);
+
+	// Index standing for no structure
+	static const std::size_t none = ~std::size_t(0);
+
+	// Read member of structure from schema node
+	static void parse_member(xml_node<char>*, structure&);
+
+	// Append structure to order after structures it contains, which are appended first unless marked as appended.
+	// Marks are 0 for structures not appended, 1 for those being appended, and 2 for those appended.
+	static void order_structures(const std::vector<structure>&, std::size_t, std::vector<int>&, std::vector<structure>&);
+
+	// Append definition of structure to text
+	void write_structure(const structure&, std::string&) const;
+
+	// Append function reading structure to text
+	void write_read(const structure&, std::string&) const;
+
+	// Append switch on names of members of given kind to text, indented by given tabs
+	void write_switch(const structure&, member_kind, const char*, std::string&) const;
+
+	// Append functions parsing text into structure to text
+	void write_parse(const structure&, std::string&) const;
+
+	std::string m_namespace;                    // Namespace of the code, or empty for the global one
+	std::string m_include;                      // Path to include XmlBinder.h by
+	std::string m_guard;                        // Include guard of the header
+	std::vector<structure> m_structures;        // Structures, each after those it contains
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* !defined(XPROC_NO_STDLIB) */
+
+#endif /* SRC_CORE_XMLBINDINGGENERATOR_H_ */
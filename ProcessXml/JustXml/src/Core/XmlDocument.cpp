@@ -0,0 +1,2208 @@
+/*
+ * XmlDocument.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlDocument.h"
+
+#include "Internal/CoreAlgorithms.h"
+#include "Internal/LookupTables.h"
+#include "Internal/ScanKernels.h"
+#include "Internal/WorkerPool.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstring>      // For std::memmove, std::memcpy
+#endif
+
+#if defined(XPROC_PARALLEL_PARSE)
+#include <vector>       // For std::vector
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+///////////////////////////////////////////////////////////////////////
+// Character class predicates
+
+// Detect whitespace character
+template<typename ItemType>
+struct xml_document<ItemType>::whitespace_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_whitespace;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect node name character
+template<typename ItemType>
+struct xml_document<ItemType>::node_name_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_node_name;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_node_name[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect attribute name character
+template<typename ItemType>
+struct xml_document<ItemType>::attribute_name_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_attribute_name;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_attribute_name[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect text character (PCDATA)
+template<typename ItemType>
+struct xml_document<ItemType>::text_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_text;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_text[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect text character (PCDATA) that does not require processing
+template<typename ItemType>
+struct xml_document<ItemType>::text_pure_no_ws_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_text_pure_no_ws;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_text_pure_no_ws[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect text character (PCDATA) that does not require processing
+template<typename ItemType>
+struct xml_document<ItemType>::text_pure_with_ws_pred
+{
+	static const xinternal::scan_class kind = xinternal::scan_text_pure_with_ws;
+
+	static unsigned char test(ItemType ch)
+	{
+		return xinternal::lookup_tables<0>::lookup_text_pure_with_ws[static_cast<unsigned char>(ch)];
+	}
+};
+
+// Detect attribute value character
+template<typename ItemType>
+template<ItemType Quote>
+struct xml_document<ItemType>::attribute_value_pred
+{
+	static const xinternal::scan_class kind = Quote == ItemType('\'') ? xinternal::scan_attribute_data_1 : xinternal::scan_attribute_data_2;
+
+	static unsigned char test(ItemType ch)
+	{
+		if (Quote == ItemType('\''))
+			return xinternal::lookup_tables<0>::lookup_attribute_data_1[static_cast<unsigned char>(ch)];
+		if (Quote == ItemType('\"'))
+			return xinternal::lookup_tables<0>::lookup_attribute_data_2[static_cast<unsigned char>(ch)];
+		return 0;       // Should never be executed, to avoid warnings on Comeau
+	}
+};
+
+// Detect attribute value character
+template<typename ItemType>
+template<ItemType Quote>
+struct xml_document<ItemType>::attribute_value_pure_pred
+{
+	static const xinternal::scan_class kind = Quote == ItemType('\'') ? xinternal::scan_attribute_data_1_pure : xinternal::scan_attribute_data_2_pure;
+
+	static unsigned char test(ItemType ch)
+	{
+		if (Quote == ItemType('\''))
+			return xinternal::lookup_tables<0>::lookup_attribute_data_1_pure[static_cast<unsigned char>(ch)];
+		if (Quote == ItemType('\"'))
+			return xinternal::lookup_tables<0>::lookup_attribute_data_2_pure[static_cast<unsigned char>(ch)];
+		return 0;       // Should never be executed, to avoid warnings on Comeau
+	}
+};
+
+namespace xinternal
+{
+
+// Skips characters of the predicate class; narrow text goes through the vector kernels
+template<class StopPred, typename ItemType>
+struct class_scanner
+{
+	static ItemType* scan(ItemType* text)
+	{
+		while (StopPred::test(*text))
+			++text;
+		return text;
+	}
+};
+
+template<class StopPred>
+struct class_scanner<StopPred, char>
+{
+	static char* scan(char* text)
+	{
+		return const_cast<char*>(scan_kernels[StopPred::kind](text));
+	}
+};
+
+// Moves run [src, end) down to dest during character reference expansion; dest never lies after src,
+// or lies in a separate copy of const text
+template<typename ItemType>
+inline ItemType* move_run(ItemType* dest, const ItemType* src, const ItemType* end)
+{
+#if !defined(XPROC_NO_STDLIB)
+	std::size_t size = end - src;
+	if (size >= 32)
+	{
+		std::memmove(dest, src, size * sizeof(ItemType));
+		return dest + size;
+	}
+#endif
+	while (src != end)
+		*dest++ = *src++;
+	return dest;
+}
+
+// Flags with the bits of index placed, lowest first, at the bits of mask
+template<int Index, int Mask>
+struct deposit_flags
+{
+	static const int value = ((Index & 1) ? (Mask & -Mask) : 0) | deposit_flags<(Index >> 1), (Mask & (Mask - 1))>::value;
+};
+
+template<int Index>
+struct deposit_flags<Index, 0>
+{
+	static const int value = 0;
+};
+
+// Number of bits of mask
+template<int Mask>
+struct count_flags
+{
+	static const int value = (Mask & 1) + count_flags<(Mask >> 1)>::value;
+};
+
+template<>
+struct count_flags<0>
+{
+	static const int value = 0;
+};
+
+// Fills table of parse functions for every combination of the bits of mask, from index down to 0
+template<class Document, class Func, int Index, int Mask>
+struct parse_table_filler
+{
+	static void fill(Func* table)
+	{
+		table[Index] = &Document::template parse<deposit_flags<Index, Mask>::value>;
+		parse_table_filler<Document, Func, Index - 1, Mask>::fill(table);
+	}
+};
+
+template<class Document, class Func, int Mask>
+struct parse_table_filler<Document, Func, -1, Mask>
+{
+	static void fill(Func*)
+	{
+	}
+};
+
+template<class Document, int Mask, class Func>
+inline bool fill_parse_table(Func* table)
+{
+	parse_table_filler<Document, Func, (1 << count_flags<Mask>::value) - 1, Mask>::fill(table);
+	return true;
+}
+
+// Index of flags in table of combinations of the bits of mask; flags must be within mask
+inline std::size_t parse_table_index(int flags, int mask)
+{
+	std::size_t index = 0;
+	for (std::size_t bit = 1; mask; mask &= mask - 1, bit <<= 1)
+		if (flags & mask & -mask)
+			index |= bit;
+	return index;
+}
+
+} /* namespace xinternal */
+
+///////////////////////////////////////////////////////////////////////
+// Document
+
+template<typename ItemType>
+xml_document<ItemType>::xml_document()
+: xml_node<ItemType>(node_document)
+  , m_workers(0)
+  , m_worker_count(0)
+  , m_pool(0)
+  , m_backup(0)
+  , m_backup_size(0)
+#if defined(XPROC_LAZY_CONTENTS)
+  , m_parse_lazy(0)
+#endif
+  , m_const_begin(0)
+  , m_const_end(0)
+{
+#if defined(XPROC_COMPACT_NODES)
+	// Cage header refers to the document, so that children can link to it
+	this->m_document = static_cast<xml_node<ItemType>*>(this);
+#endif
+}
+
+template<typename ItemType>
+xml_document<ItemType>::~xml_document()
+{
+	for (unsigned i = 0; i < m_worker_count; ++i)
+		delete m_workers[i];
+	delete[] m_workers;
+	delete[] m_backup;
+#if defined(XPROC_PARALLEL_PARSE)
+	delete m_pool;
+#endif
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::parse(ItemType* text)
+{
+	assert(text);
+
+	// Remove current contents
+	this->remove_all_nodes();
+	this->remove_all_attributes();
+
+#if defined(XPROC_COMPACT_NODES)
+	// Strings of nodes are kept by offset in the text, so it must fit in the range of offsets
+	std::size_t size = xinternal::measure(text) + 1;
+	if (size > xinternal::cage_size)
+		RAPIDXML_PARSE_ERROR("text too long", text);
+	this->cage_text(text, size);
+
+	// Take nodes and attributes from one part of the cage, whose text is measured already.
+	// Without the cage, measuring text only to presize would cost more than growing the pool saves,
+	// so xflags::parse_presize is ignored there
+	if (Flags & parse_presize)
+		presize_pool(text, size - 1);
+#endif
+
+	// Index structural characters of the whole text up front
+	if (Flags & parse_structural_index)
+		m_structural_index.build(text, (Flags & parse_declaration_node) != 0);
+
+#if defined(XPROC_LAZY_CONTENTS)
+	// Deferred contents are parsed after the index is used up
+	if (Flags & parse_lazy)
+		m_parse_lazy = &xml_document<ItemType>::template parse_deferred_contents<Flags & ~parse_structural_index>;
+#endif
+
+	// Parse BOM, if any
+	parse_bom<Flags>(text);
+
+	// Parse children
+	while (1)
+	{
+		// Skip whitespace before node
+		skip<whitespace_pred, Flags>(text);
+		if (*text == 0)
+			break;
+
+		// Parse and append new child
+		if (*text == ItemType('<'))
+		{
+			++text;     // Skip '<'
+			if (xml_node<ItemType>* node = parse_node<Flags>(text))
+				this->append_node(node);
+		}
+		else
+			RAPIDXML_PARSE_ERROR("expected <", text);
+	}
+}
+
+template<typename ItemType>
+void xml_document<ItemType>::parse(ItemType* text, int flags)
+{
+	parse_func parse = find_parse(flags);
+	if (!parse)
+		RAPIDXML_PARSE_ERROR("flags not available at run time", text);
+	(this->*parse)(text);
+}
+
+template<typename ItemType>
+bool xml_document<ItemType>::parse_available(int flags)
+{
+	return find_parse(flags) != 0;
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::parse(const ItemType* text, std::size_t size)
+{
+	assert(text || !size);
+
+	// Zero character ends the text, so nothing after it is parsed or checked
+	size = xinternal::measure(text, size);
+
+	// Text is never written and its end is not terminated; single stage, eager parse only
+	const int ConstFlags = (Flags | parse_no_string_terminators | parse_const_input) & ~(parse_structural_index | parse_lazy);
+
+	// Remove current contents
+	this->remove_all_nodes();
+	this->remove_all_attributes();
+
+#if defined(XPROC_COMPACT_NODES)
+	// Strings of nodes are kept by offset in the text, so it must fit in the range of offsets
+	if (size > xinternal::cage_size)
+		RAPIDXML_PARSE_ERROR("text too long", const_cast<ItemType*>(text));
+	this->cage_text(text, size);
+#endif
+
+	// Take nodes and attributes from one block of the memory pool
+	if (Flags & parse_presize)
+		presize_pool(text, size);
+
+	// Parser never writes to the text with xflags::parse_const_input
+	ItemType* begin = const_cast<ItemType*>(text);
+	ItemType* end = begin + size;
+
+	// Parse BOM, if any
+	if (size >= 3)
+		parse_bom<ConstFlags>(begin);
+
+	// Markup ends with >, and every scan of the parser stops at > at the latest,
+	// except scans of text and attribute values, which are checked by const_occurs() first
+	m_const_begin = begin;
+	m_const_end = end;
+	while (m_const_end != begin && m_const_end[-1] != ItemType('>'))
+		--m_const_end;
+	m_const_last[0] = m_const_last[1] = m_const_last[2] = 0;
+
+	// Parse children
+	while (begin != m_const_end)
+	{
+		// Skip whitespace before node
+		skip<whitespace_pred, ConstFlags>(begin);
+
+		// Parse and append new child
+		if (*begin == ItemType('<'))
+		{
+			++begin;    // Skip '<'
+			if (xml_node<ItemType>* node = parse_node<ConstFlags>(begin))
+				this->append_node(node);
+		}
+		else
+			RAPIDXML_PARSE_ERROR("expected <", begin);
+	}
+
+	// Only whitespace may follow the last >
+	for (; begin != end; ++begin)
+		if (!whitespace_pred::test(*begin))
+		{
+			if (*begin == ItemType('<'))
+				RAPIDXML_PARSE_ERROR("unexpected end of data", end);
+			RAPIDXML_PARSE_ERROR("expected <", begin);
+		}
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::parse_parallel(ItemType* text, unsigned threads)
+{
+	assert(text);
+	const int SerialFlags = Flags & ~parse_structural_index;
+
+#if defined(XPROC_COMPACT_NODES)
+	// Nodes of worker documents would lie in other cages, where the tree cannot link to them
+	(void)threads;
+	(void)SerialFlags;
+	parse<Flags>(text);
+#else
+	// Remove current contents
+	this->remove_all_nodes();
+	this->remove_all_attributes();
+
+#if defined(XPROC_LAZY_CONTENTS)
+	// Deferred contents, also those parsed by workers, are parsed by this document
+	if (Flags & parse_lazy)
+		m_parse_lazy = &xml_document<ItemType>::template parse_deferred_contents<SerialFlags>;
+#endif
+
+	// Parse BOM, if any
+	parse_bom<SerialFlags>(text);
+
+	// Parse children, splitting the first element between threads
+	bool split = threads > 1;
+	while (1)
+	{
+		// Skip whitespace before node
+		skip<whitespace_pred, SerialFlags>(text);
+		if (*text == 0)
+			break;
+
+		// Parse and append new child
+		if (*text == ItemType('<'))
+		{
+			++text;     // Skip '<'
+			if (!split || text[0] == ItemType('?') || text[0] == ItemType('!'))
+			{
+				if (xml_node<ItemType>* node = parse_node<SerialFlags>(text))
+					this->append_node(node);
+				continue;
+			}
+			split = false;
+
+			// Element, as in parse_element()
+			xml_node<ItemType>* element = this->allocate_node(node_element);
+			if (parse_start_tag<SerialFlags>(text, element))
+				parse_node_contents_parallel<SerialFlags>(text, element, threads);
+			if (!(SerialFlags & parse_no_string_terminators))
+				element->name()[element->name_size()] = ItemType('\0');
+			this->append_node(element);
+		}
+		else
+			RAPIDXML_PARSE_ERROR("expected <", text);
+	}
+#endif
+}
+
+template<typename ItemType>
+void xml_document<ItemType>::clear()
+{
+	this->remove_all_nodes();
+	this->remove_all_attributes();
+	memory_pool<ItemType>::clear();
+	m_structural_index.release();
+	for (unsigned i = 0; i < m_worker_count; ++i)
+		delete m_workers[i];
+	delete[] m_workers;
+	m_workers = 0;
+	m_worker_count = 0;
+	delete[] m_backup;
+	m_backup = 0;
+	m_backup_size = 0;
+#if defined(XPROC_INTERN_NAMES)
+	m_symbols.release();
+#endif
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xcore::name_id xml_document<ItemType>::intern_name(const ItemType* name, std::size_t size)
+{
+	assert(name);
+	if (size == 0)
+		size = xinternal::measure(name);
+	return xcore::name_id(m_symbols.intern(name, size));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// Internal character utility functions
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::insert_coded_character(ItemType*& text, unsigned long code)
+{
+	if (Flags & parse_no_utf8)
+	{
+		// Insert 8-bit ASCII character
+		// Todo: possibly verify that code is less than 256 and use replacement char otherwise?
+		text[0] = static_cast<unsigned char>(code);
+		text += 1;
+	}
+	else
+	{
+		// Insert UTF8 sequence
+		if (code < 0x80)    // 1 byte sequence
+		{
+			text[0] = static_cast<unsigned char>(code);
+			text += 1;
+		}
+		else if (code < 0x800)  // 2 byte sequence
+		{
+			text[1] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[0] = static_cast<unsigned char>(code | 0xC0);
+			text += 2;
+		}
+		else if (code < 0x10000)    // 3 byte sequence
+		{
+			text[2] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[1] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[0] = static_cast<unsigned char>(code | 0xE0);
+			text += 3;
+		}
+		else if (code < 0x110000)   // 4 byte sequence
+		{
+			text[3] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[2] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[1] = static_cast<unsigned char>((code | 0x80) & 0xBF); code >>= 6;
+			text[0] = static_cast<unsigned char>(code | 0xF0);
+			text += 4;
+		}
+		else    // Invalid, only codes up to 0x10FFFF are allowed in Unicode
+		{
+			RAPIDXML_PARSE_ERROR("invalid numeric character entity", text);
+		}
+	}
+}
+
+template<typename ItemType>
+template<class StopPred, int Flags>
+inline void xml_document<ItemType>::skip(ItemType*& text)
+{
+	// Most runs are short, so scan a few characters inline before calling the kernel
+	ItemType* tmp = text;
+	for (int i = 0; i < 8; ++i, ++tmp)
+		if (!StopPred::test(*tmp))
+		{
+			text = tmp;
+			return;
+		}
+	if (Flags & parse_structural_index && xinternal::structural_index<ItemType>::covers(StopPred::kind) && m_structural_index.active())
+		text = m_structural_index.template next<StopPred::kind>(tmp);
+	else
+		text = xinternal::class_scanner<StopPred, ItemType>::scan(tmp);
+}
+
+template<typename ItemType>
+template<class StopPred, class StopPredPure, int Flags>
+inline ItemType* xml_document<ItemType>::skip_and_expand_character_refs(ItemType*& text, ItemType*& value)
+{
+	// If entity translation, whitespace condense and whitespace trimming is disabled, use plain skip;
+	// trimming is done by the caller, so const text needs no translation skip for it
+	if (Flags & parse_no_entity_translation &&
+			!(Flags & parse_normalize_whitespace) &&
+			(!(Flags & parse_trim_whitespace) || Flags & parse_const_input))
+	{
+		skip<StopPred, Flags>(text);
+		return text;
+	}
+
+	// Use simple skip until first modification is detected
+	skip<StopPredPure, Flags>(text);
+
+	// Use translation skip
+	ItemType* src = text;
+	ItemType* dest = src;
+
+	// Const text is translated into a copy in memory pool, which translation never makes longer than the source
+	if (Flags & parse_const_input && StopPred::test(*src))
+	{
+		ItemType* end = src;
+		skip<StopPred, Flags>(end);
+		ItemType* copy = this->allocate_string(0, end - value);
+		dest = xinternal::move_run(copy, value, src);
+		value = copy;
+	}
+
+	while (StopPred::test(*src))
+	{
+		// If entity translation is enabled
+		if (!(Flags & parse_no_entity_translation))
+		{
+			// Test if replacement is needed
+			if (src[0] == ItemType('&'))
+			{
+				switch (src[1])
+				{
+
+				// &amp; &apos;
+				case ItemType('a'):
+					if (src[2] == ItemType('m') && src[3] == ItemType('p') && src[4] == ItemType(';'))
+					{
+						*dest = ItemType('&');
+						++dest;
+						src += 5;
+						continue;
+					}
+					if (src[2] == ItemType('p') && src[3] == ItemType('o') && src[4] == ItemType('s') && src[5] == ItemType(';'))
+					{
+						*dest = ItemType('\'');
+						++dest;
+						src += 6;
+						continue;
+					}
+					break;
+
+				// &quot;
+				case ItemType('q'):
+					if (src[2] == ItemType('u') && src[3] == ItemType('o') && src[4] == ItemType('t') && src[5] == ItemType(';'))
+					{
+						*dest = ItemType('"');
+						++dest;
+						src += 6;
+						continue;
+					}
+					break;
+
+				// &gt;
+				case ItemType('g'):
+					if (src[2] == ItemType('t') && src[3] == ItemType(';'))
+					{
+						*dest = ItemType('>');
+						++dest;
+						src += 4;
+						continue;
+					}
+					break;
+
+				// &lt;
+				case ItemType('l'):
+					if (src[2] == ItemType('t') && src[3] == ItemType(';'))
+					{
+						*dest = ItemType('<');
+						++dest;
+						src += 4;
+						continue;
+					}
+					break;
+
+				// &#...; - assumes ASCII
+				case ItemType('#'):
+					if (src[2] == ItemType('x'))
+					{
+						unsigned long code = 0;
+						src += 3;   // Skip &#x
+						while (1)
+						{
+							unsigned char digit = xinternal::lookup_tables<0>::lookup_digits[static_cast<unsigned char>(*src)];
+							if (digit == 0xFF)
+								break;
+							code = code * 16 + digit;
+							++src;
+						}
+						insert_coded_character<Flags>(dest, code);    // Put character in output
+					}
+					else
+					{
+						unsigned long code = 0;
+						src += 2;   // Skip &#
+						while (1)
+						{
+							unsigned char digit = xinternal::lookup_tables<0>::lookup_digits[static_cast<unsigned char>(*src)];
+							if (digit == 0xFF)
+								break;
+							code = code * 10 + digit;
+							++src;
+						}
+						insert_coded_character<Flags>(dest, code);    // Put character in output
+					}
+					if (*src == ItemType(';'))
+						++src;
+					else
+						RAPIDXML_PARSE_ERROR("expected ;", src);
+					continue;
+
+				// Something else
+				default:
+					// Ignore, just copy '&' verbatim
+					break;
+
+				}
+			}
+		}
+
+		// If whitespace condensing is enabled
+		if (Flags & parse_normalize_whitespace)
+		{
+			// Test if condensing is needed
+			if (whitespace_pred::test(*src))
+			{
+				*dest = ItemType(' '); ++dest;    // Put single space in dest
+				++src;                            // Skip first whitespace char
+				// Skip remaining whitespace chars
+				skip<whitespace_pred, Flags>(src);
+				continue;
+			}
+		}
+
+		// No replacement, copy character together with the run of pure characters after it
+		ItemType* end = src + 1;
+		skip<StopPredPure, Flags>(end);
+		dest = xinternal::move_run(dest, src, end);
+		src = end;
+	}
+
+	// Return new end
+	text = src;
+	return dest;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::scan_end(const ItemType* text) const
+{
+	return !*text || (Flags & parse_const_input && text + 1 == m_const_end);
+}
+
+template<typename ItemType>
+inline bool xml_document<ItemType>::const_occurs(const ItemType* text, ItemType ch)
+{
+	// Last occurrence is found by scanning back from the end once per parse; it is usually close to the end
+	ItemType*& last = m_const_last[ch == ItemType('<') ? 0 : ch == ItemType('\'') ? 1 : 2];
+	if (!last)
+	{
+		last = m_const_end;
+		while (last != m_const_begin && last[-1] != ch)
+			--last;
+	}
+	return text < last;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::skip_indexed_markup(ItemType*& text, int end_size)
+{
+	if (!(Flags & parse_structural_index) || !m_structural_index.active())
+		return false;
+
+	// Index records nothing inside the markup, so the next position is its closing '>', or the terminator
+	ItemType* end = m_structural_index.markup_end(text);
+	if (!*end)
+		RAPIDXML_PARSE_ERROR("unexpected end of data", end);
+	text = end - (end_size - 1);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Internal parsing functions
+
+template<typename ItemType>
+void xml_document<ItemType>::presize_pool(const ItemType* text, std::size_t size)
+{
+	// Every node but the document starts at a <, or ends at one if it is data, and every attribute has a =;
+	// elements take two < unless they are empty, and = occurs in text too, so the estimate is mostly too large.
+	// Strings are kept in the text, except values of const text which are decoded, and are left out
+	const std::size_t window = 4096 / sizeof(ItemType);
+	const std::size_t windows = 64;
+	std::size_t tags, equals;
+	if (size <= window * windows)
+		xinternal::count_markup(text, size, tags, equals);
+	else
+	{
+		// Longer text is counted in windows spread evenly over it, so that estimate costs the same for any size,
+		// and counts are scaled up with an eighth more for the markup windows miss
+		std::size_t window_tags, window_equals;
+		tags = equals = 0;
+		for (std::size_t i = 0; i < windows; ++i)
+		{
+			xinternal::count_markup(text + (size - window) / (windows - 1) * i, window, window_tags, window_equals);
+			tags += window_tags;
+			equals += window_equals;
+		}
+		double scale = static_cast<double>(size) / (window * windows) * 9 / 8;
+		tags = static_cast<std::size_t>(tags * scale);
+		equals = static_cast<std::size_t>(equals * scale);
+	}
+	const std::size_t node_size = (sizeof(xml_node<ItemType>) + RAPIDXML_ALIGNMENT - 1) & ~std::size_t(RAPIDXML_ALIGNMENT - 1);
+	const std::size_t attribute_size = (sizeof(xml_attribute<ItemType>) + RAPIDXML_ALIGNMENT - 1) & ~std::size_t(RAPIDXML_ALIGNMENT - 1);
+	this->presize(tags * node_size + equals * attribute_size);
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::parse_bom(ItemType*& text)
+{
+	// UTF-8?
+	if (static_cast<unsigned char>(text[0]) == 0xEF &&
+			static_cast<unsigned char>(text[1]) == 0xBB &&
+			static_cast<unsigned char>(text[2]) == 0xBF)
+	{
+		text += 3;      // Skip utf-8 bom
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_xml_declaration(ItemType*& text)
+{
+	// If parsing of declaration is disabled
+	if (!(Flags & parse_declaration_node))
+	{
+		// Skip until end of declaration
+		if (!skip_indexed_markup<Flags>(text, 2))
+			while (text[0] != ItemType('?') || text[1] != ItemType('>'))
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+		text += 2;    // Skip '?>'
+		return 0;
+	}
+
+	// Create declaration
+	xml_node<ItemType>* declaration = this->allocate_node(node_declaration);
+
+	// Skip whitespace before attributes or ?>
+	skip<whitespace_pred, Flags>(text);
+
+	// Parse declaration attributes
+	parse_node_attributes<Flags>(text, declaration);
+
+	// Skip ?>
+	if (text[0] != ItemType('?') || text[1] != ItemType('>'))
+		RAPIDXML_PARSE_ERROR("expected ?>", text);
+	text += 2;
+
+	return declaration;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_comment(ItemType*& text)
+{
+	// If parsing of comments is disabled
+	if (!(Flags & parse_comment_nodes))
+	{
+		// Skip until end of comment
+		if (!skip_indexed_markup<Flags>(text, 3))
+			while (text[0] != ItemType('-') || text[1] != ItemType('-') || text[2] != ItemType('>'))
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+		text += 3;     // Skip '-->'
+		return 0;      // Do not produce comment node
+	}
+
+	// Remember value start
+	ItemType* value = text;
+
+	// Skip until end of comment
+	if (!skip_indexed_markup<Flags>(text, 3))
+		while (text[0] != ItemType('-') || text[1] != ItemType('-') || text[2] != ItemType('>'))
+		{
+			if (scan_end<Flags>(text))
+				RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+			++text;
+		}
+
+	// Create comment node
+	xml_node<ItemType>* comment = this->allocate_node(node_comment);
+	comment->value(value, text - value);
+
+	// Place zero terminator after comment value
+	if (!(Flags & parse_no_string_terminators))
+		*text = ItemType('\0');
+
+	text += 3;     // Skip '-->'
+	return comment;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_doctype(ItemType*& text)
+{
+	// Remember value start
+	ItemType* value = text;
+
+	// Skip to >
+	while (*text != ItemType('>'))
+	{
+		// Determine character type
+		switch (*text)
+		{
+
+		// If '[' encountered, scan for matching ending ']' using naive algorithm with depth
+		// This works for all W3C test files except for 2 most wicked
+		case ItemType('['):
+		{
+			++text;     // Skip '['
+			int depth = 1;
+			while (depth > 0)
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				switch (*text)
+				{
+				case ItemType('['): ++depth; break;
+				case ItemType(']'): --depth; break;
+				}
+				++text;
+			}
+			break;
+		}
+
+		// Error on end of text
+		case ItemType('\0'):
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		// Other character, skip it
+		default:
+			++text;
+
+		}
+	}
+
+	// If DOCTYPE nodes enabled
+	if (Flags & parse_doctype_node)
+	{
+		// Create a new doctype node
+		xml_node<ItemType>* doctype = this->allocate_node(node_doctype);
+		doctype->value(value, text - value);
+
+		// Place zero terminator after value
+		if (!(Flags & parse_no_string_terminators))
+			*text = ItemType('\0');
+
+		text += 1;      // skip '>'
+		return doctype;
+	}
+	else
+	{
+		text += 1;      // skip '>'
+		return 0;
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_pi(ItemType*& text)
+{
+	// If creation of PI nodes is enabled
+	if (Flags & parse_pi_nodes)
+	{
+		// Create pi node
+		xml_node<ItemType>* pi = this->allocate_node(node_pi);
+
+		// Extract PI target name
+		ItemType* name = text;
+		skip<node_name_pred, Flags>(text);
+		if (text == name)
+			RAPIDXML_PARSE_ERROR("expected PI target", text);
+		pi->name(name, text - name);
+
+		// Skip whitespace between pi target and pi
+		skip<whitespace_pred, Flags>(text);
+
+		// Remember start of pi
+		ItemType* value = text;
+
+		// Skip to '?>'
+		if (!skip_indexed_markup<Flags>(text, 2))
+			while (text[0] != ItemType('?') || text[1] != ItemType('>'))
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+
+		// Set pi value (verbatim, no entity expansion or whitespace normalization)
+		pi->value(value, text - value);
+
+		// Place zero terminator after name and value
+		if (!(Flags & parse_no_string_terminators))
+		{
+			pi->name()[pi->name_size()] = ItemType('\0');
+			pi->value()[pi->value_size()] = ItemType('\0');
+		}
+
+		text += 2;                          // Skip '?>'
+		return pi;
+	}
+	else
+	{
+		// Skip to '?>'
+		if (!skip_indexed_markup<Flags>(text, 2))
+			while (text[0] != ItemType('?') || text[1] != ItemType('>'))
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+		text += 2;    // Skip '?>'
+		return 0;
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+inline ItemType xml_document<ItemType>::parse_and_append_data(xml_node<ItemType>* node, ItemType*& text, ItemType* contents_start)
+{
+	// Skip until end of data
+	ItemType* value, *end = scan_data<Flags>(text, contents_start, value);
+
+	// If characters are still left between end and value (this test is only necessary if normalization is enabled)
+	// Create new data node
+	if (!(Flags & parse_no_data_nodes))
+	{
+		xml_node<ItemType>* data = this->allocate_node(node_data);
+		data->value(value, end - value);
+		node->append_node(data);
+	}
+
+	// Add data to parent node if no data exists yet
+	if (!(Flags & parse_no_element_values))
+		if (*node->value() == ItemType('\0'))
+			node->value(value, end - value);
+
+	// Place zero terminator after value
+	if (!(Flags & parse_no_string_terminators))
+	{
+		ItemType ch = *text;
+		*end = ItemType('\0');
+		return ch;      // Return character that ends data; this is required because zero terminator overwritten it
+	}
+
+	// Return character that ends data
+	return *text;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_cdata(ItemType*& text)
+{
+	// If CDATA is disabled
+	if (Flags & parse_no_data_nodes)
+	{
+		// Skip until end of cdata
+		if (!skip_indexed_markup<Flags>(text, 3))
+			while (text[0] != ItemType(']') || text[1] != ItemType(']') || text[2] != ItemType('>'))
+			{
+				if (scan_end<Flags>(text))
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+		text += 3;      // Skip ]]>
+		return 0;       // Do not produce CDATA node
+	}
+
+	// Skip until end of cdata
+	ItemType* value = text;
+	if (!skip_indexed_markup<Flags>(text, 3))
+		while (text[0] != ItemType(']') || text[1] != ItemType(']') || text[2] != ItemType('>'))
+		{
+			if (scan_end<Flags>(text))
+				RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+			++text;
+		}
+
+	// Create new cdata node
+	xml_node<ItemType>* cdata = this->allocate_node(node_cdata);
+	cdata->value(value, text - value);
+
+	// Place zero terminator after value
+	if (!(Flags & parse_no_string_terminators))
+		*text = ItemType('\0');
+
+	text += 3;      // Skip ]]>
+	return cdata;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::parse_start_tag(ItemType*& text, xml_node<ItemType>* element)
+{
+	// Extract element name
+	ItemType* name = text;
+	std::size_t name_size = scan_element_name<Flags>(text);
+	element->name(name, name_size);
+#if defined(XPROC_INTERN_NAMES)
+	if (Flags & parse_intern_names)
+		element->m_name_id = xcore::name_id(m_symbols.intern(name, name_size));
+#endif
+
+	// Parse attributes, if any
+	parse_node_attributes<Flags>(text, element);
+
+	// Determine ending type
+	return scan_tag_end<Flags>(text);
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::parse_closing_tag(ItemType*& text, xml_node<ItemType>* node)
+{
+	scan_closing_tag<Flags>(text, node->name(), node->name_size());
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_element(ItemType*& text)
+{
+	// Create element node
+	xml_node<ItemType>* element = this->allocate_node(node_element);
+
+	// Parse start tag and contents, if any
+	if (parse_start_tag<Flags>(text, element))
+	{
+#if defined(XPROC_LAZY_CONTENTS)
+		if (Flags & parse_lazy)
+			skip_node_contents<Flags>(text, element);
+		else
+#endif
+			parse_node_contents<Flags>(text, element);
+	}
+
+	// Place zero terminator after name
+	if (!(Flags & parse_no_string_terminators))
+		element->name()[element->name_size()] = ItemType('\0');
+
+	// Return parsed element
+	return element;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline xml_node<ItemType>* xml_document<ItemType>::parse_node(ItemType*& text)
+{
+	// Parse proper node type
+	switch (text[0])
+	{
+
+	// <...
+	default:
+		// Parse and append element node
+		return parse_element<Flags>(text);
+
+	// <?...
+	case ItemType('?'):
+		++text;     // Skip ?
+		if ((text[0] == ItemType('x') || text[0] == ItemType('X')) &&
+				(text[1] == ItemType('m') || text[1] == ItemType('M')) &&
+				(text[2] == ItemType('l') || text[2] == ItemType('L')) &&
+				whitespace_pred::test(text[3]))
+		{
+			// '<?xml ' - xml declaration
+			text += 4;      // Skip 'xml '
+			return parse_xml_declaration<Flags>(text);
+		}
+		else
+		{
+			// Parse PI
+			return parse_pi<Flags>(text);
+		}
+
+	// <!...
+	case ItemType('!'):
+
+		// Parse proper subset of <! node
+		switch (text[1])
+		{
+
+		// <!-
+		case ItemType('-'):
+			if (text[2] == ItemType('-'))
+			{
+				// '<!--' - xml comment
+				text += 3;     // Skip '!--'
+				return parse_comment<Flags>(text);
+			}
+			break;
+
+		// <![
+		case ItemType('['):
+			if (text[2] == ItemType('C') && text[3] == ItemType('D') && text[4] == ItemType('A') &&
+					text[5] == ItemType('T') && text[6] == ItemType('A') && text[7] == ItemType('['))
+			{
+				// '<![CDATA[' - cdata
+				text += 8;     // Skip '![CDATA['
+				return parse_cdata<Flags>(text);
+			}
+			break;
+
+		// <!D
+		case ItemType('D'):
+			if (text[2] == ItemType('O') && text[3] == ItemType('C') && text[4] == ItemType('T') &&
+					text[5] == ItemType('Y') && text[6] == ItemType('P') && text[7] == ItemType('E') &&
+					whitespace_pred::test(text[8]))
+			{
+				// '<!DOCTYPE ' - doctype
+				text += 9;      // skip '!DOCTYPE '
+				return parse_doctype<Flags>(text);
+			}
+			break;
+
+		}   // switch
+
+		// Attempt to skip other, unrecognized node types starting with <!
+		++text;     // Skip !
+		while (*text != ItemType('>'))
+		{
+			if (*text == 0)
+				RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+			++text;
+		}
+		++text;     // Skip '>'
+		return 0;   // No node recognized
+
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::parse_node_contents(ItemType*& text, xml_node<ItemType>* node)
+{
+	// For all children and text
+	while (1)
+	{
+		// Const text may end after any child
+		if (Flags & parse_const_input && text == m_const_end)
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		// Skip whitespace between > and node contents
+		ItemType* contents_start = text;      // Store start of node contents before whitespace is skipped
+		skip<whitespace_pred, Flags>(text);
+		ItemType next_char = *text;
+
+		// After data nodes, instead of continuing the loop, control jumps here.
+		// This is because zero termination inside parse_and_append_data() function
+		// would wreak havoc with the above code.
+		// Also, skipping whitespace after data nodes is unnecessary.
+		after_data_node:
+
+		// Determine what comes next: node closing, child node, data node, or 0?
+		switch (next_char)
+		{
+
+		// Node closing or child node
+		case ItemType('<'):
+			if (text[1] == ItemType('/'))
+			{
+				// Node closing
+				text += 2;      // Skip '</'
+				parse_closing_tag<Flags>(text, node);
+				return;     // Node closed, finished parsing contents
+			}
+			else
+			{
+				// Child node
+				++text;     // Skip '<'
+				if (xml_node<ItemType>* child = parse_node<Flags>(text))
+					node->append_node(child);
+			}
+			break;
+
+		// End of data - error
+		case ItemType('\0'):
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		// Data node
+		default:
+			next_char = parse_and_append_data<Flags>(node, text, contents_start);
+			goto after_data_node;   // Bypass regular processing after data nodes
+
+		}
+	}
+}
+
+#if defined(XPROC_LAZY_CONTENTS)
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::skip_node_contents(ItemType*& text, xml_node<ItemType>* node)
+{
+	// Parse contents holding only text at once, so that element value is available
+	ItemType* contents = text;
+	skip<text_pred, Flags>(text);
+	if (*text != ItemType('<') || text[1] == ItemType('/'))
+	{
+		text = contents;
+		parse_node_contents<Flags>(text, node);
+		return;
+	}
+
+	// Skip children up to the matching closing tag
+	skip_children<Flags>(text);
+	node->m_contents = contents;
+	text += 2;      // Skip '</'
+	parse_closing_tag<Flags>(text, node);
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::parse_deferred_contents(xml_node<ItemType>* node)
+{
+	ItemType* text = node->m_contents;
+	node->m_contents = 0;
+	parse_node_contents<Flags>(text, node);
+}
+
+template<typename ItemType>
+void xml_document<ItemType>::parse_lazy_contents(xml_node<ItemType>* node)
+{
+	assert(m_parse_lazy);
+	(this->*m_parse_lazy)(node);
+}
+#endif
+
+template<typename ItemType>
+template<int Flags>
+bool xml_document<ItemType>::parse_node_contents_part(ItemType*& text, ItemType* stop, xml_node<ItemType>* node)
+{
+	// As parse_node_contents(), but checks for stop between children
+	while (1)
+	{
+		ItemType* contents_start = text;
+		skip<whitespace_pred, Flags>(text);
+		if (text >= stop)
+			return text == stop;
+		ItemType next_char = *text;
+
+		after_data_node:
+
+		switch (next_char)
+		{
+
+		// Child node; closing tag means stop lies outside the node
+		case ItemType('<'):
+			if (text[1] == ItemType('/'))
+				return false;
+			++text;     // Skip '<'
+			if (xml_node<ItemType>* child = parse_node<Flags>(text))
+				node->append_node(child);
+			break;
+
+		// End of data - error
+		case ItemType('\0'):
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		// Data node; the character at stop may have been overwritten by its terminator
+		default:
+			next_char = parse_and_append_data<Flags>(node, text, contents_start);
+			if (text >= stop)
+				return text == stop;
+			goto after_data_node;
+
+		}
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_document<ItemType>::skip_node_contents_part(ItemType*& text, ItemType* stop)
+{
+	// Data stops at the next <, so only a child element or closing tag can run over stop
+	while (1)
+	{
+		skip<text_pred, Flags>(text);
+		if (text >= stop)
+			return text == stop;
+		if (*text == ItemType('\0') || text[1] == ItemType('/'))
+			return false;
+		++text;     // Skip '<'
+		skip_node<Flags>(text);
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::parse_node_contents_parallel(ItemType*& text, xml_node<ItemType>* node, unsigned threads)
+{
+#if defined(XPROC_PARALLEL_PARSE)
+	// Find name of the first child element
+	ItemType* end = text + xinternal::measure(text);
+	ItemType* name = text;
+	while (*name && !(name[0] == ItemType('<') && node_name_pred::test(name[1]) && name[1] != ItemType('!')))
+		++name;
+	std::size_t name_size = 0;
+	if (*name)
+	{
+		++name;
+		while (node_name_pred::test(name[name_size]))
+			++name_size;
+	}
+
+	// Guess part boundaries at later occurrences of that name, evenly spaced through the text
+	std::vector<ItemType*> starts(1, text);
+	for (unsigned i = 1; name_size && i < threads; ++i)
+	{
+		ItemType* p = text + (end - text) / threads * i;
+		if (p <= starts.back())
+			continue;
+		for (; p + name_size + 1 < end; ++p)
+			if (p[0] == ItemType('<') && !node_name_pred::test(p[name_size + 1]) && xinternal::compare(p + 1, name_size, name, name_size, true))
+				break;
+		if (p + name_size + 1 >= end)
+			break;
+		starts.push_back(p);
+	}
+	std::size_t parts = starts.size();
+	if (parts == 1)
+	{
+		parse_node_contents<Flags>(text, node);
+		return;
+	}
+
+	// Worker documents own nodes of parts after the first, which go under temporary parents
+	if (m_worker_count < parts - 1)
+	{
+		xml_document<ItemType>** workers = new xml_document<ItemType>*[parts - 1];
+		for (unsigned i = 0; i < parts - 1; ++i)
+			workers[i] = i < m_worker_count ? m_workers[i] : new xml_document<ItemType>;
+		delete[] m_workers;
+		m_workers = workers;
+		m_worker_count = static_cast<unsigned>(parts - 1);
+	}
+	// Text is modified in place unless these flags are set. Parts are then confirmed without writing to the text before
+	// any part is parsed, so that no part writes where another reads, and copied for a retry in one thread should a part fail.
+	// The copy buffer is kept by the document, as page faults of a fresh one cost more than the copy.
+	const int ReadFlags = (Flags & parse_validate_closing_tags) | parse_non_destructive;
+	const bool destructive = !(Flags & parse_no_string_terminators) || !(Flags & parse_no_entity_translation) || (Flags & parse_normalize_whitespace);
+	if (destructive && m_backup_size < static_cast<std::size_t>(end - text))
+	{
+		delete[] m_backup;
+		m_backup = 0;
+		m_backup_size = 0;
+		m_backup = new ItemType[end - text];
+		m_backup_size = end - text;
+	}
+
+	starts.push_back(0);
+	std::vector<xml_node<ItemType>*> parents(parts, node);
+	std::vector<ItemType*> ends(parts, static_cast<ItemType*>(0));
+	std::vector<char> landed(parts, 0);
+	std::vector<char> confirmed(parts, 1);
+
+	// Confirm and copy one part before any part is parsed; reading the text while other parts do the same is safe
+	auto prepare_part = [&](std::size_t i)
+	{
+		ItemType* part_end = starts[i + 1] ? starts[i + 1] : end;
+		if (destructive)
+		{
+			if (starts[i + 1])
+			{
+				try
+				{
+					ItemType* p = starts[i];
+					if (i > 0)
+					{
+						++p;        // Skip '<'
+						skip_node<ReadFlags>(p);
+					}
+					confirmed[i] = skip_node_contents_part<ReadFlags>(p, starts[i + 1]);
+				}
+				catch (...)
+				{
+					confirmed[i] = 0;
+				}
+			}
+			std::memcpy(m_backup + (starts[i] - text), starts[i], (part_end - starts[i]) * sizeof(ItemType));
+		}
+	};
+	auto all_confirmed = [&]()
+	{
+		for (std::size_t i = 0; i < parts; ++i)
+			if (!confirmed[i])
+				return false;
+		return true;
+	};
+
+	// Parse one part; parts read no further than the terminator their predecessor may write at their start
+	auto parse_part = [&](std::size_t i)
+	{
+		try
+		{
+			ItemType* p = starts[i];
+			if (i == 0)
+				landed[i] = parse_node_contents_part<Flags>(p, starts[1], node);
+			else
+			{
+				xml_document<ItemType>* worker = m_workers[i - 1];
+				xml_node<ItemType>* parent = worker->allocate_node(node_element);
+				parent->name(node->name(), node->name_size());      // For closing tag validation
+				parents[i] = parent;
+				++p;        // Skip '<'
+				if (xml_node<ItemType>* child = worker->template parse_node<Flags>(p))
+					parent->append_node(child);
+				if (starts[i + 1])
+					landed[i] = worker->template parse_node_contents_part<Flags>(p, starts[i + 1], parent);
+				else
+				{
+					worker->template parse_node_contents<Flags>(p, parent);
+					landed[i] = 1;
+				}
+				for (xml_node<ItemType>* child = parent->front_node(); child; child = child->m_next_sibling)
+					child->m_parent = node;
+			}
+			ends[i] = p;
+		}
+		catch (...)
+		{
+			landed[i] = 0;
+		}
+	};
+	// Every part is confirmed before any is parsed; each run of the pool returns once all its parts are done
+	if (!m_pool)
+		m_pool = new xinternal::worker_pool;
+	m_pool->run(parts, prepare_part);
+	bool parsed = all_confirmed();
+	if (parsed)
+		m_pool->run(parts, parse_part);
+
+	bool ok = true;
+	for (std::size_t i = 0; i < parts; ++i)
+		ok = ok && landed[i];
+	if (ok)
+	{
+		// Link parts in order; element value comes from the first part with data if still empty
+		for (std::size_t i = 1; i < parts; ++i)
+		{
+			xml_node<ItemType>* parent = parents[i];
+			if (!(Flags & parse_no_element_values) && *node->value() == ItemType('\0') && parent->m_value)
+				node->value(parent->value(), parent->value_size());
+			if (!parent->front_node())
+				continue;
+			if (node->front_node())
+			{
+				node->back_node()->m_next_sibling = parent->front_node();
+				parent->front_node()->m_prev_sibling = node->back_node();
+			}
+			else
+				node->front_node(parent->front_node());
+			node->back_node(parent->back_node());
+
+#if defined(XPROC_INTERN_NAMES)
+			// Workers interned names into their own symbol tables
+			if (Flags & parse_intern_names)
+			{
+				xinternal::symbol_table<ItemType>& symbols = m_workers[i - 1]->m_symbols;
+				std::vector<unsigned> map(symbols.size() + 1, 0);
+				for (unsigned id = 1; id < map.size(); ++id)
+					map[id] = m_symbols.intern(symbols.name(id), symbols.name_size(id));
+				for (xml_node<ItemType>* child = parent->front_node(); ; child = child->m_next_sibling)
+				{
+					map_name_ids(child, &map[0]);
+					if (child == parent->back_node())
+						break;
+				}
+			}
+#endif
+		}
+		text = ends[parts - 1];
+	}
+	else
+	{
+		// A guess was wrong, and text is as it was, or a part failed; restore text and parse again in order
+		if (destructive && parsed)
+			std::memcpy(text, m_backup, (end - text) * sizeof(ItemType));
+		node->remove_all_nodes();
+		node->value(0, 0);
+		parse_node_contents<Flags>(text, node);
+	}
+#else
+	parse_node_contents<Flags>(text, node);
+#endif
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::parse_node_attributes(ItemType*& text, xml_node<ItemType>* node)
+{
+	// For all attributes
+	ItemType* name, *value;
+	std::size_t name_size, value_size;
+	while (scan_attribute<Flags>(text, name, name_size, value, value_size))
+	{
+		// Create new attribute
+		xml_attribute<ItemType>* attribute = this->allocate_attribute();
+		attribute->name(name, name_size);
+		attribute->value(value, value_size);
+#if defined(XPROC_INTERN_NAMES)
+		if (Flags & parse_intern_names)
+			attribute->m_name_id = xcore::name_id(m_symbols.intern(name, name_size));
+#endif
+		node->append_attribute(attribute);
+	}
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+void xml_document<ItemType>::map_name_ids(xml_node<ItemType>* node, const unsigned* map)
+{
+	// Walk the subtree in document order; contents deferred by xflags::parse_lazy have no nodes yet
+	xml_node<ItemType>* root = node;
+	while (1)
+	{
+		node->m_name_id = xcore::name_id(map[node->m_name_id.value()]);
+		for (xml_attribute<ItemType>* attribute = node->front_attribute(); attribute; attribute = attribute->m_next_attribute)
+			attribute->m_name_id = xcore::name_id(map[attribute->m_name_id.value()]);
+		if (node->front_node())
+		{
+			node = node->front_node();
+			continue;
+		}
+		while (node != root && !node->m_next_sibling)
+			node = node->m_parent;
+		if (node == root)
+			return;
+		node = node->m_next_sibling;
+	}
+}
+#endif
+
+template<typename ItemType>
+typename xml_document<ItemType>::parse_func xml_document<ItemType>::find_parse(int flags)
+{
+	// Every combination of run-time flags, instantiated here and filled in once
+	const int Mask = XPROC_RUNTIME_FLAGS;
+	static parse_func table[1 << xinternal::count_flags<Mask>::value];
+	static const bool filled = xinternal::fill_parse_table<xml_document, Mask>(table);
+	(void)filled;
+	if (!(flags & ~Mask))
+		return table[xinternal::parse_table_index(flags, Mask)];
+
+	// Combinations explicitly instantiated below
+	static const struct
+	{
+		int flags;
+		parse_func parse;
+	} instantiated[] =
+	{
+		{ parse_default, &xml_document::template parse<parse_default> },
+		{ parse_non_destructive, &xml_document::template parse<parse_non_destructive> },
+		{ parse_fastest, &xml_document::template parse<parse_fastest> },
+		{ parse_full, &xml_document::template parse<parse_full> },
+		{ parse_no_data_nodes, &xml_document::template parse<parse_no_data_nodes> },
+		{ parse_trim_whitespace, &xml_document::template parse<parse_trim_whitespace> },
+		{ parse_trim_whitespace | parse_normalize_whitespace, &xml_document::template parse<parse_trim_whitespace | parse_normalize_whitespace> },
+		{ parse_validate_closing_tags, &xml_document::template parse<parse_validate_closing_tags> },
+		{ parse_comment_nodes, &xml_document::template parse<parse_comment_nodes> },
+		{ parse_declaration_node, &xml_document::template parse<parse_declaration_node> },
+		{ parse_structural_index, &xml_document::template parse<parse_structural_index> },
+		{ parse_structural_index | parse_non_destructive, &xml_document::template parse<parse_structural_index | parse_non_destructive> },
+		{ parse_structural_index | parse_full, &xml_document::template parse<parse_structural_index | parse_full> },
+		{ parse_structural_index | parse_trim_whitespace | parse_normalize_whitespace, &xml_document::template parse<parse_structural_index | parse_trim_whitespace | parse_normalize_whitespace> },
+		{ parse_lazy, &xml_document::template parse<parse_lazy> },
+		{ parse_lazy | parse_non_destructive, &xml_document::template parse<parse_lazy | parse_non_destructive> },
+		{ parse_lazy | parse_full, &xml_document::template parse<parse_lazy | parse_full> },
+		{ parse_intern_names, &xml_document::template parse<parse_intern_names> },
+		{ parse_intern_names | parse_non_destructive, &xml_document::template parse<parse_intern_names | parse_non_destructive> },
+		{ parse_intern_names | parse_lazy, &xml_document::template parse<parse_intern_names | parse_lazy> },
+		{ parse_presize, &xml_document::template parse<parse_presize> },
+		{ parse_presize | parse_non_destructive, &xml_document::template parse<parse_presize | parse_non_destructive> },
+		{ parse_presize | parse_full, &xml_document::template parse<parse_presize | parse_full> }
+	};
+	for (std::size_t i = 0; i < sizeof(instantiated) / sizeof(instantiated[0]); ++i)
+		if (instantiated[i].flags == flags)
+			return instantiated[i].parse;
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Streaming parsing functions
+
+template<typename ItemType>
+template<int Flags>
+xml_node<ItemType>* xml_document<ItemType>::parse_markup(ItemType*& text, xml_node<ItemType>* open, int& step)
+{
+	step = 0;
+
+	// Closing tag of open element
+	if (text[0] == ItemType('/') && open)
+	{
+		++text;     // Skip '/'
+		parse_closing_tag<Flags>(text, open);
+		step = -1;
+		return open;
+	}
+
+	// Declaration, PI, comment, CDATA or DOCTYPE
+	if (text[0] == ItemType('?') || text[0] == ItemType('!'))
+		return parse_node<Flags>(text);
+
+	// Start tag; contents are left to the caller
+	xml_node<ItemType>* element = this->allocate_node(node_element);
+	if (parse_start_tag<Flags>(text, element))
+		step = 1;
+
+	// Place zero terminator after name
+	if (!(Flags & parse_no_string_terminators))
+		element->name()[element->name_size()] = ItemType('\0');
+	return element;
+}
+
+template<typename ItemType>
+template<int Flags>
+xml_node<ItemType>* xml_document<ItemType>::parse_text(ItemType*& text, ItemType* contents_start)
+{
+	xml_node<ItemType>* data;
+	parse_data<Flags>(text, contents_start, data);
+	return data;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline ItemType xml_document<ItemType>::parse_data(ItemType*& text, ItemType* contents_start, xml_node<ItemType>*& data)
+{
+	// Parse into a data node of a scratch parent, whatever the flags say about data nodes
+	xml_node<ItemType>* parent = this->allocate_node(node_element);
+	ItemType end = parse_and_append_data<(Flags & ~parse_no_data_nodes) | parse_no_element_values>(parent, text, contents_start);
+	data = parent->first_node();
+	return end;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Scanning functions
+
+template<typename ItemType>
+template<int Flags>
+inline std::size_t xml_document<ItemType>::scan_element_name(ItemType*& text)
+{
+	// Extract element name
+	ItemType* name = text;
+	skip<node_name_pred, Flags>(text);
+	if (text == name)
+		RAPIDXML_PARSE_ERROR("expected element name", text);
+	std::size_t size = text - name;
+
+	// Skip whitespace between element name and attributes or >
+	skip<whitespace_pred, Flags>(text);
+	return size;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::scan_attribute(ItemType*& text, ItemType*& name, std::size_t& name_size, ItemType*& value, std::size_t& value_size)
+{
+	// Attributes end at / or >
+	if (!attribute_name_pred::test(*text))
+		return false;
+
+	// Extract attribute name
+	name = text;
+	++text;     // Skip first character of attribute name
+	skip<attribute_name_pred, Flags>(text);
+	name_size = text - name;
+
+	// Skip whitespace after attribute name
+	skip<whitespace_pred, Flags>(text);
+
+	// Skip =
+	if (*text != ItemType('='))
+		RAPIDXML_PARSE_ERROR("expected =", text);
+	++text;
+
+	// Add terminating zero after name
+	if (!(Flags & parse_no_string_terminators))
+		name[name_size] = ItemType('\0');
+
+	// Skip whitespace after =
+	skip<whitespace_pred, Flags>(text);
+
+	// Skip quote and remember if it was ' or "
+	ItemType quote = *text;
+	if (quote != ItemType('\'') && quote != ItemType('"'))
+		RAPIDXML_PARSE_ERROR("expected ' or \"", text);
+	++text;
+
+	// Const text has no terminator to stop the scan
+	if (Flags & parse_const_input && !const_occurs(text, quote))
+		RAPIDXML_PARSE_ERROR("expected ' or \"", m_const_end);
+
+	// Extract attribute value and expand char refs in it
+	value = text;
+	ItemType* end;
+	const int AttFlags = Flags & ~parse_normalize_whitespace;   // No whitespace normalization in attributes
+	if (quote == ItemType('\''))
+		end = skip_and_expand_character_refs<attribute_value_pred<ItemType('\'')>, attribute_value_pure_pred<ItemType('\'')>, AttFlags>(text, value);
+	else
+		end = skip_and_expand_character_refs<attribute_value_pred<ItemType('"')>, attribute_value_pure_pred<ItemType('"')>, AttFlags>(text, value);
+	value_size = end - value;
+
+	// Make sure that end quote is present
+	if (*text != quote)
+		RAPIDXML_PARSE_ERROR("expected ' or \"", text);
+	++text;     // Skip quote
+
+	// Add terminating zero after value
+	if (!(Flags & parse_no_string_terminators))
+		value[value_size] = ItemType('\0');
+
+	// Skip whitespace after attribute value
+	skip<whitespace_pred, Flags>(text);
+	return true;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::scan_tag_end(ItemType*& text)
+{
+	// Empty element has no contents
+	if (*text == ItemType('/'))
+	{
+		++text;
+		if (*text != ItemType('>'))
+			RAPIDXML_PARSE_ERROR("expected >", text);
+		++text;
+		return false;
+	}
+	if (*text != ItemType('>'))
+		RAPIDXML_PARSE_ERROR("expected >", text);
+	++text;
+	return true;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::scan_closing_tag(ItemType*& text, const ItemType* name, std::size_t name_size)
+{
+	if (Flags & parse_validate_closing_tags)
+	{
+		// Skip and validate closing tag name
+		ItemType* closing_name = text;
+		skip<node_name_pred, Flags>(text);
+		if (!xinternal::compare(name, name_size, closing_name, text - closing_name, true))
+			RAPIDXML_PARSE_ERROR("invalid closing tag name", text);
+	}
+	else
+	{
+		// No validation, just skip name
+		skip<node_name_pred, Flags>(text);
+	}
+	// Skip remaining whitespace after node name
+	skip<whitespace_pred, Flags>(text);
+	if (*text != ItemType('>'))
+		RAPIDXML_PARSE_ERROR("expected >", text);
+	++text;     // Skip '>'
+}
+
+template<typename ItemType>
+template<int Flags>
+inline ItemType* xml_document<ItemType>::scan_data(ItemType*& text, ItemType* contents_start, ItemType*& value)
+{
+	// Backup to contents start if whitespace trimming is disabled
+	if (!(Flags & parse_trim_whitespace))
+		text = contents_start;
+
+	// Const text has no terminator to stop the scan
+	if (Flags & parse_const_input && !const_occurs(text, ItemType('<')))
+		RAPIDXML_PARSE_ERROR("unexpected end of data", m_const_end);
+
+	// Skip until end of data
+	value = text;
+	ItemType* end;
+	if (Flags & parse_normalize_whitespace)
+		end = skip_and_expand_character_refs<text_pred, text_pure_with_ws_pred, Flags>(text, value);
+	else
+		end = skip_and_expand_character_refs<text_pred, text_pure_no_ws_pred, Flags>(text, value);
+
+	// Trim trailing whitespace if flag is set; leading was already trimmed by whitespace skip after >
+	if (Flags & parse_trim_whitespace)
+	{
+		if (Flags & parse_normalize_whitespace)
+		{
+			// Whitespace is already condensed to single space characters by skipping function, so just trim 1 char off the end
+			if (*(end - 1) == ItemType(' '))
+				--end;
+		}
+		else
+		{
+			// Backup until non-whitespace character is found
+			while (end != value && whitespace_pred::test(*(end - 1)))
+				--end;
+		}
+	}
+	return end;
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::skip_start_tag(ItemType*& text)
+{
+	skip<node_name_pred, Flags>(text);
+	skip<whitespace_pred, Flags>(text);
+	return skip_attributes<Flags>(text);
+}
+
+template<typename ItemType>
+template<int Flags>
+inline bool xml_document<ItemType>::skip_attributes(ItemType*& text)
+{
+	// Attributes are checked as by scan_attribute(), but their values are not expanded
+	while (attribute_name_pred::test(*text))
+	{
+		++text;     // Skip first character of attribute name
+		skip<attribute_name_pred, Flags>(text);
+		skip<whitespace_pred, Flags>(text);
+		if (*text != ItemType('='))
+			RAPIDXML_PARSE_ERROR("expected =", text);
+		++text;
+		skip<whitespace_pred, Flags>(text);
+		ItemType quote = *text;
+		if (quote != ItemType('\'') && quote != ItemType('"'))
+			RAPIDXML_PARSE_ERROR("expected ' or \"", text);
+		++text;
+		if (quote == ItemType('\''))
+			skip<attribute_value_pred<ItemType('\'')>, Flags>(text);
+		else
+			skip<attribute_value_pred<ItemType('"')>, Flags>(text);
+		if (*text != quote)
+			RAPIDXML_PARSE_ERROR("expected ' or \"", text);
+		++text;     // Skip quote
+		skip<whitespace_pred, Flags>(text);
+	}
+	return scan_tag_end<Flags>(text);
+}
+
+template<typename ItemType>
+template<int Flags>
+inline void xml_document<ItemType>::skip_children(ItemType*& text)
+{
+	// Count depth of nested elements, up to the closing tag at depth 0
+	std::size_t depth = 0;
+	while (1)
+	{
+		// Skip text up to next node
+		skip<text_pred, Flags>(text);
+		if (*text == 0)
+			RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+
+		switch (text[1])
+		{
+
+		// </...
+		case ItemType('/'):
+			if (depth-- == 0)
+				return;
+			while (*text != ItemType('>'))
+			{
+				if (*text == 0)
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+			++text;
+			break;
+
+		// <?...?>
+		case ItemType('?'):
+			text += 2;      // Skip '<?'
+			while (text[0] != ItemType('?') || text[1] != ItemType('>'))
+			{
+				if (*text == 0)
+					RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+				++text;
+			}
+			text += 2;      // Skip '?>'
+			break;
+
+		// <!...
+		case ItemType('!'):
+			if (text[2] == ItemType('-') && text[3] == ItemType('-'))
+			{
+				// Comment
+				text += 4;      // Skip '<!--'
+				while (text[0] != ItemType('-') || text[1] != ItemType('-') || text[2] != ItemType('>'))
+				{
+					if (*text == 0)
+						RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+					++text;
+				}
+				text += 3;      // Skip '-->'
+			}
+			else if (text[2] == ItemType('[') && text[3] == ItemType('C') && text[4] == ItemType('D') &&
+					text[5] == ItemType('A') && text[6] == ItemType('T') && text[7] == ItemType('A') && text[8] == ItemType('['))
+			{
+				// CDATA
+				text += 9;      // Skip '<![CDATA['
+				while (text[0] != ItemType(']') || text[1] != ItemType(']') || text[2] != ItemType('>'))
+				{
+					if (*text == 0)
+						RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+					++text;
+				}
+				text += 3;      // Skip ']]>'
+			}
+			else
+			{
+				// Other node, ends at first >
+				while (*text != ItemType('>'))
+				{
+					if (*text == 0)
+						RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+					++text;
+				}
+				++text;
+			}
+			break;
+
+		// Start tag, which opens an element unless it ends with />
+		default:
+			++text;     // Skip '<'
+			if (skip_start_tag<Flags>(text))
+				++depth;
+			break;
+
+		}
+	}
+}
+
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::skip_contents(ItemType*& text, const ItemType* name, std::size_t name_size)
+{
+	skip_children<Flags>(text);
+	text += 2;      // Skip '</'
+	scan_closing_tag<Flags>(text, name, name_size);
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_document<ItemType>::skip_node(ItemType*& text)
+{
+	// Declaration, PI, comment, CDATA or DOCTYPE, without a node whatever the flags say
+	if (text[0] == ItemType('?') || text[0] == ItemType('!'))
+	{
+		parse_node<(Flags & ~(parse_declaration_node | parse_comment_nodes | parse_doctype_node | parse_pi_nodes)) | parse_no_data_nodes>(text);
+		return;
+	}
+
+	// Element, with its contents
+	ItemType* name = text;
+	if (skip_start_tag<Flags>(text))
+	{
+		ItemType* name_end = name;
+		if (Flags & parse_validate_closing_tags)
+			skip<node_name_pred, Flags>(name_end);
+		skip_contents<Flags>(text, name, name_end - name);
+	}
+}
+
+// Explicit instantiations
+template class xml_document<char>;
+
+template void xml_document<char>::parse<parse_default>(char*);
+template void xml_document<char>::parse<parse_non_destructive>(char*);
+template void xml_document<char>::parse<parse_fastest>(char*);
+template void xml_document<char>::parse<parse_full>(char*);
+template void xml_document<char>::parse<parse_no_data_nodes>(char*);
+template void xml_document<char>::parse<parse_trim_whitespace>(char*);
+template void xml_document<char>::parse<parse_trim_whitespace | parse_normalize_whitespace>(char*);
+template void xml_document<char>::parse<parse_validate_closing_tags>(char*);
+template void xml_document<char>::parse<parse_comment_nodes>(char*);
+template void xml_document<char>::parse<parse_declaration_node>(char*);
+template void xml_document<char>::parse<parse_structural_index>(char*);
+template void xml_document<char>::parse<parse_structural_index | parse_non_destructive>(char*);
+template void xml_document<char>::parse<parse_structural_index | parse_full>(char*);
+template void xml_document<char>::parse<parse_structural_index | parse_trim_whitespace | parse_normalize_whitespace>(char*);
+template void xml_document<char>::parse<parse_lazy>(char*);
+template void xml_document<char>::parse<parse_lazy | parse_non_destructive>(char*);
+template void xml_document<char>::parse<parse_lazy | parse_full>(char*);
+template void xml_document<char>::parse<parse_intern_names>(char*);
+template void xml_document<char>::parse<parse_intern_names | parse_non_destructive>(char*);
+template void xml_document<char>::parse<parse_intern_names | parse_lazy>(char*);
+template void xml_document<char>::parse<parse_presize>(char*);
+template void xml_document<char>::parse<parse_presize | parse_non_destructive>(char*);
+template void xml_document<char>::parse<parse_presize | parse_full>(char*);
+
+template void xml_document<char>::parse<parse_default>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_non_destructive>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_fastest>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_full>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_no_data_nodes>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_trim_whitespace>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_trim_whitespace | parse_normalize_whitespace>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_intern_names>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_intern_names | parse_non_destructive>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_presize>(const char*, std::size_t);
+template void xml_document<char>::parse<parse_presize | parse_non_destructive>(const char*, std::size_t);
+
+template void xml_document<char>::parse_parallel<parse_default>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_non_destructive>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_fastest>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_full>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_trim_whitespace | parse_normalize_whitespace>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_intern_names>(char*, unsigned);
+template void xml_document<char>::parse_parallel<parse_lazy>(char*, unsigned);
+
+// Used by xml_reader<char>::next()
+template xml_node<char>* xml_document<char>::parse_markup<parse_default>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_non_destructive>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_fastest>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_full>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_no_data_nodes>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_trim_whitespace>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_trim_whitespace | parse_normalize_whitespace>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_validate_closing_tags>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_comment_nodes>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_markup<parse_declaration_node>(char*&, xml_node<char>*, int&);
+template xml_node<char>* xml_document<char>::parse_text<parse_default>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_non_destructive>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_fastest>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_full>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_no_data_nodes>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_trim_whitespace>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_trim_whitespace | parse_normalize_whitespace>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_validate_closing_tags>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_comment_nodes>(char*&, char*);
+template xml_node<char>* xml_document<char>::parse_text<parse_declaration_node>(char*&, char*);
+
+// Used by xml_tape<char>::parse()
+template char xml_document<char>::parse_data<parse_default>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_non_destructive>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_fastest>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_full>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_no_data_nodes>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_trim_whitespace>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_trim_whitespace | parse_normalize_whitespace>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_validate_closing_tags>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_comment_nodes>(char*&, char*, xml_node<char>*&);
+template char xml_document<char>::parse_data<parse_declaration_node>(char*&, char*, xml_node<char>*&);
+
+// Used by xml_extractor<char>::extract() and xml_binder<char>
+template std::size_t xml_document<char>::scan_element_name<parse_no_string_terminators>(char*&);
+template std::size_t xml_document<char>::scan_element_name<parse_non_destructive>(char*&);
+template std::size_t xml_document<char>::scan_element_name<parse_no_string_terminators | parse_trim_whitespace>(char*&);
+template std::size_t xml_document<char>::scan_element_name<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&);
+template std::size_t xml_document<char>::scan_element_name<parse_no_string_terminators | parse_validate_closing_tags>(char*&);
+template bool xml_document<char>::scan_attribute<parse_no_string_terminators>(char*&, char*&, std::size_t&, char*&, std::size_t&);
+template bool xml_document<char>::scan_attribute<parse_non_destructive>(char*&, char*&, std::size_t&, char*&, std::size_t&);
+template bool xml_document<char>::scan_attribute<parse_no_string_terminators | parse_trim_whitespace>(char*&, char*&, std::size_t&, char*&, std::size_t&);
+template bool xml_document<char>::scan_attribute<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&, char*&, std::size_t&, char*&, std::size_t&);
+template bool xml_document<char>::scan_attribute<parse_no_string_terminators | parse_validate_closing_tags>(char*&, char*&, std::size_t&, char*&, std::size_t&);
+template bool xml_document<char>::scan_tag_end<parse_no_string_terminators>(char*&);
+template bool xml_document<char>::scan_tag_end<parse_non_destructive>(char*&);
+template bool xml_document<char>::scan_tag_end<parse_no_string_terminators | parse_trim_whitespace>(char*&);
+template bool xml_document<char>::scan_tag_end<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&);
+template bool xml_document<char>::scan_tag_end<parse_no_string_terminators | parse_validate_closing_tags>(char*&);
+template void xml_document<char>::scan_closing_tag<parse_no_string_terminators>(char*&, const char*, std::size_t);
+template void xml_document<char>::scan_closing_tag<parse_non_destructive>(char*&, const char*, std::size_t);
+template void xml_document<char>::scan_closing_tag<parse_no_string_terminators | parse_trim_whitespace>(char*&, const char*, std::size_t);
+template void xml_document<char>::scan_closing_tag<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&, const char*, std::size_t);
+template void xml_document<char>::scan_closing_tag<parse_no_string_terminators | parse_validate_closing_tags>(char*&, const char*, std::size_t);
+template char* xml_document<char>::scan_data<parse_no_string_terminators>(char*&, char*, char*&);
+template char* xml_document<char>::scan_data<parse_non_destructive>(char*&, char*, char*&);
+template char* xml_document<char>::scan_data<parse_no_string_terminators | parse_trim_whitespace>(char*&, char*, char*&);
+template char* xml_document<char>::scan_data<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&, char*, char*&);
+template char* xml_document<char>::scan_data<parse_no_string_terminators | parse_validate_closing_tags>(char*&, char*, char*&);
+template bool xml_document<char>::skip_start_tag<parse_no_string_terminators>(char*&);
+template bool xml_document<char>::skip_start_tag<parse_non_destructive>(char*&);
+template bool xml_document<char>::skip_start_tag<parse_no_string_terminators | parse_trim_whitespace>(char*&);
+template bool xml_document<char>::skip_start_tag<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&);
+template bool xml_document<char>::skip_start_tag<parse_no_string_terminators | parse_validate_closing_tags>(char*&);
+template bool xml_document<char>::skip_attributes<parse_no_string_terminators>(char*&);
+template bool xml_document<char>::skip_attributes<parse_non_destructive>(char*&);
+template bool xml_document<char>::skip_attributes<parse_no_string_terminators | parse_trim_whitespace>(char*&);
+template bool xml_document<char>::skip_attributes<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&);
+template bool xml_document<char>::skip_attributes<parse_no_string_terminators | parse_validate_closing_tags>(char*&);
+template void xml_document<char>::skip_contents<parse_no_string_terminators>(char*&, const char*, std::size_t);
+template void xml_document<char>::skip_contents<parse_non_destructive>(char*&, const char*, std::size_t);
+template void xml_document<char>::skip_contents<parse_no_string_terminators | parse_trim_whitespace>(char*&, const char*, std::size_t);
+template void xml_document<char>::skip_contents<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&, const char*, std::size_t);
+template void xml_document<char>::skip_contents<parse_no_string_terminators | parse_validate_closing_tags>(char*&, const char*, std::size_t);
+template void xml_document<char>::skip_node<parse_no_string_terminators>(char*&);
+template void xml_document<char>::skip_node<parse_non_destructive>(char*&);
+template void xml_document<char>::skip_node<parse_no_string_terminators | parse_trim_whitespace>(char*&);
+template void xml_document<char>::skip_node<parse_no_string_terminators | parse_trim_whitespace | parse_normalize_whitespace>(char*&);
+template void xml_document<char>::skip_node<parse_no_string_terminators | parse_validate_closing_tags>(char*&);
+
+} /* namespace xcore */
+} /* namespace xprocesser */
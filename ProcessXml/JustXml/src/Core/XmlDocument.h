@@ -0,0 +1,395 @@
+/*
+ * XmlDocument.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLDOCUMENT_H_
+#define SRC_CORE_XMLDOCUMENT_H_
+
+#include "XmlNode.h"
+#include "MemoryPool.h"
+#include "ParseError.h"
+#include "Internal/ProcessFlags.h"
+#include "Internal/StructuralIndex.h"
+#include "Internal/SymbolTable.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<class ItemType> class xml_reader;
+template<class ItemType> class xml_tape;
+template<class ItemType> class xml_extractor;
+template<class ItemType> class xml_binder;
+
+namespace xinternal
+{
+class worker_pool;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// XML document
+
+//! This class represents root of the DOM hierarchy.
+//! It is also an xml_node and a memory_pool through public inheritance.
+//! Use parse() function to build a DOM tree from a zero-terminated XML text string.
+//! parse() function allocates memory for nodes and attributes by using functions of xml_document,
+//! which are inherited from memory_pool.
+//! To access root node of the document, use the document itself, as if it was an xml_node.
+//! <br><br>
+//! parse() is a member template defined in XmlDocument.cpp, so only the Flags combinations
+//! explicitly instantiated at the bottom of that file are available to the linker.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_document: public xml_node<ItemType>, public memory_pool<ItemType>
+{
+	friend class xml_node<ItemType>;
+	friend class xml_reader<ItemType>;
+	friend class xml_tape<ItemType>;
+	friend class xml_extractor<ItemType>;
+	friend class xml_binder<ItemType>;
+
+public:
+
+	//! Constructs empty XML document
+	xml_document();
+
+	//! Destroys document, memory pools of parallel parsing workers and their threads
+	~xml_document();
+
+
+	//! Parses zero-terminated XML string according to given flags.
+	//! Passed string will be modified by the parser, unless xflags::parse_non_destructive flag is used.
+	//! The string must persist for the lifetime of the document.
+	//! In case of error, parse_error exception will be thrown.
+	//! <br><br>
+	//! If you want to parse contents of a file, you must first load the file into the memory, and pass pointer to its beginning.
+	//! Make sure that data is zero-terminated.
+	//! <br><br>
+	//! With <code>XPROC_COMPACT_NODES</code> defined, text may be at most 2 GB long, including the terminator.
+	//! <br><br>
+	//! xflags::parse_presize is applied only with <code>XPROC_COMPACT_NODES</code> defined; without it, the flag is ignored.
+	//! <br><br>
+	//! Document can be parsed into multiple times.
+	//! Each new call to parse removes previous nodes and attributes (if any), but does not clear memory pool.
+	//! <br><br>
+	//! xflags::parse_structural_index is experimental and slower than parsing without it, see its description.
+	//! \param text XML data to parse; pointer is non-const to denote fact that this data may be modified by the parser.
+	template<int Flags>
+	void parse(ItemType*);
+
+
+	//! Parses zero-terminated XML string according to flags given at run time, for example read from configuration.
+	//! Call is dispatched through a table to the instantiation of parse<Flags>() for these flags,
+	//! so parsing is as fast as with flags given at compile time; text and document are treated as by that function.
+	//! Every combination of flags in <code>XPROC_RUNTIME_FLAGS</code> is available, by default of
+	//! xflags::parse_non_destructive, xflags::parse_comment_nodes, xflags::parse_validate_closing_tags,
+	//! xflags::parse_trim_whitespace and xflags::parse_normalize_whitespace, which make 32 combinations.
+	//! Other combinations are available if parse<Flags>() is explicitly instantiated for them at the bottom of XmlDocument.cpp.
+	//! If flags are not available, parse_error exception will be thrown before parsing starts.
+	//! \param text XML data to parse; pointer is non-const to denote fact that this data may be modified by the parser.
+	//! \param flags Flags to parse with.
+	void parse(ItemType*, int);
+
+
+	//! Checks whether flags are available to parse(ItemType*, int), so that flags from configuration can be validated up front.
+	//! \param flags Flags to check.
+	//! \return True if text can be parsed with these flags.
+	static bool parse_available(int);
+
+
+	//! Parses XML text of given size according to given flags, without modifying it.
+	//! Text need not be zero-terminated; it may be read-only, for example a memory mapped file or a string literal.
+	//! As with xflags::parse_non_destructive, names and values point into the text and are not zero-terminated,
+	//! so use xml_base::name_size() and xml_base::value_size() to determine their ends.
+	//! Values which need entity translation or whitespace normalization are decoded into the memory pool instead;
+	//! all other values stay in the text, which must persist for the lifetime of the document.
+	//! With <code>XPROC_COMPACT_NODES</code> defined, text may be at most 2 GB long.
+	//! Flags xflags::parse_structural_index and xflags::parse_lazy are ignored.
+	//! In case of error, parse_error exception will be thrown.
+	//! \param text XML data to parse.
+	//! \param size Size of data, in characters; a zero character ends the data before that, and nothing after it is parsed.
+	template<int Flags>
+	void parse(const ItemType*, std::size_t);
+
+
+	//! Parses zero-terminated XML string like parse(), using several threads.
+	//! Contents of the first top level element are split in front of its child elements.
+	//! The parts are parsed in parallel into memory pools of worker documents owned by this document,
+	//! and their nodes are then linked under the element in document order.
+	//! The resulting tree is identical to the one built by parse() with the same flags, and so are errors.
+	//! <br><br>
+	//! Split points are guessed at later occurrences of the name of the first child element,
+	//! and each guess is confirmed by the part before it ending exactly there.
+	//! Parts are first confirmed by skipping their children without writing to the text, so that parts are only
+	//! parsed once none of them overlaps another; if a guess proves wrong, contents are parsed in one thread instead.
+	//! Parts are run on threads kept by the document, which are started by the first parse that needs them
+	//! and wait between parses until the document is destroyed.
+	//! Threads beyond the hardware threads only add the cost of confirming and linking parts:
+	//! on one core, with 2 to 32 threads, the 64 MB catalog of BenchParallel parses at 0.6 to 0.8 times the speed of parse()
+	//! with xflags::parse_default, and at about its speed, within noise, with xflags::parse_non_destructive.
+	//! Speedup on several cores has not been measured.
+	//! Without C++11 threads, if exceptions are disabled, or with <code>XPROC_COMPACT_NODES</code>, this function parses in one thread.
+	//! Flags xflags::parse_structural_index and xflags::parse_presize are ignored.
+	//! \param text XML data to parse; pointer is non-const to denote fact that this data may be modified by the parser.
+	//! \param threads Number of threads to use, including the calling thread.
+	template<int Flags>
+	void parse_parallel(ItemType*, unsigned);
+
+
+	//! Clears the document by deleting all nodes and clearing the memory pool.
+	//! All nodes owned by document pool, or by pools of parallel parsing workers, are destroyed.
+	//! Symbol table is emptied, so identifiers of interned names become invalid.
+	void clear();
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets identifier of name in the symbol table of the document, adding the name if it is not there yet.
+	//! Parsing with xflags::parse_intern_names gives elements and attributes identifiers from the same table,
+	//! so that names can be resolved once, before or after parsing, and then looked up by comparing identifiers.
+	//! Name is copied into the table; identifiers stay valid over further parses, until clear() is called.
+	//! \param name Name to intern; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \return Identifier of name.
+	xcore::name_id intern_name(const ItemType*, std::size_t = 0);
+#endif
+
+
+private:
+
+	///////////////////////////////////////////////////////////////////////
+	// Internal character utility functions
+
+	// Character class predicates, see XmlDocument.cpp
+	struct whitespace_pred;
+	struct node_name_pred;
+	struct attribute_name_pred;
+	struct text_pred;
+	struct text_pure_no_ws_pred;
+	struct text_pure_with_ws_pred;
+	template<ItemType Quote> struct attribute_value_pred;
+	template<ItemType Quote> struct attribute_value_pure_pred;
+
+	// Insert coded character, using UTF8 or 8-bit ASCII
+	template<int Flags>
+	static void insert_coded_character(ItemType*&, unsigned long);
+
+	// Skip characters until predicate evaluates to true
+	template<class StopPred, int Flags>
+	void skip(ItemType*&);
+
+	// Skip characters until predicate evaluates to true while doing the following:
+	// - replacing XML character entity references with proper characters (&apos; &amp; &quot; &lt; &gt; &#...;)
+	// - condensing whitespace sequences to single space character
+	// With xflags::parse_const_input, value start is moved to a copy in memory pool if modification is needed
+	template<class StopPred, class StopPredPure, int Flags>
+	ItemType* skip_and_expand_character_refs(ItemType*&, ItemType*&);
+
+	// Check if scan for end of markup must stop with unexpected end of data:
+	// at zero terminator, or at the last character of const text, where no end sequence can start
+	template<int Flags>
+	bool scan_end(const ItemType*) const;
+
+	// Check if character occurs at or after position before end of const text; character must be <, ' or "
+	bool const_occurs(const ItemType*, ItemType);
+
+	// Move to the end sequence of given length which closes a comment, CDATA section or processing instruction,
+	// found in the index of xflags::parse_structural_index; returns false without moving if there is no index
+	template<int Flags>
+	bool skip_indexed_markup(ItemType*&, int);
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Internal parsing functions
+
+	// Size memory pool for nodes and attributes estimated from text of given size, see xflags::parse_presize
+	void presize_pool(const ItemType*, std::size_t);
+
+	// Parse BOM, if any
+	template<int Flags>
+	void parse_bom(ItemType*&);
+
+	// Parse XML declaration (<?xml...)
+	template<int Flags>
+	xml_node<ItemType>* parse_xml_declaration(ItemType*&);
+
+	// Parse XML comment (<!--...)
+	template<int Flags>
+	xml_node<ItemType>* parse_comment(ItemType*&);
+
+	// Parse DOCTYPE
+	template<int Flags>
+	xml_node<ItemType>* parse_doctype(ItemType*&);
+
+	// Parse PI
+	template<int Flags>
+	xml_node<ItemType>* parse_pi(ItemType*&);
+
+	// Parse and append data
+	// Return character that ends data.
+	// This is necessary because this character might have been overwritten by a terminating 0
+	template<int Flags>
+	ItemType parse_and_append_data(xml_node<ItemType>*, ItemType*&, ItemType*);
+
+	// Parse CDATA
+	template<int Flags>
+	xml_node<ItemType>* parse_cdata(ItemType*&);
+
+	// Parse element name, attributes and end of start tag
+	// Return true if > was found and contents follow, false for empty element
+	template<int Flags>
+	bool parse_start_tag(ItemType*&, xml_node<ItemType>*);
+
+	// Parse closing tag of node, after </
+	template<int Flags>
+	void parse_closing_tag(ItemType*&, xml_node<ItemType>*);
+
+	// Parse element node
+	template<int Flags>
+	xml_node<ItemType>* parse_element(ItemType*&);
+
+	// Determine node type, and parse it
+	template<int Flags>
+	xml_node<ItemType>* parse_node(ItemType*&);
+
+	// Parse contents of the node - children, data etc.
+	template<int Flags>
+	void parse_node_contents(ItemType*&, xml_node<ItemType>*);
+
+#if defined(XPROC_LAZY_CONTENTS)
+	// Find end of contents of the node and defer their parsing, see xflags::parse_lazy
+	template<int Flags>
+	void skip_node_contents(ItemType*&, xml_node<ItemType>*);
+
+	// Parse contents of the node deferred by skip_node_contents()
+	template<int Flags>
+	void parse_deferred_contents(xml_node<ItemType>*);
+
+	// Parse deferred contents of the node according to flags of the last parse()
+	void parse_lazy_contents(xml_node<ItemType>*);
+#endif
+
+	// Parse contents of the node up to stop, which must be in front of a child element.
+	// Returns false if a child element or closing tag extends over stop.
+	template<int Flags>
+	bool parse_node_contents_part(ItemType*&, ItemType*, xml_node<ItemType>*);
+
+	// Skip contents of a node up to stop like parse_node_contents_part(), without writing to the text or building nodes
+	template<int Flags>
+	bool skip_node_contents_part(ItemType*&, ItemType*);
+
+	// Parse contents of the node using several threads
+	template<int Flags>
+	void parse_node_contents_parallel(ItemType*&, xml_node<ItemType>*, unsigned);
+
+	// Parse XML attributes of the node
+	template<int Flags>
+	void parse_node_attributes(ItemType*&, xml_node<ItemType>*);
+
+#if defined(XPROC_INTERN_NAMES)
+	// Replace identifiers of names in subtree of node, and in its attributes, by their entries in map
+	static void map_name_ids(xml_node<ItemType>*, const unsigned*);
+#endif
+
+	// Instantiation of parse() for flags given at run time
+	typedef void (xml_document::*parse_func)(ItemType*);
+
+	// Find instantiation of parse() for flags given at run time, or return 0 if there is none
+	static parse_func find_parse(int);
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Streaming parsing functions, used by xml_reader and xml_tape
+
+	// Parse markup after <: start or closing tag, or any other node parse_node() recognizes.
+	// Closing tag is matched against open element, which is returned for it.
+	// Step receives 1 after start tag with contents, -1 after closing tag and 0 otherwise.
+	template<int Flags>
+	xml_node<ItemType>* parse_markup(ItemType*&, xml_node<ItemType>*, int&);
+
+	// Parse text up to < or zero terminator into a data node, regardless of parse_no_data_nodes
+	template<int Flags>
+	xml_node<ItemType>* parse_text(ItemType*&, ItemType*);
+
+	// Parse text like parse_text(), and return its data node in the last argument.
+	// Return character that ends text, which might have been overwritten by a terminating 0
+	template<int Flags>
+	ItemType parse_data(ItemType*&, ItemType*, xml_node<ItemType>*&);
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Scanning functions, which parse markup without creating nodes; used by parsing functions above, xml_extractor and xml_binder
+
+	// Skip element name, and whitespace after it, and return size of name
+	template<int Flags>
+	std::size_t scan_element_name(ItemType*&);
+
+	// Parse attribute and expand character references in its value, placing terminators if flags say so.
+	// Return false, without moving text, if no attribute name follows.
+	template<int Flags>
+	bool scan_attribute(ItemType*&, ItemType*&, std::size_t&, ItemType*&, std::size_t&);
+
+	// Parse end of start tag; return true if > was found and contents follow, false for empty element
+	template<int Flags>
+	bool scan_tag_end(ItemType*&);
+
+	// Parse closing tag after </, validating it against name of element if flags say so
+	template<int Flags>
+	void scan_closing_tag(ItemType*&, const ItemType*, std::size_t);
+
+	// Parse text up to < or zero terminator into value, and return its end; no terminator is placed
+	template<int Flags>
+	ItemType* scan_data(ItemType*&, ItemType*, ItemType*&);
+
+	// Skip start tag after <, without expanding attribute values; return true if contents follow
+	template<int Flags>
+	bool skip_start_tag(ItemType*&);
+
+	// Skip attributes and end of start tag, like skip_start_tag() after element name and whitespace
+	template<int Flags>
+	bool skip_attributes(ItemType*&);
+
+	// Skip contents of element, leaving text at < of its closing tag
+	template<int Flags>
+	void skip_children(ItemType*&);
+
+	// Skip contents of element and its closing tag, validated against name of element if flags say so
+	template<int Flags>
+	void skip_contents(ItemType*&, const ItemType*, std::size_t);
+
+	// Skip node after <: element with its contents, or any other markup
+	template<int Flags>
+	void skip_node(ItemType*&);
+
+	xinternal::structural_index<ItemType> m_structural_index;     // Used with xflags::parse_structural_index
+	xml_document<ItemType>** m_workers;                           // Documents owning nodes from parse_parallel() workers
+	unsigned m_worker_count;                                      // Number of worker documents
+	xinternal::worker_pool* m_pool;                               // Threads of parse_parallel(), 0 until needed
+	ItemType* m_backup;                                           // Copy of text for parse_parallel() to restore after a wrong split
+	std::size_t m_backup_size;                                    // Size of copy buffer
+#if defined(XPROC_LAZY_CONTENTS)
+	void (xml_document::*m_parse_lazy)(xml_node<ItemType>*);      // Parser of deferred contents, set by parse() with xflags::parse_lazy
+#endif
+	ItemType* m_const_begin;                                      // Start of text of const parse()
+	ItemType* m_const_end;                                        // Past the last > of text of const parse(); no scan goes further
+	ItemType* m_const_last[3];                                    // Past the last <, ' and " before m_const_end, or m_const_begin if none; 0 until needed
+#if defined(XPROC_INTERN_NAMES)
+	xinternal::symbol_table<ItemType> m_symbols;                  // Interned names, see xflags::parse_intern_names
+#endif
+};
+
+#if defined(XPROC_COMPACT_NODES)
+template<class ItemType>
+inline const char* xml_node<ItemType>::cage() const
+{
+	return m_type == node_document ? static_cast<const xml_document<ItemType>*>(this)->m_cage : xinternal::cage_of(this);
+}
+#endif
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLDOCUMENT_H_ */
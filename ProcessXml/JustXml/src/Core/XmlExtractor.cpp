@@ -0,0 +1,235 @@
+/*
+ * XmlExtractor.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlExtractor.h"
+
+#include "Internal/CoreAlgorithms.h"
+#include "Internal/LookupTables.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+template<typename ItemType>
+const std::size_t xml_extractor<ItemType>::none;
+
+template<typename ItemType>
+xml_extractor<ItemType>::xml_extractor()
+: m_states(0)
+  , m_state_capacity(0)
+  , m_path_count(0)
+{
+	clear();
+}
+
+template<typename ItemType>
+xml_extractor<ItemType>::~xml_extractor()
+{
+	delete[] m_states;
+}
+
+template<typename ItemType>
+std::size_t xml_extractor<ItemType>::add(const ItemType* path, std::size_t size)
+{
+	assert(path);
+	if (size == 0)
+		size = xinternal::measure(path);
+	const ItemType* end = path + size;
+
+	// Check the whole path first, so that an error leaves states unchanged
+	const ItemType* start = path;
+	if (start != end && *start == ItemType('/'))
+		++start;
+	if (start != end && *start == ItemType('@'))
+		RAPIDXML_PARSE_ERROR("expected element name", const_cast<ItemType*>(start));
+	xinternal::path_tree<ItemType>::check(start, end);
+
+	// Follow states of the path from the document, adding the missing ones with no results
+	std::size_t count = m_paths.size();
+	std::size_t current = m_paths.add(0, start, end);
+	xinternal::grow_array(m_states, count, m_state_capacity, m_paths.size(), 16);
+	for (std::size_t i = count; i < m_paths.size(); ++i)
+	{
+		m_states[i].result = none;
+		m_states[i].results = m_states[i].pending = 0;
+	}
+
+	// New path gets the next result, counted in its state and all above it
+	if (m_states[current].result == none)
+	{
+		m_states[current].result = m_path_count++;
+		for (std::size_t index = current; index != none; index = m_paths[index].parent)
+			++m_states[index].results;
+	}
+	return m_states[current].result;
+}
+
+template<typename ItemType>
+void xml_extractor<ItemType>::clear()
+{
+	// Only the document remains
+	m_path_count = 0;
+	m_paths.clear();
+	xinternal::grow_array(m_states, 0, m_state_capacity, 1, 16);
+	m_states[0].result = none;
+	m_states[0].results = m_states[0].pending = 0;
+}
+
+template<typename ItemType>
+template<int Flags>
+std::size_t xml_extractor<ItemType>::extract(ItemType* text, result* results)
+{
+	assert(text && (results || !m_path_count));
+
+	// Nothing is placed in the text but expanded values, and no node is created
+	const int ExtractFlags = (Flags & (parse_no_entity_translation | parse_no_utf8 | parse_trim_whitespace |
+			parse_normalize_whitespace | parse_validate_closing_tags)) | parse_no_string_terminators;
+
+	// All paths are pending
+	for (std::size_t i = 0; i < m_path_count; ++i)
+	{
+		results[i].value = 0;
+		results[i].size = 0;
+	}
+	for (std::size_t i = 0; i < m_paths.size(); ++i)
+		m_states[i].pending = m_states[i].results;
+	if (!m_path_count)
+		return 0;
+
+	// Skip UTF-8 BOM
+	if (static_cast<unsigned char>(text[0]) == 0xEF &&
+			static_cast<unsigned char>(text[1]) == 0xBB &&
+			static_cast<unsigned char>(text[2]) == 0xBF)
+		text += 3;
+
+	// State of the innermost open element, which is on a path, or the document
+	std::size_t current = 0;
+	while (m_states[0].pending)
+	{
+		// Skip whitespace before node
+		ItemType* contents_start = text;
+		while (xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+			++text;
+
+		// End of text
+		if (*text == ItemType('\0'))
+		{
+			if (current)
+				RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+			break;
+		}
+
+		// Text, which is only allowed inside elements; the first one is value of the element
+		if (*text != ItemType('<'))
+		{
+			if (!current)
+				RAPIDXML_PARSE_ERROR("expected <", text);
+			ItemType* value;
+			ItemType* end = m_document.template scan_data<ExtractFlags>(text, contents_start, value);
+			if (m_states[current].result != none && !results[m_states[current].result].value)
+				found(current, results, value, end - value);
+			continue;
+		}
+		++text;     // Skip '<'
+
+		// Closing tag of open element; element without text has empty value
+		if (*text == ItemType('/') && current)
+		{
+			++text;     // Skip '/'
+			m_document.template scan_closing_tag<ExtractFlags>(text, m_paths.name(current), m_paths[current].name_size);
+			if (m_states[current].result != none && !results[m_states[current].result].value)
+				found(current, results, text, 0);
+			current = m_paths[current].parent;
+			continue;
+		}
+
+		// Declaration, PI, comment, CDATA or DOCTYPE
+		if (*text == ItemType('?') || *text == ItemType('!'))
+		{
+			m_document.template skip_node<ExtractFlags>(text);
+			continue;
+		}
+
+		// Start tag of element; element on no path with values pending is skipped with its contents
+		ItemType* name = text;
+		std::size_t name_size = m_document.template scan_element_name<ExtractFlags>(text);
+		std::size_t next = m_paths.find(m_paths[current].first_child, name, name_size);
+		if (next == none || !m_states[next].pending)
+		{
+			text = name;
+			m_document.template skip_node<ExtractFlags>(text);
+			continue;
+		}
+
+		// Attributes, which are expanded only if some is on a path
+		const state& element = m_states[next];
+		bool contents;
+		if (m_paths[next].first_attribute == none)
+		{
+			text = name;
+			contents = m_document.template skip_start_tag<ExtractFlags>(text);
+		}
+		else
+		{
+			ItemType* attribute_name, *value;
+			std::size_t attribute_name_size, value_size;
+			while (m_document.template scan_attribute<ExtractFlags>(text, attribute_name, attribute_name_size, value, value_size))
+			{
+				std::size_t attribute = m_paths.find(m_paths[next].first_attribute, attribute_name, attribute_name_size);
+				if (attribute != none && m_states[attribute].pending)
+				{
+					found(attribute, results, value, value_size);
+					if (!m_states[0].pending)
+						return m_path_count;
+				}
+			}
+			contents = m_document.template scan_tag_end<ExtractFlags>(text);
+		}
+
+		// Contents are entered only while something in them is pending
+		if (!contents)
+		{
+			if (element.result != none && !results[element.result].value)
+				found(next, results, text, 0);
+		}
+		else if (element.pending)
+			current = next;
+		else
+			m_document.template skip_contents<ExtractFlags>(text, m_paths.name(next), m_paths[next].name_size);
+	}
+	return m_path_count - m_states[0].pending;
+}
+
+template<typename ItemType>
+void xml_extractor<ItemType>::found(std::size_t index, result* results, ItemType* value, std::size_t size)
+{
+	result& target = results[m_states[index].result];
+	target.value = value;
+	target.size = size;
+	for (; index != none; index = m_paths[index].parent)
+		--m_states[index].pending;
+}
+
+// Explicit instantiations
+template class xml_extractor<char>;
+
+template std::size_t xml_extractor<char>::extract<parse_default>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_non_destructive>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_fastest>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_full>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_no_data_nodes>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_trim_whitespace>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_trim_whitespace | parse_normalize_whitespace>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_validate_closing_tags>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_comment_nodes>(char*, result*);
+template std::size_t xml_extractor<char>::extract<parse_declaration_node>(char*, result*);
+
+} /* namespace xcore */
+} /* namespace xprocesser */
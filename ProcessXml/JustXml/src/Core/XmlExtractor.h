@@ -0,0 +1,120 @@
+/*
+ * XmlExtractor.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLEXTRACTOR_H_
+#define SRC_CORE_XMLEXTRACTOR_H_
+
+#include "XmlDocument.h"
+#include "Internal/PathTree.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+///////////////////////////////////////////////////////////////////////////
+// XML extractor
+
+//! This class pulls values of a set of paths out of XML text in one pass, without building a DOM tree.
+//! Register paths once with add(), then run extract() over any number of texts;
+//! each run writes pointer and size of the value of every path into an array supplied by the caller,
+//! and returns as soon as all paths are found, without reading the rest of the text.
+//! <br><br>
+//! A path is a sequence of element names from the document, separated by <code>/</code>,
+//! optionally ending with an attribute: <code>/order/customer/name</code> or <code>/order/\@id</code>.
+//! A path selects the first such element or attribute in document order, as xml_query::first() would.
+//! Value of an element is its first data node, as xml_node::value() after parse(), or empty if the element has none.
+//! Names are compared case-sensitively, without resolving namespace prefixes.
+//! <br><br>
+//! Paths are merged into a tree of states, one per element name along them.
+//! Elements which do not continue any path, or whose paths are all found, are skipped with their contents,
+//! without expanding their attributes or text. No node is created and no memory is allocated during extract().
+//! <br><br>
+//! extract() is a member template defined in XmlExtractor.cpp, so only the Flags combinations
+//! explicitly instantiated at the bottom of that file are available to the linker.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_extractor
+{
+public:
+
+	//! Value of a path
+	struct result
+	{
+		ItemType* value;            //!< Start of value in the text, or 0 if path was not found
+		std::size_t size;           //!< Size of value, in characters
+	};
+
+	//! Constructs extractor with no paths
+	xml_extractor();
+
+	//! Destroys extractor
+	~xml_extractor();
+
+
+	//! Adds path to extract.
+	//! In case of error, parse_error exception will be thrown, pointing into the path, and no path is added.
+	//! \param path Path to add; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of path, in characters, or 0 to have size calculated automatically from string
+	//! \return Index of result of the path; a path added again gets the index it got before.
+	std::size_t add(const ItemType*, std::size_t = 0);
+
+	//! Removes all paths.
+	void clear();
+
+	//! Gets number of results of extract(), one for each distinct path added.
+	//! \return Number of paths.
+	std::size_t size() const
+	{
+		return m_path_count;
+	}
+
+
+	//! Extracts values of all paths from zero-terminated XML string according to given flags.
+	//! Passed string will be modified, as by xml_document::parse(), unless xflags::parse_non_destructive flag is used;
+	//! values point into it and are not zero-terminated.
+	//! Text after the last value found is not read, nor checked for errors.
+	//! Flags other than xflags::parse_no_entity_translation, xflags::parse_no_utf8, xflags::parse_trim_whitespace,
+	//! xflags::parse_normalize_whitespace and xflags::parse_validate_closing_tags have no effect.
+	//! In case of error, parse_error exception will be thrown, and results are undefined.
+	//! \param text XML data to extract from; pointer is non-const to denote fact that this data may be modified.
+	//! \param results Array of size() results, indexed as returned by add().
+	//! \return Number of paths found.
+	template<int Flags>
+	std::size_t extract(ItemType*, result*);
+
+private:
+
+	// Index standing for no state or no result
+	static const std::size_t none = xinternal::path_tree<ItemType>::none;
+
+	// Results of element or attribute along paths, indexed as its state in m_paths
+	struct state
+	{
+		std::size_t result;             // Index of result of path ending here, or none
+		std::size_t results;            // Number of results in this state and below
+		std::size_t pending;            // Number of those not found yet, during extract()
+	};
+
+	// Restrictive copy constructor and assignment operator
+	xml_extractor(const xml_extractor&);
+	void operator=(const xml_extractor&);
+
+	// Store value of state, and count it as found in it and its ancestors
+	void found(std::size_t, result*, ItemType*, std::size_t);
+
+	xml_document<ItemType> m_document;          // Scanning functions, which create no nodes
+	xinternal::path_tree<ItemType> m_paths;     // Names along paths, with the document as root
+	state* m_states;                            // Results of states of m_paths
+	std::size_t m_state_capacity;               // States allocated in m_states
+	std::size_t m_path_count;                   // Number of results
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLEXTRACTOR_H_ */
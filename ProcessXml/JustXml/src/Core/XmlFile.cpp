@@ -0,0 +1,159 @@
+/*
+ * XmlFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlFile.h"
+
+// File loading needs the standard library
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdio>       // For std::FILE, std::fopen, std::fread
+#include <cstring>      // For std::memcpy
+#include <stdexcept>    // For std::runtime_error
+
+// Memory mapping
+#if defined(__unix__) || defined(__APPLE__) || defined(__CYGWIN__)
+#define XPROC_FILE_MMAP
+#include <fcntl.h>      // For open
+#include <sys/mman.h>   // For mmap, madvise
+#include <sys/stat.h>   // For fstat
+#include <unistd.h>     // For close, sysconf
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<typename ItemType>
+xml_file<ItemType>::xml_file(const char* filename, file_mode mode)
+: m_data(0)
+  , m_size(0)
+  , m_mode(mode)
+  , m_mapping(0)
+  , m_mapping_size(0)
+  , m_buffer(0)
+{
+	assert(filename);
+
+#if defined(XPROC_FILE_MMAP)
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		error("cannot open file");
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		error("cannot read file");
+	}
+	std::size_t bytes = static_cast<std::size_t>(info.st_size);
+
+	// Empty files cannot be mapped, and neither can special files
+	if (bytes != 0 && S_ISREG(info.st_mode))
+	{
+		if (mode == file_read_only)
+		{
+			m_mapping_size = bytes;
+			void* mapping = mmap(0, m_mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (mapping != MAP_FAILED)
+				m_mapping = mapping;
+		}
+		else
+		{
+			// Reserve zeroed memory one page longer than the file, and map the file over its start.
+			// Zero terminator then lies in the rest of the last page of the file, or in the reserved page after it.
+			std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+			m_mapping_size = (bytes + page - 1) / page * page + page;
+			void* mapping = mmap(0, m_mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (mapping != MAP_FAILED)
+			{
+				if (mmap(mapping, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED)
+					m_mapping = mapping;
+				else
+					munmap(mapping, m_mapping_size);
+			}
+		}
+	}
+	close(fd);
+
+	if (m_mapping)
+	{
+		// Parser reads the text front to back, once
+#if defined(MADV_SEQUENTIAL)
+		madvise(m_mapping, bytes, MADV_SEQUENTIAL);
+#endif
+#if defined(MADV_HUGEPAGE)
+		madvise(m_mapping, bytes, MADV_HUGEPAGE);
+#endif
+		m_data = static_cast<ItemType*>(m_mapping);
+		m_size = bytes / sizeof(ItemType);
+		return;
+	}
+#endif
+
+	read(filename);
+}
+
+template<typename ItemType>
+xml_file<ItemType>::~xml_file()
+{
+#if defined(XPROC_FILE_MMAP)
+	if (m_mapping)
+		munmap(m_mapping, m_mapping_size);
+#endif
+	delete[] m_buffer;
+}
+
+template<typename ItemType>
+void xml_file<ItemType>::read(const char* filename)
+{
+	std::FILE* file = std::fopen(filename, "rb");
+	if (!file)
+		error("cannot open file");
+
+	// Read in blocks until end of file, since size of special files is not known in advance
+	std::size_t capacity = 64 * 1024;
+	m_buffer = new ItemType[capacity + 1];
+	while (1)
+	{
+		m_size += std::fread(m_buffer + m_size, sizeof(ItemType), capacity - m_size, file);
+		if (m_size != capacity)
+			break;
+		ItemType* buffer = new ItemType[capacity * 2 + 1];
+		std::memcpy(buffer, m_buffer, m_size * sizeof(ItemType));
+		delete[] m_buffer;
+		m_buffer = buffer;
+		capacity *= 2;
+	}
+	bool failed = std::ferror(file) != 0;
+	std::fclose(file);
+	if (failed)
+	{
+		delete[] m_buffer;
+		m_buffer = 0;
+		error("cannot read file");
+	}
+
+	m_buffer[m_size] = ItemType('\0');
+	m_data = m_buffer;
+}
+
+template<typename ItemType>
+void xml_file<ItemType>::error(const char* what)
+{
+#if defined(RAPIDXML_NO_EXCEPTIONS)
+	RAPIDXML_PARSE_ERROR(what, 0);
+#else
+	throw std::runtime_error(what);
+#endif
+}
+
+// Explicit instantiations
+template class xml_file<char>;
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* !defined(XPROC_NO_STDLIB) */
@@ -0,0 +1,111 @@
+/*
+ * XmlFile.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLFILE_H_
+#define SRC_CORE_XMLFILE_H_
+
+#include "XmlDocument.h"
+
+// File loading needs the standard library
+#if !defined(XPROC_NO_STDLIB)
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+//! Ways of loading a file by xml_file
+enum file_mode
+{
+	file_read_only,         //!< Text is read-only and not zero-terminated; parse it with xml_document::parse(const ItemType*, std::size_t).
+	file_copy_on_write      //!< Text is writable and zero-terminated, for xml_document::parse(ItemType*); changes never reach the file.
+};
+
+///////////////////////////////////////////////////////////////////////////
+// XML file
+
+//! This class loads contents of a file for parsing.
+//! Where memory mapping is available (POSIX systems and Cygwin), the file is mapped instead of copied,
+//! so its pages are read by the kernel on first access and shared with the page cache.
+//! The mapping is advised for sequential access and, where the system supports it, for huge pages.
+//! Elsewhere, or if mapping fails, the file is read into a heap buffer.
+//! <br><br>
+//! In read-only mode any flags can be used, because the const overload of parse() decodes
+//! values which need modification into the memory pool of the document.
+//! Copy-on-write mode maps the file privately, so only pages modified by the parser are copied.
+//! Parsing in place modifies nearly every page, so this mode then costs about as much as reading the file into a buffer;
+//! the mapping pays with xflags::parse_non_destructive, or in read-only mode (see test/bench/BenchFile.cpp).
+//! <br><br>
+//! Nodes point into the text, so the file must persist for the lifetime of the document.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_file
+{
+public:
+
+	//! Loads file.
+	//! If file cannot be opened or read, std::runtime_error is thrown, or parse_error if exceptions are disabled.
+	//! \param filename Name of file to load.
+	//! \param mode Whether text has to be writable and zero-terminated.
+	explicit xml_file(const char*, file_mode = file_read_only);
+
+	//! Unmaps or frees the text.
+	~xml_file();
+
+
+	//! Gets text of the file.
+	//! \return Pointer to text, zero-terminated in copy-on-write mode.
+	ItemType* data() const
+	{
+		return m_data;
+	}
+
+	//! Gets size of the file.
+	//! \return Size of text in characters, not including terminator.
+	std::size_t size() const
+	{
+		return m_size;
+	}
+
+
+	//! Parses text of the file into document according to given flags, using the parse() overload which fits the mode.
+	//! \param document Document to parse into.
+	template<int Flags>
+	void parse(xml_document<ItemType>& document) const
+	{
+		if (m_mode == file_read_only)
+			document.template parse<Flags>(static_cast<const ItemType*>(m_data), m_size);
+		else
+			document.template parse<Flags>(m_data);
+	}
+
+private:
+
+	// Restrictive copy constructor and assignment operator
+	xml_file(const xml_file&);
+	void operator=(const xml_file&);
+
+	// Read file into a zero-terminated heap buffer
+	void read(const char*);
+
+	// Report failure to open or read the file
+	static void error(const char*);
+
+	ItemType* m_data;                   // Text of the file
+	std::size_t m_size;                 // Size of text, in characters
+	file_mode m_mode;                   // Mode the file was loaded in
+	void* m_mapping;                    // Start of mapped memory, or 0 if text is in m_buffer
+	std::size_t m_mapping_size;         // Size of mapped memory, in bytes
+	ItemType* m_buffer;                 // Heap buffer holding text if it is not mapped
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* !defined(XPROC_NO_STDLIB) */
+
+#endif /* SRC_CORE_XMLFILE_H_ */
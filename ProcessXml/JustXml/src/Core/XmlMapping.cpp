@@ -0,0 +1,246 @@
+/*
+ * XmlMapping.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlMapping.h"
+
+#include "Internal/CoreAlgorithms.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstring>      // For std::memcpy
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+template<typename ItemType>
+const std::size_t xml_mapping<ItemType>::none;
+
+template<typename ItemType>
+xml_mapping<ItemType>::xml_mapping()
+: m_path(0)
+  , m_path_names(0)
+  , m_path_size(0)
+  , m_states(0)
+  , m_state_capacity(0)
+  , m_record(0)
+{
+	clear();
+}
+
+template<typename ItemType>
+xml_mapping<ItemType>::~xml_mapping()
+{
+	delete[] m_path;
+	delete[] m_path_names;
+	delete[] m_states;
+}
+
+template<typename ItemType>
+void xml_mapping<ItemType>::record(const ItemType* path, std::size_t size)
+{
+	assert(path);
+	if (size == 0)
+		size = xinternal::measure(path);
+	const ItemType* end = path + size;
+
+	// Check the whole path first, so that an error leaves the record unchanged
+	const ItemType* start = path;
+	if (start != end && *start == ItemType('/'))
+		++start;
+	std::size_t names = 1;
+	for (const ItemType* text = start; ; ++text)
+	{
+		const ItemType* name = text;
+		while (text != end && *text != ItemType('/') && *text != ItemType('@'))
+			++text;
+		if (text == name)
+			RAPIDXML_PARSE_ERROR("expected name", const_cast<ItemType*>(text));
+		if (text == end)
+			break;
+		if (*text != ItemType('/'))
+			RAPIDXML_PARSE_ERROR("expected /", const_cast<ItemType*>(text));
+		++names;
+	}
+
+	// Names refer to a copy of path
+	ItemType* copy = new ItemType[size];
+	std::memcpy(copy, path, size * sizeof(ItemType));
+	delete[] m_path;
+	m_path = copy;
+	delete[] m_path_names;
+	m_path_names = new std::size_t[names * 2];
+	m_path_size = 0;
+	for (const ItemType* text = start; ; ++text)
+	{
+		const ItemType* name = text;
+		while (text != end && *text != ItemType('/'))
+			++text;
+		m_path_names[m_path_size * 2] = name - path;
+		m_path_names[m_path_size * 2 + 1] = text - name;
+		++m_path_size;
+		if (text == end)
+			break;
+	}
+}
+
+template<typename ItemType>
+void xml_mapping<ItemType>::add(const ItemType* path, std::size_t size, std::size_t offset, converter convert)
+{
+	assert(path && convert);
+	if (size == 0)
+		size = xinternal::measure(path);
+	const ItemType* end = path + size;
+
+	// Check the whole path first, so that an error leaves states unchanged
+	bool itself = size == 1 && *path == ItemType('.');
+	if (!itself)
+		xinternal::path_tree<ItemType>::check(path, end);
+
+	// Follow states of the path from the record, adding the missing ones with no members
+	std::size_t count = m_paths.size();
+	std::size_t current = itself ? 0 : m_paths.add(0, path, end);
+	xinternal::grow_array(m_states, count, m_state_capacity, m_paths.size(), 16);
+	for (std::size_t i = count; i < m_paths.size(); ++i)
+	{
+		m_states[i].convert = 0;
+		m_states[i].offset = 0;
+		m_states[i].record = m_record;
+	}
+
+	state& member = m_states[current];
+	member.convert = convert;
+	member.offset = offset;
+}
+
+template<typename ItemType>
+void xml_mapping<ItemType>::clear()
+{
+	// Only the record remains, which is the root element
+	m_path_size = 0;
+	m_paths.clear();
+	xinternal::grow_array(m_states, 0, m_state_capacity, 1, 16);
+	m_states[0].convert = 0;
+	m_states[0].offset = 0;
+	m_states[0].record = m_record;
+}
+
+template<typename ItemType>
+template<int Flags>
+std::size_t xml_mapping<ItemType>::map_records(ItemType* text, records& target, std::size_t limit)
+{
+	assert(text);
+	target.count = 0;
+	m_binder.template begin<Flags>(text);
+	if (on_path(0))
+		find_records<Flags>(0, target, limit);
+	return target.count;
+}
+
+template<typename ItemType>
+template<int Flags>
+bool xml_mapping<ItemType>::find_records(std::size_t depth, records& target, std::size_t limit)
+{
+	// Record, which gets the next object
+	if (depth + 1 >= m_path_size)
+	{
+		++m_record;
+		char* object = static_cast<char*>(target.object(target.objects, target.count));
+		map_element<Flags>(0, object);
+		return ++target.count == limit;
+	}
+
+	// Elements on the record path are entered, others are skipped
+	if (m_binder.template enter<Flags>())
+		while (m_binder.template next_element<Flags>())
+		{
+			if (!on_path(depth + 1))
+				m_binder.template skip<Flags>();
+			else if (find_records<Flags>(depth + 1, target, limit))
+				return true;
+		}
+	return false;
+}
+
+template<typename ItemType>
+bool xml_mapping<ItemType>::on_path(std::size_t depth) const
+{
+	if (!m_path_size)
+		return true;
+	return xinternal::compare(m_binder.name(), m_binder.name_size(), m_path + m_path_names[depth * 2], m_path_names[depth * 2 + 1], true);
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_mapping<ItemType>::map_element(std::size_t index, char* object)
+{
+	// Attributes, which are expanded only if some is mapped
+	state& element = m_states[index];
+	const typename xinternal::path_tree<ItemType>::state& path = m_paths[index];
+	if (path.first_attribute != none)
+		while (m_binder.template next_attribute<Flags>())
+		{
+			std::size_t attribute = m_paths.find(path.first_attribute, m_binder.name(), m_binder.name_size());
+			if (attribute != none)
+				map_value(m_states[attribute], object, m_binder.value(), m_binder.value_size());
+		}
+
+	// Element with no states below has only its value read, if it is mapped
+	if (path.first_child == none)
+	{
+		if (element.convert)
+		{
+			m_binder.template read_value<Flags>();
+			map_value(element, object, m_binder.value(), m_binder.value_size());
+		}
+		else
+			m_binder.template skip<Flags>();
+		return;
+	}
+
+	// Child elements on no path are skipped with their contents
+	if (m_binder.template enter<Flags>())
+		while (m_binder.template next_element<Flags>())
+		{
+			std::size_t child = m_paths.find(path.first_child, m_binder.name(), m_binder.name_size());
+			if (child == none)
+				m_binder.template skip<Flags>();
+			else
+				map_element<Flags>(child, object);
+		}
+	map_value(element, object, m_binder.value(), m_binder.value_size());
+}
+
+template<typename ItemType>
+void xml_mapping<ItemType>::map_value(state& member, char* object, const ItemType* value, std::size_t size)
+{
+	if (!member.convert || member.record == m_record)
+		return;
+	member.record = m_record;
+	member.convert(value, size, object + member.offset);
+}
+
+// Explicit instantiations
+template class xml_mapping<char>;
+
+template std::size_t xml_mapping<char>::map_records<parse_default>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_non_destructive>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_fastest>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_full>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_no_data_nodes>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_trim_whitespace>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_trim_whitespace | parse_normalize_whitespace>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_validate_closing_tags>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_comment_nodes>(char*, records&, std::size_t);
+template std::size_t xml_mapping<char>::map_records<parse_declaration_node>(char*, records&, std::size_t);
+
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,221 @@
+/*
+ * XmlMapping.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLMAPPING_H_
+#define SRC_CORE_XMLMAPPING_H_
+
+#include "XmlBinder.h"
+#include "Internal/PathTree.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <vector>       // For std::vector
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+///////////////////////////////////////////////////////////////////////////
+// XML mapping
+
+//! This class maps XML text onto C++ objects in one pass, without building a DOM tree and without generated code.
+//! Register once the path of the record element and, for each member of interest, its path within the record;
+//! then run map() over any number of texts, into one object or into a std::vector of them:
+//! <pre>
+//! xml_mapping<> mapping;
+//! mapping.record("/order/item");
+//! mapping.add("\@sku", &Item::sku);
+//! mapping.add("quantity", &Item::quantity);
+//! mapping.add("price/\@currency", &Item::currency);
+//! mapping.map<0>(text, items);                // One Item for each item element of the order
+//! </pre>
+//! Record path is a sequence of element names from the document, separated by <code>/</code>.
+//! Member path is a sequence of element names from the record, optionally ending with an attribute,
+//! or <code>.</code> for value of the record itself. Value of an element is its first data node, as xml_node::value() after parse(),
+//! or empty if the element has none; it is converted with convert_value(), or with a converter given to add().
+//! If a path occurs more than once in a record, the first occurrence is mapped. Names are compared case-sensitively.
+//! <br><br>
+//! Paths are merged into a tree of states when they are added, so reading a record follows states by the names found,
+//! and elements and attributes on no path are skipped with their contents, without expanding them.
+//! No node is created, and no memory is allocated except by converters and by the objects.
+//! <br><br>
+//! map() calls a member template defined in XmlMapping.cpp, so only the Flags combinations
+//! explicitly instantiated at the bottom of that file are available to the linker.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_mapping
+{
+public:
+
+	//! Function converting value to a member
+	//! \param value Text to convert; this string isn't zero-terminated.
+	//! \param size Size of text, in characters.
+	//! \param member Member to store converted value in.
+	typedef void (*converter)(const ItemType*, std::size_t, void*);
+
+	//! Constructs mapping with no members; the record is the root element, whatever its name.
+	xml_mapping();
+
+	//! Destroys mapping
+	~xml_mapping();
+
+
+	//! Sets path of record elements, which members are mapped from.
+	//! In case of error, parse_error exception will be thrown, pointing into the path, and the record is unchanged.
+	//! \param path Path of record; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of path, in characters, or 0 to have size calculated automatically from string
+	void record(const ItemType*, std::size_t = 0);
+
+	//! Adds member to map, converted by given function; a path added again is mapped to the member added last.
+	//! In case of error, parse_error exception will be thrown, pointing into the path, and no member is added.
+	//! \param path Path of member in record; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of path, in characters, or 0 to have size calculated automatically from string
+	//! \param offset Offset of member in object, in bytes.
+	//! \param convert Function converting value to the member.
+	void add(const ItemType*, std::size_t, std::size_t, converter);
+
+	//! Adds member to map, converted by convert_value().
+	//! In case of error, parse_error exception will be thrown, pointing into the path, and no member is added.
+	//! \param path Zero-terminated path of member in record.
+	//! \param member Pointer to member; object must be default-constructible.
+	template<class Object, class Value>
+	void add(const ItemType* path, Value Object::* member)
+	{
+		Object probe;
+		add(path, 0, reinterpret_cast<const char*>(&(probe.*member)) - reinterpret_cast<const char*>(&probe), &convert_member<Value>);
+	}
+
+	//! Removes all members, and makes the root element the record again, whatever its name.
+	void clear();
+
+
+	//! Maps the first record of zero-terminated XML string according to given flags into object.
+	//! Object is assigned a default-constructed one before its members are mapped; it is unchanged if there is no record.
+	//! Text after the record is not read, nor checked for errors.
+	//! Passed string will be modified, as by xml_document::parse(), unless xflags::parse_non_destructive flag is used.
+	//! Flags other than xflags::parse_no_entity_translation, xflags::parse_no_utf8, xflags::parse_trim_whitespace,
+	//! xflags::parse_normalize_whitespace and xflags::parse_validate_closing_tags have no effect.
+	//! In case of error, parse_error exception will be thrown, and the object may be partly mapped.
+	//! \param text XML data to map; pointer is non-const to denote fact that this data may be modified.
+	//! \param object Object to map the record into.
+	//! \return True if record was found.
+	template<int Flags, class Object>
+	bool map(ItemType* text, Object& object)
+	{
+		records target = { &object, &single_record<Object>, 0 };
+		return map_records<Flags>(text, target, 1) != 0;
+	}
+
+#if !defined(XPROC_NO_STDLIB)
+	//! Maps all records of zero-terminated XML string according to given flags into vector, in document order.
+	//! Objects the vector has are reused, each assigned a default-constructed one before its members are mapped,
+	//! and further ones are appended, so a vector reserved or filled before maps records without allocating.
+	//! Vector is then resized to the number of records.
+	//! Passed string will be modified, as by xml_document::parse(), unless xflags::parse_non_destructive flag is used.
+	//! In case of error, parse_error exception will be thrown, and objects of the vector may be partly mapped.
+	//! \param text XML data to map; pointer is non-const to denote fact that this data may be modified.
+	//! \param objects Vector to map records into.
+	//! \return Number of records.
+	template<int Flags, class Object>
+	std::size_t map(ItemType* text, std::vector<Object>& objects)
+	{
+		records target = { &objects, &vector_record<Object>, 0 };
+		std::size_t count = map_records<Flags>(text, target, none);
+		objects.resize(count);
+		return count;
+	}
+#endif
+
+private:
+
+	// Index standing for no state, and for no limit of records
+	static const std::size_t none = xinternal::path_tree<ItemType>::none;
+
+	// Member of element or attribute along paths, indexed as its state in m_paths
+	struct state
+	{
+		converter convert;              // Converter of member mapped from here, or 0
+		std::size_t offset;             // Offset of the member in object
+		std::size_t record;             // Number of the last record the member was mapped in, during map()
+	};
+
+	// Objects records are mapped into, seen through a function of their type
+	struct records
+	{
+		void* objects;
+		void* (*object)(void*, std::size_t);    // Default object for record of given index
+		std::size_t count;                      // Number of records mapped
+	};
+
+	// Restrictive copy constructor and assignment operator
+	xml_mapping(const xml_mapping&);
+	void operator=(const xml_mapping&);
+
+	// Convert value to member of given type
+	template<class Value>
+	static void convert_member(const ItemType* value, std::size_t size, void* member)
+	{
+		convert_value(value, size, *static_cast<Value*>(member));
+	}
+
+	// Reset object, which is the only record
+	template<class Object>
+	static void* single_record(void* objects, std::size_t)
+	{
+		Object& object = *static_cast<Object*>(objects);
+		object = Object();
+		return &object;
+	}
+
+#if !defined(XPROC_NO_STDLIB)
+	// Reset object of vector for record of given index, appending it if needed
+	template<class Object>
+	static void* vector_record(void* objects, std::size_t index)
+	{
+		std::vector<Object>& vector = *static_cast<std::vector<Object>*>(objects);
+		if (index < vector.size())
+			vector[index] = Object();
+		else
+			vector.push_back(Object());
+		return &vector[index];
+	}
+#endif
+
+	// Map records, at most given number, into objects; return number of records
+	template<int Flags>
+	std::size_t map_records(ItemType*, records&, std::size_t);
+
+	// Map records within current element, which is at given depth of record path; return true when limit is reached
+	template<int Flags>
+	bool find_records(std::size_t, records&, std::size_t);
+
+	// Check whether current element is at given depth of record path
+	bool on_path(std::size_t) const;
+
+	// Map current element, of given state, into object
+	template<int Flags>
+	void map_element(std::size_t, char*);
+
+	// Map value to member of state, unless it was mapped in this record
+	void map_value(state&, char*, const ItemType*, std::size_t);
+
+	xml_binder<ItemType> m_binder;              // Reader of text
+	ItemType* m_path;                           // Copy of record path
+	std::size_t* m_path_names;                  // Offset of each name of record path in m_path, followed by its size
+	std::size_t m_path_size;                    // Number of names in record path, or 0 for any root element
+	xinternal::path_tree<ItemType> m_paths;     // Names along member paths, with the record as root
+	state* m_states;                            // Members of states of m_paths
+	std::size_t m_state_capacity;               // States allocated in m_states
+	std::size_t m_record;                       // Number of the current record, during map()
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLMAPPING_H_ */
@@ -0,0 +1,442 @@
+/*
+ * XmlNode.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlNode.h"
+
+#include "XmlDocument.h"
+#include "Internal/CoreAlgorithms.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<typename ItemType>
+xml_document<ItemType>* xml_node<ItemType>::document() const
+{
+	xml_node<ItemType>* node = const_cast<xml_node<ItemType>*>(this);
+	while (node->parent())
+		node = node->parent();
+	return node->type() == node_document ? static_cast<xml_document<ItemType>*>(node) : 0;
+}
+
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::first_node(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	expand_contents();
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		if (case_sensitive)
+			if (xinternal::child_index<ItemType>* index = lookup_index())
+				return index->first(name, name_size);
+		for (xml_node<ItemType>* child = front_node(); child; child = child->m_next_sibling)
+			if (xinternal::compare(child->name(), child->name_size(), name, name_size, case_sensitive))
+				return child;
+		return 0;
+	}
+	else
+		return front_node();
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::first_node(xcore::name_id id) const
+{
+	expand_contents();
+	for (xml_node<ItemType>* child = front_node(); child; child = child->m_next_sibling)
+		if (child->m_name_id == id)
+			return child;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::last_node(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	expand_contents();
+	assert(front_node());  // Cannot query for last child if node has no children
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		if (case_sensitive)
+			if (xinternal::child_index<ItemType>* index = lookup_index())
+				return index->last(name, name_size);
+		for (xml_node<ItemType>* child = back_node(); child; child = child->m_prev_sibling)
+			if (xinternal::compare(child->name(), child->name_size(), name, name_size, case_sensitive))
+				return child;
+		return 0;
+	}
+	else
+		return back_node();
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::last_node(xcore::name_id id) const
+{
+	expand_contents();
+	assert(front_node());  // Cannot query for last child if node has no children
+	for (xml_node<ItemType>* child = back_node(); child; child = child->m_prev_sibling)
+		if (child->m_name_id == id)
+			return child;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::previous_sibling(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	assert(this->m_parent);     // Cannot query for siblings if node has no parent
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		if (case_sensitive && xinternal::compare(this->name(), this->name_size(), name, name_size, true))
+			if (xinternal::child_index<ItemType>* index = this->m_parent->lookup_index())
+				return index->previous(this);
+		for (xml_node<ItemType>* sibling = m_prev_sibling; sibling; sibling = sibling->m_prev_sibling)
+			if (xinternal::compare(sibling->name(), sibling->name_size(), name, name_size, case_sensitive))
+				return sibling;
+		return 0;
+	}
+	else
+		return m_prev_sibling;
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::previous_sibling(xcore::name_id id) const
+{
+	assert(this->m_parent);     // Cannot query for siblings if node has no parent
+	for (xml_node<ItemType>* sibling = m_prev_sibling; sibling; sibling = sibling->m_prev_sibling)
+		if (sibling->m_name_id == id)
+			return sibling;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::next_sibling(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	assert(this->m_parent);     // Cannot query for siblings if node has no parent
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		if (case_sensitive && xinternal::compare(this->name(), this->name_size(), name, name_size, true))
+			if (xinternal::child_index<ItemType>* index = this->m_parent->lookup_index())
+				return index->next(this);
+		for (xml_node<ItemType>* sibling = m_next_sibling; sibling; sibling = sibling->m_next_sibling)
+			if (xinternal::compare(sibling->name(), sibling->name_size(), name, name_size, case_sensitive))
+				return sibling;
+		return 0;
+	}
+	else
+		return m_next_sibling;
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_node<ItemType>* xml_node<ItemType>::next_sibling(xcore::name_id id) const
+{
+	assert(this->m_parent);     // Cannot query for siblings if node has no parent
+	for (xml_node<ItemType>* sibling = m_next_sibling; sibling; sibling = sibling->m_next_sibling)
+		if (sibling->m_name_id == id)
+			return sibling;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_attribute<ItemType>* xml_node<ItemType>::first_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		for (xml_attribute<ItemType>* attribute = front_attribute(); attribute; attribute = attribute->m_next_attribute)
+			if (xinternal::compare(attribute->name(), attribute->name_size(), name, name_size, case_sensitive))
+				return attribute;
+		return 0;
+	}
+	else
+		return front_attribute();
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_attribute<ItemType>* xml_node<ItemType>::first_attribute(xcore::name_id id) const
+{
+	for (xml_attribute<ItemType>* attribute = front_attribute(); attribute; attribute = attribute->m_next_attribute)
+		if (attribute->m_name_id == id)
+			return attribute;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+xml_attribute<ItemType>* xml_node<ItemType>::last_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name)
+	{
+		if (name_size == 0)
+			name_size = xinternal::measure(name);
+		for (xml_attribute<ItemType>* attribute = back_attribute(); attribute; attribute = attribute->m_prev_attribute)
+			if (xinternal::compare(attribute->name(), attribute->name_size(), name, name_size, case_sensitive))
+				return attribute;
+		return 0;
+	}
+	else
+		return front_attribute() ? back_attribute() : 0;
+}
+
+#if defined(XPROC_INTERN_NAMES)
+template<typename ItemType>
+xml_attribute<ItemType>* xml_node<ItemType>::last_attribute(xcore::name_id id) const
+{
+	for (xml_attribute<ItemType>* attribute = front_attribute() ? back_attribute() : 0; attribute; attribute = attribute->m_prev_attribute)
+		if (attribute->m_name_id == id)
+			return attribute;
+	return 0;
+}
+#endif
+
+template<typename ItemType>
+void xml_node<ItemType>::name(const ItemType* name)
+{
+	this->name(name, xinternal::measure(name));
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::type(node_type type)
+{
+	m_type = type;
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::prepend_node(xml_node<ItemType>* child)
+{
+	expand_contents();
+	assert(child && !child->parent() && child->type() != node_document);
+	if (front_node())
+	{
+		child->m_next_sibling = front_node();
+		front_node()->m_prev_sibling = child;
+	}
+	else
+	{
+		child->m_next_sibling = 0;
+		back_node(child);
+	}
+	front_node(child);
+	child->m_parent = this;
+	child->m_prev_sibling = 0;
+	if (xinternal::child_index<ItemType>* index = children_index())
+		index->inserted(child);
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::insert_node(xml_node<ItemType>* where, xml_node<ItemType>* child)
+{
+	expand_contents();
+	assert(!where || where->parent() == this);
+	assert(child && !child->parent() && child->type() != node_document);
+	if (where == front_node())
+		prepend_node(child);
+	else if (where == 0)
+		append_node(child);
+	else
+	{
+		child->m_prev_sibling = where->m_prev_sibling;
+		child->m_next_sibling = where;
+		where->m_prev_sibling->m_next_sibling = child;
+		where->m_prev_sibling = child;
+		child->m_parent = this;
+		if (xinternal::child_index<ItemType>* index = children_index())
+			index->inserted(child);
+	}
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_first_node()
+{
+	expand_contents();
+	assert(front_node());
+	xml_node<ItemType>* child = front_node();
+	child->expand_contents();    // While document can still be found through parent
+	if (xinternal::child_index<ItemType>* index = children_index())
+		index->removed(child);
+	front_node(child->m_next_sibling);
+	if (child->m_next_sibling)
+		child->m_next_sibling->m_prev_sibling = 0;
+	else
+		back_node(0);
+	child->m_parent = 0;
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_last_node()
+{
+	expand_contents();
+	assert(front_node());
+	xml_node<ItemType>* child = back_node();
+	child->expand_contents();    // While document can still be found through parent
+	if (xinternal::child_index<ItemType>* index = children_index())
+		index->removed(child);
+	if (child->m_prev_sibling)
+	{
+		back_node(child->m_prev_sibling);
+		child->m_prev_sibling->m_next_sibling = 0;
+	}
+	else
+		front_node(0);
+	child->m_parent = 0;
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_node(xml_node<ItemType>* where)
+{
+	expand_contents();
+	assert(where && where->parent() == this);
+	assert(front_node());
+	if (where == front_node())
+		remove_first_node();
+	else if (where == back_node())
+		remove_last_node();
+	else
+	{
+		where->expand_contents();    // While document can still be found through parent
+		if (xinternal::child_index<ItemType>* index = children_index())
+			index->removed(where);
+		where->m_prev_sibling->m_next_sibling = where->m_next_sibling;
+		where->m_next_sibling->m_prev_sibling = where->m_prev_sibling;
+		where->m_parent = 0;
+	}
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_all_nodes()
+{
+	for (xml_node<ItemType>* node = front_node(); node; node = node->m_next_sibling)
+		node->m_parent = 0;
+	front_node(0);
+#if defined(XPROC_LAZY_CONTENTS)
+	m_contents = 0;
+#endif
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+	m_child_index = 0;
+#endif
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::prepend_attribute(xml_attribute<ItemType>* attribute)
+{
+	assert(attribute && !attribute->parent());
+	if (front_attribute())
+	{
+		attribute->m_next_attribute = front_attribute();
+		front_attribute()->m_prev_attribute = attribute;
+	}
+	else
+	{
+		attribute->m_next_attribute = 0;
+		back_attribute(attribute);
+	}
+	front_attribute(attribute);
+	attribute->m_parent = this;
+	attribute->m_prev_attribute = 0;
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::insert_attribute(xml_attribute<ItemType>* where, xml_attribute<ItemType>* attribute)
+{
+	assert(!where || where->parent() == this);
+	assert(attribute && !attribute->parent());
+	if (where == front_attribute())
+		prepend_attribute(attribute);
+	else if (where == 0)
+		append_attribute(attribute);
+	else
+	{
+		attribute->m_prev_attribute = where->m_prev_attribute;
+		attribute->m_next_attribute = where;
+		where->m_prev_attribute->m_next_attribute = attribute;
+		where->m_prev_attribute = attribute;
+		attribute->m_parent = this;
+	}
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_first_attribute()
+{
+	assert(front_attribute());
+	xml_attribute<ItemType>* attribute = front_attribute();
+	if (attribute->m_next_attribute)
+		attribute->m_next_attribute->m_prev_attribute = 0;
+	else
+		back_attribute(0);
+	attribute->m_parent = 0;
+	front_attribute(attribute->m_next_attribute);
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_last_attribute()
+{
+	assert(front_attribute());
+	xml_attribute<ItemType>* attribute = back_attribute();
+	if (attribute->m_prev_attribute)
+	{
+		attribute->m_prev_attribute->m_next_attribute = 0;
+		back_attribute(attribute->m_prev_attribute);
+	}
+	else
+		front_attribute(0);
+	attribute->m_parent = 0;
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_attribute(xml_attribute<ItemType>* where)
+{
+	assert(front_attribute() && where->parent() == this);
+	if (where == front_attribute())
+		remove_first_attribute();
+	else if (where == back_attribute())
+		remove_last_attribute();
+	else
+	{
+		where->m_prev_attribute->m_next_attribute = where->m_next_attribute;
+		where->m_next_attribute->m_prev_attribute = where->m_prev_attribute;
+		where->m_parent = 0;
+	}
+}
+
+template<typename ItemType>
+void xml_node<ItemType>::remove_all_attributes()
+{
+	for (xml_attribute<ItemType>* attribute = front_attribute(); attribute; attribute = attribute->m_next_attribute)
+		attribute->m_parent = 0;
+	front_attribute(0);
+}
+
+#if defined(XPROC_LAZY_CONTENTS)
+template<typename ItemType>
+void xml_node<ItemType>::parse_contents() const
+{
+	xml_document<ItemType>* document = this->document();
+	assert(document);   // Deferred contents can only be parsed by the document which deferred them
+	document->parse_lazy_contents(const_cast<xml_node<ItemType>*>(this));
+}
+#endif
+
+// Explicit instantiations
+template class xml_node<char>;
+
+} /* namespace xcore */
+} /* namespace xprocesser */
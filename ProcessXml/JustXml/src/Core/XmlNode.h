@@ -0,0 +1,598 @@
+/*
+ * XmlNode.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLNODE_H_
+#define SRC_CORE_XMLNODE_H_
+
+#include "XmlBase.h"
+#include "XmlAttribute.h"
+#include "MemoryPool.h"
+#include "ParseError.h"
+#include "Internal/ChildIndex.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <new>          // For placement new and std::bad_alloc
+#endif
+
+// Define XPROC_LAZY_CONTENTS to have xflags::parse_lazy defer parsing of element contents.
+// Each node then records where its deferred contents start, and every function reaching children of a node checks for them first;
+// without the macro, nodes are smaller, children are reached directly, and xflags::parse_lazy is ignored.
+// The macro must be defined the same way for every translation unit.
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<class ItemType> class xml_document;
+
+///////////////////////////////////////////////////////////////////////////
+// XML node
+
+//! Class representing a node of XML document.
+//! Each node may have associated name and value strings, which are available through name() and value() functions.
+//! Interpretation of name and value depends on type of the node.
+//! Type of node can be determined by using type() function.
+//! <br><br>
+//! Note that after parse, both name and value of node, if any, will point interior of source text used for parsing.
+//! Thus, this text must persist in the memory for the lifetime of node.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_node: public Xml_Base<ItemType>
+{
+	friend class Xml_Base<ItemType>;
+	friend class xml_document<ItemType>;
+
+public:
+
+	///////////////////////////////////////////////////////////////////////////
+	// Construction & destruction
+
+	//! Constructs an empty node with the specified type.
+	//! Consider using memory_pool of appropriate document to allocate nodes manually.
+	//! \param type Type of node to construct.
+	explicit xml_node(node_type type)
+	: m_type(type)
+	  , m_first_node(0)
+	  , m_first_attribute(0)
+#if defined(XPROC_LAZY_CONTENTS)
+	  , m_contents(0)
+#endif
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+	  , m_child_index(0)
+#endif
+	  {}
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// Node data access
+
+	//! Gets type of node.
+	//! \return Type of node.
+	node_type type() const
+	{
+		return m_type;
+	}
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// Related nodes access
+
+	//! Gets document of which node is a child.
+	//! \return Pointer to document that contains this node, or 0 if there is no parent document.
+	xml_document<ItemType>* document() const;
+
+
+	//! Gets first child node, optionally matching node name.
+	//! With <code>XPROC_CHILD_INDEX_LOOKUPS</code> defined non-zero, case-sensitive lookups by name among many children are sped up
+	//! by an index of the children, built from the memory pool of the document once there have been XPROC_CHILD_INDEX_LOOKUPS of them
+	//! on a node with at least XPROC_CHILD_INDEX_MIN_CHILDREN children. Changes to children keep the index up to date.
+	//! Lookups then write to the node although they are const, so threads looking up in one document must be serialized.
+	//! \param name Name of child to find, or 0 to return first child regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found child, or 0 if not found.
+	xml_node<ItemType>* first_node(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets first child node with interned name.
+	//! Only nodes parsed with xflags::parse_intern_names carry identifiers of their names; comparison is case-sensitive.
+	//! \param id Identifier of name, from xml_document::intern_name() of the document the node belongs to.
+	//! \return Pointer to found child, or 0 if not found.
+	xml_node<ItemType>* first_node(xcore::name_id) const;
+#endif
+
+
+	//! Gets last child node, optionally matching node name.
+	//! Behaviour is undefined if node has no children.
+	//! Use first_node() to test if node has children.
+	//! \param name Name of child to find, or 0 to return last child regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found child, or 0 if not found.
+	xml_node<ItemType>* last_node(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets last child node with interned name.
+	//! Behaviour is undefined if node has no children.
+	//! \param id Identifier of name, see first_node(xcore::name_id).
+	//! \return Pointer to found child, or 0 if not found.
+	xml_node<ItemType>* last_node(xcore::name_id) const;
+#endif
+
+
+	//! Gets previous sibling node, optionally matching node name.
+	//! Behaviour is undefined if node has no parent.
+	//! Use parent() to test if node has a parent.
+	//! \param name Name of sibling to find, or 0 to return previous sibling regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found sibling, or 0 if not found.
+	xml_node<ItemType>* previous_sibling(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets previous sibling node with interned name.
+	//! Behaviour is undefined if node has no parent.
+	//! \param id Identifier of name, see first_node(xcore::name_id).
+	//! \return Pointer to found sibling, or 0 if not found.
+	xml_node<ItemType>* previous_sibling(xcore::name_id) const;
+#endif
+
+
+	//! Gets next sibling node, optionally matching node name.
+	//! Behaviour is undefined if node has no parent.
+	//! Use parent() to test if node has a parent.
+	//! Case-sensitive lookups of siblings with the name of this node use the index of children of the parent, if it has one.
+	//! \param name Name of sibling to find, or 0 to return next sibling regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found sibling, or 0 if not found.
+	xml_node<ItemType>* next_sibling(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets next sibling node with interned name.
+	//! Behaviour is undefined if node has no parent.
+	//! \param id Identifier of name, see first_node(xcore::name_id).
+	//! \return Pointer to found sibling, or 0 if not found.
+	xml_node<ItemType>* next_sibling(xcore::name_id) const;
+#endif
+
+
+	//! Gets first attribute of node, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return first attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* first_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets first attribute of node with interned name.
+	//! \param id Identifier of name, see first_node(xcore::name_id).
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* first_attribute(xcore::name_id) const;
+#endif
+
+
+	//! Gets last attribute of node, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return last attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* last_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+
+#if defined(XPROC_INTERN_NAMES)
+	//! Gets last attribute of node with interned name.
+	//! \param id Identifier of name, see first_node(xcore::name_id).
+	//! \return Pointer to found attribute, or 0 if not found.
+	xml_attribute<ItemType>* last_attribute(xcore::name_id) const;
+#endif
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// Node modification
+
+	using Xml_Base<ItemType>::name;
+
+	//! Sets name of node to a non zero-terminated string.
+	//! See Xml_Base::name(const ItemType *, std::size_t).
+	//! \param name Name of node to set. Does not have to be zero terminated.
+	//! \param size Size of name, in characters. This does not include zero terminator, if one is present.
+	void name(const ItemType* name, std::size_t size)
+	{
+#if defined(XPROC_COMPACT_NODES)
+		assert(m_type != node_document || !name);     // Document is not in a cage, so it cannot hold strings
+#endif
+		Xml_Base<ItemType>::name(name, size);
+	}
+
+
+	//! Sets name of node to a zero-terminated string.
+	//! See xml_node::name(const ItemType *, std::size_t).
+	//! \param name Name of node to set. Must be zero terminated.
+	void name(const ItemType*);
+
+
+	//! Sets type of node.
+	//! \param type Type of node to set.
+	void type(node_type);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// Node manipulation
+
+	//! Prepends a new child node.
+	//! The prepended child becomes the first child, and all existing children are moved one position back.
+	//! \param child Node to prepend.
+	void prepend_node(xml_node<ItemType>*);
+
+
+	//! Appends a new child node.
+	//! The appended child becomes the last child.
+	//! \param child Node to append.
+	void append_node(xml_node<ItemType>* child)
+	{
+		assert(child && !child->parent() && child->type() != node_document);
+		expand_contents();
+		if (front_node())
+		{
+			child->m_prev_sibling = back_node();
+			back_node()->m_next_sibling = child;
+		}
+		else
+		{
+			child->m_prev_sibling = 0;
+			front_node(child);
+		}
+		back_node(child);
+		child->m_parent = this;
+		child->m_next_sibling = 0;
+		if (xinternal::child_index<ItemType>* index = children_index())
+			index->inserted(child);
+	}
+
+
+	//! Inserts a new child node at specified place inside the node.
+	//! All children after and including the specified node are moved one position back.
+	//! \param where Place where to insert the child, or 0 to insert at the back.
+	//! \param child Node to insert.
+	void insert_node(xml_node<ItemType>*, xml_node<ItemType>*);
+
+
+	//! Removes first child node.
+	//! If node has no children, behaviour is undefined.
+	//! Use first_node() to test if node has children.
+	void remove_first_node();
+
+
+	//! Removes last child of the node.
+	//! If node has no children, behaviour is undefined.
+	//! Use first_node() to test if node has children.
+	void remove_last_node();
+
+
+	//! Removes specified child from the node
+	//! \param where Pointer to child to be removed.
+	void remove_node(xml_node<ItemType>*);
+
+
+	//! Removes all child nodes (but not attributes).
+	//! Contents deferred by xflags::parse_lazy are discarded without being parsed, and so is index of children.
+	void remove_all_nodes();
+
+
+	//! Prepends a new attribute to the node.
+	//! \param attribute Attribute to prepend.
+	void prepend_attribute(xml_attribute<ItemType>*);
+
+
+	//! Appends a new attribute to the node.
+	//! \param attribute Attribute to append.
+	void append_attribute(xml_attribute<ItemType>* attribute)
+	{
+		assert(attribute && !attribute->parent());
+		if (front_attribute())
+		{
+			attribute->m_prev_attribute = back_attribute();
+			back_attribute()->m_next_attribute = attribute;
+		}
+		else
+		{
+			attribute->m_prev_attribute = 0;
+			front_attribute(attribute);
+		}
+		back_attribute(attribute);
+		attribute->m_parent = this;
+		attribute->m_next_attribute = 0;
+	}
+
+
+	//! Inserts a new attribute at specified place inside the node.
+	//! All attributes after and including the specified attribute are moved one position back.
+	//! \param where Place where to insert the attribute, or 0 to insert at the back.
+	//! \param attribute Attribute to insert.
+	void insert_attribute(xml_attribute<ItemType>*, xml_attribute<ItemType>*);
+
+
+	//! Removes first attribute of the node.
+	//! If node has no attributes, behaviour is undefined.
+	//! Use first_attribute() to test if node has attributes.
+	void remove_first_attribute();
+
+
+	//! Removes last attribute of the node.
+	//! If node has no attributes, behaviour is undefined.
+	//! Use first_attribute() to test if node has attributes.
+	void remove_last_attribute();
+
+
+	//! Removes specified attribute from node.
+	//! \param where Pointer to attribute to be removed.
+	void remove_attribute(xml_attribute<ItemType>*);
+
+
+	//! Removes all attributes of node.
+	void remove_all_attributes();
+
+
+private:
+
+	///////////////////////////////////////////////////////////////////////////
+	// Restrictions
+
+	// No copying
+	xml_node(const xml_node &);
+	void operator =(const xml_node &);
+
+#if defined(XPROC_LAZY_CONTENTS)
+	// Parse contents deferred by xflags::parse_lazy into child nodes, if there are any
+	void expand_contents() const
+	{
+		if (m_contents)
+			parse_contents();
+	}
+
+	// Parse contents deferred by xflags::parse_lazy into child nodes
+	void parse_contents() const;
+#else
+	// Contents are never deferred
+	void expand_contents() const
+	{
+	}
+#endif
+
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+	// Index of children, or 0 if none was built
+	xinternal::child_index<ItemType>* children_index() const
+	{
+		return xinternal::child_index<ItemType>::get(m_child_index);
+	}
+
+	// Index of children to use for a lookup by name, or 0 to walk the children; counts the lookup, and may build the index
+	xinternal::child_index<ItemType>* lookup_index() const
+	{
+		return xinternal::child_index<ItemType>::lookup(this, m_child_index);
+	}
+#else
+	// Indexes are never built
+	xinternal::child_index<ItemType>* children_index() const
+	{
+		return 0;
+	}
+
+	xinternal::child_index<ItemType>* lookup_index() const
+	{
+		return 0;
+	}
+#endif
+
+	// Start of cage holding children and attributes of node; document is not in a cage, so its pool tells.
+#if defined(XPROC_COMPACT_NODES)
+	const char* cage() const;       // Defined in XmlDocument.h, which completes xml_document
+#else
+	const char* cage() const
+	{
+		return 0;
+	}
+#endif
+
+	// Ends of lists of children and attributes
+	xml_node<ItemType>* front_node() const
+	{
+		return m_first_node.get(cage());
+	}
+
+	void front_node(xml_node<ItemType>* node)
+	{
+		m_first_node.set(cage(), node);
+	}
+
+	xml_node<ItemType>* back_node() const
+	{
+		return m_last_node.get(cage());
+	}
+
+	void back_node(xml_node<ItemType>* node)
+	{
+		m_last_node.set(cage(), node);
+	}
+
+	xml_attribute<ItemType>* front_attribute() const
+	{
+		return m_first_attribute.get(cage());
+	}
+
+	void front_attribute(xml_attribute<ItemType>* attribute)
+	{
+		m_first_attribute.set(cage(), attribute);
+	}
+
+	xml_attribute<ItemType>* back_attribute() const
+	{
+		return m_last_attribute.get(cage());
+	}
+
+	void back_attribute(xml_attribute<ItemType>* attribute)
+	{
+		m_last_attribute.set(cage(), attribute);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// Data members
+
+	// Note that some of the pointers below have UNDEFINED values if certain other pointers are 0.
+	// This is required for maximum performance, as it allows the parser to omit initialization of
+	// unneded/redundant values.
+	//
+	// The rules are as follows:
+	// 1. first_node and first_attribute contain valid pointers, or 0 if node has no children/attributes respectively
+	// 2. last_node and last_attribute are valid only if node has at least one child/attribute respectively, otherwise they contain garbage
+	// 3. prev_sibling and next_sibling are valid only if node has a parent, otherwise they contain garbage
+
+	node_type m_type;                                               // Type of node; always valid
+	xinternal::head_ptr<xml_node<ItemType> > m_first_node;          // Pointer to first child node, or 0 if none; always valid
+	xinternal::head_ptr<xml_node<ItemType> > m_last_node;           // Pointer to last child node, or 0 if none; this value is only valid if m_first_node is non-zero
+	xinternal::head_ptr<xml_attribute<ItemType> > m_first_attribute;    // Pointer to first attribute of node, or 0 if none; always valid
+	xinternal::head_ptr<xml_attribute<ItemType> > m_last_attribute;     // Pointer to last attribute of node, or 0 if none; this value is only valid if m_first_attribute is non-zero
+	typename xinternal::link_ptr<xml_node<ItemType> >::type m_prev_sibling;     // Pointer to previous sibling of node, or 0 if none; this value is only valid if m_parent is non-zero
+	typename xinternal::link_ptr<xml_node<ItemType> >::type m_next_sibling;     // Pointer to next sibling of node, or 0 if none; this value is only valid if m_parent is non-zero
+#if defined(XPROC_LAZY_CONTENTS)
+	typename xinternal::string_ptr<ItemType>::type m_contents;                  // Start of contents not yet parsed into child nodes, or 0 if none; always valid
+#endif
+#if XPROC_CHILD_INDEX_LOOKUPS > 0
+	mutable std::size_t m_child_index;                              // Index of children by name if even and non-zero, otherwise twice the lookups made without one plus one, or 0; always valid
+#endif
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Allocation of nodes and attributes
+
+// Allocation from the pool is defined here, where nodes and attributes are complete, so that the parser inlines it for every node
+
+template<typename ItemType>
+inline char *memory_pool<ItemType>::align(char *ptr)
+{
+	std::size_t alignment = ((RAPIDXML_ALIGNMENT - (std::size_t(ptr) & (RAPIDXML_ALIGNMENT - 1))) & (RAPIDXML_ALIGNMENT - 1));
+	return ptr + alignment;
+}
+
+#if defined(XPROC_COMPACT_NODES)
+
+template<typename ItemType>
+inline void *memory_pool<ItemType>::allocate_aligned(std::size_t size)
+{
+	if (!m_cage)
+		reserve();
+
+	// Cage is never left, nor moved, so that offsets stay valid
+	char *result = align(m_ptr);
+	if (size > static_cast<std::size_t>(m_cage + xinternal::cage_size - result))
+	{
+#ifdef RAPIDXML_NO_EXCEPTIONS
+		RAPIDXML_PARSE_ERROR("out of memory", 0);
+#else
+		throw std::bad_alloc();
+#endif
+	}
+	if (result + size > m_end)
+		commit(result + size);
+
+#if defined(XPROC_POOL_STATISTICS)
+	count_allocation(result, size);
+#endif
+	m_ptr = result + size;
+	return result;
+}
+
+#else
+
+template<typename ItemType>
+inline void *memory_pool<ItemType>::allocate_aligned(std::size_t size)
+{
+	// Calculate aligned pointer
+	char *result = align(m_ptr);
+
+	// If not enough memory left in current pool, allocate a new pool
+	if (result + size > m_end)
+	{
+		allocate_block(size);
+
+		// Calculate aligned pointer again using new pool
+		result = align(m_ptr);
+	}
+
+#if defined(XPROC_POOL_STATISTICS)
+	count_allocation(result, size);
+#endif
+
+	// Update pool and return aligned pointer
+	m_ptr = result + size;
+	return result;
+}
+
+#endif
+
+template<typename ItemType>
+inline xml_node<ItemType> *memory_pool<ItemType>::allocate_node(node_type type, const ItemType *name, const ItemType *value, std::size_t name_size, std::size_t value_size)
+{
+	void *memory = allocate_aligned(sizeof(xml_node<ItemType>));
+#if defined(XPROC_POOL_STATISTICS)
+	m_statistics.node_bytes += sizeof(xml_node<ItemType>);
+#endif
+	xml_node<ItemType> *node = new(memory) xml_node<ItemType>(type);
+	if (name)
+	{
+		if (name_size > 0)
+			node->name(name, name_size);
+		else
+			node->name(name);
+	}
+	if (value)
+	{
+		if (value_size > 0)
+			node->value(value, value_size);
+		else
+			node->value(value);
+	}
+	return node;
+}
+
+template<typename ItemType>
+inline xml_attribute<ItemType> *memory_pool<ItemType>::allocate_attribute(const ItemType *name, const ItemType *value, std::size_t name_size, std::size_t value_size)
+{
+	void *memory = allocate_aligned(sizeof(xml_attribute<ItemType>));
+#if defined(XPROC_POOL_STATISTICS)
+	m_statistics.attribute_bytes += sizeof(xml_attribute<ItemType>);
+#endif
+	xml_attribute<ItemType> *attribute = new(memory) xml_attribute<ItemType>;
+	if (name)
+	{
+		if (name_size > 0)
+			attribute->name(name, name_size);
+		else
+			attribute->name(name);
+	}
+	if (value)
+	{
+		if (value_size > 0)
+			attribute->value(value, value_size);
+		else
+			attribute->value(value);
+	}
+	return attribute;
+}
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLNODE_H_ */
@@ -0,0 +1,403 @@
+/*
+ * XmlQuery.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlQuery.h"
+
+#include "ParseError.h"
+#include "Internal/CoreAlgorithms.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<typename ItemType>
+const std::size_t xml_query<ItemType>::max_steps;
+
+template<typename ItemType>
+const std::size_t xml_query<ItemType>::max_predicates;
+
+template<typename ItemType>
+const std::size_t xml_query<ItemType>::max_positions;
+
+template<typename ItemType>
+xml_query<ItemType>::xml_query()
+: m_text(0)
+  , m_step_count(0)
+  , m_predicate_count(0)
+  , m_position_count(0)
+  , m_absolute(false)
+  , m_child_steps(0)
+  , m_descendant_steps(0)
+{
+}
+
+template<typename ItemType>
+xml_query<ItemType>::xml_query(const ItemType* query, std::size_t size)
+: m_text(0)
+  , m_step_count(0)
+  , m_predicate_count(0)
+  , m_position_count(0)
+  , m_absolute(false)
+  , m_child_steps(0)
+  , m_descendant_steps(0)
+{
+	compile(query, size);
+}
+
+template<typename ItemType>
+xml_query<ItemType>::~xml_query()
+{
+	delete[] m_text;
+}
+
+template<typename ItemType>
+void xml_query<ItemType>::compile(const ItemType* query, std::size_t size)
+{
+	assert(query);
+	if (size == 0)
+		size = xinternal::measure(query);
+
+	// Start over with the context node
+	delete[] m_text;
+	m_text = 0;
+	m_step_count = 0;
+	m_predicate_count = 0;
+	m_position_count = 0;
+	m_absolute = false;
+	m_child_steps = 0;
+	m_descendant_steps = 0;
+
+	// Leading / or // starts from the document, leading . from the context node, as a path without them
+	const ItemType* text = query;
+	const ItemType* end = query + size;
+	bool separated = true;
+	if (text != end && *text == ItemType('/'))
+	{
+		m_absolute = true;
+		separated = false;
+	}
+	else if (text != end && *text == ItemType('.'))
+	{
+		++text;
+		separated = false;
+	}
+
+	while (text != end)
+	{
+		// Separator, unless at the start of relative path
+		bool descendant = false;
+		if (!separated)
+		{
+			if (*text != ItemType('/'))
+				error("expected /", text);
+			++text;
+			if (text != end && *text == ItemType('/'))
+			{
+				descendant = true;
+				++text;
+			}
+			else if (text == end && m_absolute && m_step_count == 0)
+				break;      // Path / selects the document
+		}
+		separated = false;
+
+		// Nothing may follow attributes
+		if (m_step_count && m_steps[m_step_count - 1].kind >= step_attribute)
+			error("attribute step must be the last one", text);
+		if (m_step_count == max_steps)
+			error("too many steps in query", text);
+		step& current = m_steps[m_step_count];
+		current.descendant = descendant;
+		current.name = 0;
+		current.name_size = 0;
+		current.predicate = m_predicate_count;
+
+		// Step
+		static const ItemType text_test[] = { ItemType('t'), ItemType('e'), ItemType('x'), ItemType('t'), ItemType('('), ItemType(')') };
+		if (text != end && *text == ItemType('@'))
+		{
+			++text;
+			if (text != end && *text == ItemType('*'))
+			{
+				current.kind = step_any_attribute;
+				++text;
+			}
+			else
+			{
+				current.kind = step_attribute;
+				current.name = text - query;
+				current.name_size = parse_name(text, end);
+			}
+		}
+		else if (text != end && *text == ItemType('*'))
+		{
+			current.kind = step_any_element;
+			++text;
+		}
+		else if (static_cast<std::size_t>(end - text) >= 6 && xinternal::compare(text, 6, text_test, 6, true))
+		{
+			current.kind = step_text;
+			text += 6;
+		}
+		else
+		{
+			current.kind = step_element;
+			current.name = text - query;
+			current.name_size = parse_name(text, end);
+		}
+		++m_step_count;
+
+		// Predicates
+		if (text != end && *text == ItemType('['))
+		{
+			if (current.kind >= step_attribute)
+				error("attribute step cannot have predicates", text);
+			parse_predicates(text, end, query);
+		}
+		current.predicate_end = m_predicate_count;
+
+		// Node steps are followed during evaluation by their axis
+		if (current.kind < step_attribute)
+		{
+			if (descendant)
+				m_descendant_steps |= 1u << (m_step_count - 1);
+			else
+				m_child_steps |= 1u << (m_step_count - 1);
+		}
+	}
+
+	// Names and values refer to a copy of query
+	m_text = new ItemType[size + 1];
+	for (std::size_t i = 0; i < size; ++i)
+		m_text[i] = query[i];
+	m_text[size] = ItemType('\0');
+}
+
+template<typename ItemType>
+Xml_Base<ItemType>* xml_query<ItemType>::first(xml_node<ItemType>* context) const
+{
+	Xml_Base<ItemType>* result;
+	return select(context, &result, 1) ? result : 0;
+}
+
+template<typename ItemType>
+std::size_t xml_query<ItemType>::select(xml_node<ItemType>* context, Xml_Base<ItemType>** results, std::size_t capacity) const
+{
+	assert(context && (results || !capacity));
+	if (capacity == 0)
+		return 0;
+	if (m_absolute)
+		while (context->parent())
+			context = context->parent();
+
+	// Empty path selects the context node
+	if (m_step_count == 0)
+	{
+		results[0] = context;
+		return 1;
+	}
+
+	// Context node matches empty part of path, and so do all its descendants for descendant steps
+	sink collected = { results, capacity, 0 };
+	evaluate(context, 1u, 1u, collected);
+	return collected.size;
+}
+
+template<typename ItemType>
+void xml_query<ItemType>::error(const char* what, const ItemType* where)
+{
+	m_step_count = 0;
+	m_absolute = false;
+	RAPIDXML_PARSE_ERROR(what, const_cast<ItemType*>(where));
+}
+
+template<typename ItemType>
+std::size_t xml_query<ItemType>::parse_name(const ItemType*& text, const ItemType* end)
+{
+	// Name ends at a character with a meaning in query
+	const ItemType* name = text;
+	while (text != end && *text != ItemType('/') && *text != ItemType('[') && *text != ItemType(']') &&
+			*text != ItemType('@') && *text != ItemType('=') && *text != ItemType('*') &&
+			*text != ItemType('(') && *text != ItemType(')') && *text != ItemType('\'') && *text != ItemType('"') &&
+			*text != ItemType(' ') && *text != ItemType('\t') && *text != ItemType('\r') && *text != ItemType('\n'))
+		++text;
+	if (text == name)
+		error("expected name", text);
+	return text - name;
+}
+
+template<typename ItemType>
+void xml_query<ItemType>::parse_predicates(const ItemType*& text, const ItemType* end, const ItemType* query)
+{
+	while (text != end && *text == ItemType('['))
+	{
+		++text;     // Skip '['
+		if (m_predicate_count == max_predicates)
+			error("too many predicates in query", text);
+		predicate& current = m_predicates[m_predicate_count];
+		current.name = 0;
+		current.name_size = 0;
+		current.value = 0;
+		current.value_size = 0;
+		current.position = 0;
+		current.counter = 0;
+
+		if (text != end && *text == ItemType('@'))
+		{
+			// Attribute, optionally with value
+			++text;
+			current.kind = predicate_attribute;
+			current.name = text - query;
+			current.name_size = parse_name(text, end);
+			if (text != end && *text == ItemType('='))
+			{
+				++text;
+				if (text == end || (*text != ItemType('\'') && *text != ItemType('"')))
+					error("expected ' or \"", text);
+				ItemType quote = *text++;
+				const ItemType* value = text;
+				while (text != end && *text != quote)
+					++text;
+				if (text == end)
+					error("expected ' or \"", text);
+				current.kind = predicate_attribute_value;
+				current.value = value - query;
+				current.value_size = text - value;
+				++text;
+			}
+		}
+		else
+		{
+			// Position
+			while (text != end && *text >= ItemType('0') && *text <= ItemType('9'))
+				current.position = current.position * 10 + (*text++ - ItemType('0'));
+			if (current.position == 0)
+				error("expected position or attribute", text);
+			if (m_position_count == max_positions)
+				error("too many positions in query", text);
+			current.kind = predicate_position;
+			current.counter = m_position_count++;
+		}
+
+		if (text == end || *text != ItemType(']'))
+			error("expected ]", text);
+		++text;     // Skip ']'
+		++m_predicate_count;
+	}
+}
+
+template<typename ItemType>
+bool xml_query<ItemType>::test(const step& current, const xml_node<ItemType>* node, std::size_t* counts, bool named) const
+{
+	// Node test
+	switch (current.kind)
+	{
+	case step_element:
+		if (node->type() != node_element || (!named && !xinternal::compare(node->name(), node->name_size(), m_text + current.name, current.name_size, true)))
+			return false;
+		break;
+	case step_any_element:
+		if (node->type() != node_element)
+			return false;
+		break;
+	default:
+		if (node->type() != node_data && node->type() != node_cdata)
+			return false;
+		break;
+	}
+
+	// Predicates, in order; positions count nodes which passed the previous ones
+	for (std::size_t i = current.predicate; i < current.predicate_end; ++i)
+	{
+		const predicate& condition = m_predicates[i];
+		if (condition.kind == predicate_position)
+		{
+			if (++counts[condition.counter] != condition.position)
+				return false;
+			continue;
+		}
+		xml_attribute<ItemType>* attribute = node->first_attribute(m_text + condition.name, condition.name_size);
+		if (!attribute)
+			return false;
+		if (condition.kind == predicate_attribute_value &&
+				!xinternal::compare(attribute->value(), attribute->value_size(), m_text + condition.value, condition.value_size, true))
+			return false;
+	}
+	return true;
+}
+
+template<typename ItemType>
+bool xml_query<ItemType>::evaluate(xml_node<ItemType>* node, unsigned matched, unsigned inherited, sink& collected) const
+{
+	// Attributes selected by the last step
+	const step& last = m_steps[m_step_count - 1];
+	std::size_t last_bit = m_step_count - 1;
+	if (last.kind >= step_attribute && ((last.descendant ? inherited : matched) >> last_bit & 1u))
+	{
+		const ItemType* name = last.kind == step_attribute ? m_text + last.name : 0;
+		for (xml_attribute<ItemType>* attribute = node->first_attribute(name, last.name_size); attribute; attribute = attribute->next_attribute(name, last.name_size))
+		{
+			collected.results[collected.size++] = attribute;
+			if (collected.size == collected.capacity)
+				return true;
+		}
+	}
+
+	// Steps applying to children: on the child axis those matched by node, on the descendant axis those matched by node or its ancestors.
+	// Descendants are visited while a descendant step applies to them, which may be the last one selecting attributes.
+	unsigned active = (matched & m_child_steps) | (inherited & m_descendant_steps);
+	bool descend = (inherited & m_descendant_steps) || (last.kind >= step_attribute && last.descendant && (inherited >> last_bit & 1u));
+	if (!active && !descend)
+		return false;
+	std::size_t counts[max_positions];
+	for (std::size_t i = 0; i < m_position_count; ++i)
+		counts[i] = 0;
+
+	// Children of one name are looked up by it, when no other step applies; lookups allocate only to build a child index
+	const ItemType* name = 0;
+	std::size_t name_size = 0;
+	if (!descend && !(active & (active - 1)))
+	{
+		std::size_t only = 0;
+		while (!(active >> only & 1u))
+			++only;
+		if (m_steps[only].kind == step_element)
+		{
+			name = m_text + m_steps[only].name;
+			name_size = m_steps[only].name_size;
+		}
+	}
+
+	for (xml_node<ItemType>* child = node->first_node(name, name_size); child; child = child->next_sibling(name, name_size))
+	{
+		unsigned child_matched = 0;
+		for (std::size_t i = 0; i < m_step_count; ++i)
+			if ((active >> i & 1u) && test(m_steps[i], child, counts, name != 0))
+				child_matched |= 2u << i;
+
+		// Node matching the whole path is a result
+		if (child_matched >> m_step_count & 1u)
+		{
+			collected.results[collected.size++] = child;
+			if (collected.size == collected.capacity)
+				return true;
+		}
+
+		// Only elements have children and attributes, and only steps short of the whole path continue in them
+		if (child->type() == node_element && ((child_matched & ~(2u << (m_step_count - 1))) || descend))
+			if (evaluate(child, child_matched, inherited | child_matched, collected))
+				return true;
+	}
+	return false;
+}
+
+// Explicit instantiations
+template class xml_query<char>;
+
+} /* namespace xcore */
+} /* namespace xprocesser */
@@ -0,0 +1,182 @@
+/*
+ * XmlQuery.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLQUERY_H_
+#define SRC_CORE_XMLQUERY_H_
+
+#include "XmlNode.h"
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+///////////////////////////////////////////////////////////////////////////
+// XML query
+
+//! This class is a query of a subset of XPath 1.0, compiled once and evaluated over any number of documents.
+//! Query is a path of steps separated by <code>/</code> for the child axis or <code>//</code> for the descendant axis.
+//! A path starting with <code>/</code> or <code>//</code> is evaluated from the document of the context node,
+//! any other path from the context node itself; a leading <code>.</code> stands for the context node.
+//! Each step is one of:
+//! - <code>name</code>, elements of that name;
+//! - <code>*</code>, all elements;
+//! - <code>text()</code>, data and CDATA nodes;
+//! - <code>\@name</code> or <code>\@*</code>, attributes, as the last step only.
+//! .
+//! Element and text steps can be followed by predicates, applied in order:
+//! - <code>[\@name]</code>, node has the attribute;
+//! - <code>[\@name='value']</code> or <code>[\@name="value"]</code>, node has the attribute with that value;
+//! - <code>[n]</code>, node is the n-th of the nodes of the same parent which passed the step and previous predicates, counted from 1.
+//! .
+//! For example <code>/catalog/item[\@type='book'][2]/title/text()</code> or <code>//price/\@currency</code>.
+//! Names and values are compared case-sensitively, without resolving namespace prefixes.
+//! <br><br>
+//! Evaluation visits candidate nodes once, in document order, carrying the set of steps matched so far,
+//! and selects nodes in document order with no duplicates.
+//! A step selecting children by name is looked up with xml_node::first_node() and xml_node::next_sibling(),
+//! so it uses the child index where <code>XPROC_CHILD_INDEX_LOOKUPS</code> enables it.
+//! Evaluation itself allocates no memory; lookups do when they build a child index,
+//! and so does visiting contents deferred by xflags::parse_lazy with <code>XPROC_LAZY_CONTENTS</code>.
+//! A query has at most <code>max_steps</code> steps, <code>max_predicates</code> predicates
+//! and <code>max_positions</code> positional predicates.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_query
+{
+public:
+
+	static const std::size_t max_steps = 31;            //!< Maximum number of steps of a query
+	static const std::size_t max_predicates = 16;       //!< Maximum number of predicates of a query
+	static const std::size_t max_positions = 8;         //!< Maximum number of positional predicates of a query
+
+	//! Constructs query selecting the context node
+	xml_query();
+
+	//! Constructs query compiled from text.
+	//! In case of error, parse_error exception will be thrown, pointing into the text.
+	//! \param query Text of query; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of text, in characters, or 0 to have size calculated automatically from string
+	explicit xml_query(const ItemType*, std::size_t = 0);
+
+	//! Destroys query
+	~xml_query();
+
+
+	//! Compiles query from text, replacing the current one.
+	//! In case of error, parse_error exception will be thrown, pointing into the text, and query is left selecting the context node.
+	//! \param query Text of query; this string doesn't have to be zero-terminated if size is non-zero
+	//! \param size Size of text, in characters, or 0 to have size calculated automatically from string
+	void compile(const ItemType*, std::size_t = 0);
+
+
+	//! Checks whether query selects attributes rather than nodes.
+	//! \return True if results are xml_attribute objects, false if they are xml_node objects.
+	bool selects_attributes() const
+	{
+		return m_step_count && m_steps[m_step_count - 1].kind >= step_attribute;
+	}
+
+	//! Evaluates query and gets the first result in document order.
+	//! \param context Node to evaluate relative path from.
+	//! \return Pointer to found node or attribute, as selects_attributes() tells, or 0 if there is none.
+	Xml_Base<ItemType>* first(xml_node<ItemType>*) const;
+
+	//! Evaluates query and stores results in document order, until there are no more or capacity is reached.
+	//! \param context Node to evaluate relative path from.
+	//! \param results Array receiving pointers to found nodes or attributes, as selects_attributes() tells.
+	//! \param capacity Size of array.
+	//! \return Number of results stored.
+	std::size_t select(xml_node<ItemType>*, Xml_Base<ItemType>**, std::size_t) const;
+
+private:
+
+	// Kinds of steps; attribute steps come last
+	enum step_kind
+	{
+		step_element,
+		step_any_element,
+		step_text,
+		step_attribute,
+		step_any_attribute
+	};
+
+	// Kinds of predicates
+	enum predicate_kind
+	{
+		predicate_position,
+		predicate_attribute,
+		predicate_attribute_value
+	};
+
+	// Step of path
+	struct step
+	{
+		step_kind kind;
+		bool descendant;                // Step selects descendants of context of step, rather than children
+		std::size_t name;               // Offset of name in the text of query
+		std::size_t name_size;
+		std::size_t predicate;          // Index of first predicate
+		std::size_t predicate_end;      // Index past the last predicate
+	};
+
+	// Predicate of step
+	struct predicate
+	{
+		predicate_kind kind;
+		std::size_t name;               // Offset of attribute name in the text of query
+		std::size_t name_size;
+		std::size_t value;              // Offset of attribute value in the text of query
+		std::size_t value_size;
+		std::size_t position;           // Position to select, counted from 1
+		std::size_t counter;            // Index of counter of positional predicate
+	};
+
+	// Results being collected
+	struct sink
+	{
+		Xml_Base<ItemType>** results;
+		std::size_t capacity;
+		std::size_t size;
+	};
+
+	// Restrictive copy constructor and assignment operator
+	xml_query(const xml_query&);
+	void operator=(const xml_query&);
+
+	// Report error in query, leaving the query selecting the context node
+	void error(const char*, const ItemType*);
+
+	// Parse name in query, and return its size
+	std::size_t parse_name(const ItemType*&, const ItemType*);
+
+	// Parse predicates following step in query
+	void parse_predicates(const ItemType*&, const ItemType*, const ItemType*);
+
+	// Check if node passes step and its predicates; positions are counted among nodes of the same parent.
+	// Name of node is not compared if it was looked up by the name of step.
+	bool test(const step&, const xml_node<ItemType>*, std::size_t*, bool) const;
+
+	// Visit children of node with steps matched by node and by its ancestors, and collect results.
+	// Returns true once results are full.
+	bool evaluate(xml_node<ItemType>*, unsigned, unsigned, sink&) const;
+
+	ItemType* m_text;                           // Copy of text of query, which names and values refer to
+	step m_steps[max_steps];                    // Steps of path
+	std::size_t m_step_count;                   // Number of steps
+	predicate m_predicates[max_predicates];     // Predicates of all steps
+	std::size_t m_predicate_count;              // Number of predicates
+	std::size_t m_position_count;               // Number of positional predicates
+	bool m_absolute;                            // Path is evaluated from the document
+	unsigned m_child_steps;                     // Bit of each node step on the child axis
+	unsigned m_descendant_steps;                // Bit of each node step on the descendant axis
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLQUERY_H_ */
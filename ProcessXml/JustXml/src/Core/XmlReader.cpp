@@ -0,0 +1,454 @@
+/*
+ * XmlReader.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlReader.h"
+
+#include "Internal/CoreAlgorithms.h"
+#include "Internal/LookupTables.h"
+#include "Internal/ScanKernels.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdio>       // For std::FILE, std::fread
+#include <cstring>      // For std::memmove, std::memcpy
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+template<typename ItemType>
+xml_reader<ItemType>::xml_reader(read_func* read, void* source, std::size_t window_size)
+: m_read(read)
+  , m_source(source)
+  , m_window(new ItemType[window_size + 1])
+  , m_window_size(window_size)
+  , m_begin(m_window)
+  , m_end(m_window)
+  , m_restore(0)
+  , m_restore_char(0)
+  , m_node(0)
+  , m_started(false)
+  , m_eof(false)
+  , m_pending_end(false)
+  , m_continued(false)
+  , m_names(0)
+  , m_names_size(0)
+  , m_names_capacity(0)
+  , m_name_offsets(0)
+  , m_depth(0)
+  , m_depth_capacity(0)
+{
+	assert(read && window_size >= 64);
+	*m_end = ItemType('\0');
+
+	// Nodes of each event are released by the next one, which reuses their memory
+	m_document.set_retention(RAPIDXML_DYNAMIC_POOL_SIZE);
+}
+
+template<typename ItemType>
+xml_reader<ItemType>::xml_reader(std::size_t window_size)
+: m_read(0)
+  , m_source(0)
+  , m_window(new ItemType[window_size + 1])
+  , m_window_size(window_size)
+  , m_begin(m_window)
+  , m_end(m_window)
+  , m_restore(0)
+  , m_restore_char(0)
+  , m_node(0)
+  , m_started(false)
+  , m_eof(false)
+  , m_pending_end(false)
+  , m_continued(false)
+  , m_names(0)
+  , m_names_size(0)
+  , m_names_capacity(0)
+  , m_name_offsets(0)
+  , m_depth(0)
+  , m_depth_capacity(0)
+{
+	assert(window_size >= 64);
+	*m_end = ItemType('\0');
+
+	// Nodes of each event are released by the next one, which reuses their memory
+	m_document.set_retention(RAPIDXML_DYNAMIC_POOL_SIZE);
+}
+
+template<typename ItemType>
+xml_reader<ItemType>::~xml_reader()
+{
+	delete[] m_window;
+	delete[] m_names;
+	delete[] m_name_offsets;
+}
+
+template<typename ItemType>
+template<int Flags>
+reader_event xml_reader<ItemType>::next()
+{
+	const int ReaderFlags = Flags & ~parse_structural_index;
+
+	// Empty element is closed by the event after its start, with the same node
+	if (m_pending_end)
+	{
+		m_pending_end = false;
+		return reader_end_element;
+	}
+
+	// Put back character overwritten by terminator of the last text event, and release nodes of the last event
+	if (m_restore)
+	{
+		*m_restore = m_restore_char;
+		m_restore = 0;
+	}
+	m_document.memory_pool<ItemType>::clear();
+	m_node = 0;
+
+	while (1)
+	{
+		// Get more input when unconsumed input is exhausted
+		if (m_begin == m_end && !fill())
+		{
+			if (waiting())
+				return reader_need_more;
+			if (m_depth)
+				RAPIDXML_PARSE_ERROR("unexpected end of data", m_end);
+			return reader_end_of_document;
+		}
+
+		// Skip UTF-8 BOM at start of input
+		if (!m_started)
+		{
+			if (m_end - m_begin < 3 && !m_eof)
+			{
+				if (fill())
+					continue;
+				if (waiting())
+					return reader_need_more;
+			}
+			m_started = true;
+			if (static_cast<unsigned char>(m_begin[0]) == 0xEF &&
+					static_cast<unsigned char>(m_begin[1]) == 0xBB &&
+					static_cast<unsigned char>(m_begin[2]) == 0xBF)
+			{
+				m_begin += 3;
+				continue;
+			}
+		}
+
+		// Outside of elements only whitespace may come between nodes
+		if (!m_depth)
+		{
+			while (m_begin != m_end && xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*m_begin)])
+				++m_begin;
+			if (m_begin == m_end)
+				continue;
+			if (*m_begin != ItemType('<'))
+				RAPIDXML_PARSE_ERROR("expected <", m_begin);
+		}
+
+		// Text
+		if (*m_begin != ItemType('<'))
+		{
+			// Find its end, or cut it at window boundary in front of a possible character reference
+			ItemType* end = find_text_end(m_begin);
+			bool whole = end != m_end;
+
+			// Zero character inside of input ends data, as it ends parsed text
+			if (whole && !*end)
+				RAPIDXML_PARSE_ERROR("unexpected end of data", end);
+			if (!whole)
+			{
+				if (fill())
+					continue;
+				if (waiting())
+					return reader_need_more;
+				if (m_eof)
+					RAPIDXML_PARSE_ERROR("unexpected end of data", m_end);
+				for (ItemType* ref = end - 1; ref != end - 12; --ref)
+				{
+					if (*ref == ItemType(';'))
+						break;
+					if (*ref == ItemType('&'))
+					{
+						end = ref;
+						break;
+					}
+				}
+			}
+
+			// Whitespace only text between markup is ignored, as in parse()
+			ItemType* text = m_begin;
+			while (text != end && xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+				++text;
+			bool ignore = (Flags & parse_no_data_nodes) ||
+					(text == end && ((whole && !m_continued) || (Flags & parse_trim_whitespace)));
+			m_continued = !whole;
+			if (ignore)
+			{
+				m_begin = end;
+				continue;
+			}
+
+			// Parse text up to a temporary terminator
+			m_restore = end;
+			m_restore_char = *end;
+			*end = ItemType('\0');
+			m_node = m_document.template parse_text<ReaderFlags>(text, m_begin);
+			m_begin = end;
+			return reader_data;
+		}
+
+		// Make sure the whole markup is in the window; markup cut by end of input is left for parsing to report
+		if (!find_markup_end())
+		{
+			if (fill())
+				continue;
+			if (waiting())
+				return reader_need_more;
+			if (!m_eof)
+				RAPIDXML_PARSE_ERROR("markup longer than reader window", m_begin);
+		}
+
+		// Parse it, with the innermost open element to match a closing tag
+		m_continued = false;
+		ItemType* text = m_begin + 1;
+		xml_node<ItemType>* open = 0;
+		if (m_depth && *text == ItemType('/'))
+		{
+			std::size_t offset = m_name_offsets[m_depth - 1];
+			open = m_document.allocate_node(node_element, m_names + offset, 0, m_names_size - offset - 1);
+		}
+		int step;
+		m_node = m_document.template parse_markup<ReaderFlags>(text, open, step);
+		m_begin = text;
+		if (!m_node)
+			continue;
+
+		// Determine event
+		switch (m_node->type())
+		{
+		case node_element:
+			if (step < 0)
+			{
+				m_names_size = m_name_offsets[--m_depth];
+				return reader_end_element;
+			}
+			if (step > 0)
+				push_name(m_node->name(), m_node->name_size());
+			else
+				m_pending_end = true;
+			return reader_start_element;
+		case node_cdata:
+			return reader_cdata;
+		case node_comment:
+			return reader_comment;
+		case node_declaration:
+			return reader_declaration;
+		case node_doctype:
+			return reader_doctype;
+		case node_pi:
+			return reader_pi;
+		default:
+			continue;
+		}
+	}
+}
+
+template<typename ItemType>
+std::size_t xml_reader<ItemType>::feed(const ItemType* data, std::size_t size)
+{
+	assert(!m_read && !m_eof && !m_pending_end && !m_restore);
+
+	// Copy as much as fits after unconsumed input
+	compact();
+	std::size_t count = m_window_size - (m_end - m_begin);
+	if (count > size)
+		count = size;
+	std::memcpy(m_end, data, count * sizeof(ItemType));
+	m_end += count;
+	*m_end = ItemType('\0');
+	m_node = 0;
+	return count;
+}
+
+template<typename ItemType>
+void xml_reader<ItemType>::finish()
+{
+	assert(!m_read);
+	m_eof = true;
+}
+
+#if !defined(XPROC_NO_STDLIB)
+template<typename ItemType>
+std::size_t xml_reader<ItemType>::read_file(void* source, ItemType* buffer, std::size_t count)
+{
+	return std::fread(buffer, sizeof(ItemType), count, static_cast<std::FILE*>(source));
+}
+#endif
+
+template<typename ItemType>
+void xml_reader<ItemType>::compact()
+{
+	if (m_begin != m_window)
+	{
+		std::size_t size = m_end - m_begin;
+		std::memmove(m_window, m_begin, size * sizeof(ItemType));
+		m_begin = m_window;
+		m_end = m_window + size;
+		*m_end = ItemType('\0');
+	}
+}
+
+template<typename ItemType>
+bool xml_reader<ItemType>::fill()
+{
+	// Move unconsumed input to start of window, then read after it, unless input is pushed by feed()
+	compact();
+	std::size_t size = m_end - m_begin;
+	if (m_eof || size == m_window_size || !m_read)
+		return false;
+	std::size_t count = m_read(m_source, m_end, m_window_size - size);
+	if (count == 0)
+	{
+		m_eof = true;
+		return false;
+	}
+	m_end += count;
+	*m_end = ItemType('\0');
+	return true;
+}
+
+template<typename ItemType>
+ItemType* xml_reader<ItemType>::find_markup_end() const
+{
+	// Find last character of markup the way its parsing function does.
+	// Zero terminator inside of input ends markup as well, so that parsing reports the error.
+	// Node type is known from up to 9 characters after <, see xml_document::parse_node();
+	// characters compared with the terminator at m_end stop the compare, and the scan then stops at the terminator.
+	ItemType* text = m_begin + 1;
+	ItemType* last;
+	switch (text[0])
+	{
+
+	// <?...?>
+	case ItemType('?'):
+		last = find_end(text + 1, "?>");
+		break;
+
+	// <!...
+	case ItemType('!'):
+		if (text[1] == ItemType('-') && text[2] == ItemType('-'))
+			last = find_end(text + 3, "-->");
+		else if (text[1] == ItemType('[') && text[2] == ItemType('C') && text[3] == ItemType('D') && text[4] == ItemType('A') &&
+				text[5] == ItemType('T') && text[6] == ItemType('A') && text[7] == ItemType('['))
+			last = find_end(text + 8, "]]>");
+		else if (text[1] == ItemType('D'))
+		{
+			// DOCTYPE, possibly with internal subset in brackets
+			last = text + 2;
+			int depth = 0;
+			while (*last && (depth || *last != ItemType('>')))
+			{
+				if (*last == ItemType('['))
+					++depth;
+				else if (*last == ItemType(']') && depth)
+					--depth;
+				++last;
+			}
+		}
+		else
+			last = find_end(text + 1, ">");
+		break;
+
+	// Start or closing tag, with > allowed in attribute values
+	default:
+		last = text;
+		while (*last && *last != ItemType('>'))
+		{
+			if (*last == ItemType('"') || *last == ItemType('\''))
+			{
+				ItemType quote = *last++;
+				while (*last && *last != quote)
+					++last;
+				if (!*last)
+					break;
+			}
+			++last;
+		}
+		break;
+
+	}
+
+	// Markup is cut by the end of the window only if the scan reached it; markup ending right before it is whole
+	if (last == m_end)
+		return 0;
+	return *last ? last + 1 : last;
+}
+
+template<typename ItemType>
+ItemType* xml_reader<ItemType>::find_text_end(ItemType* text)
+{
+	while (xinternal::lookup_tables<0>::lookup_text[static_cast<unsigned char>(*text)])
+		++text;
+	return text;
+}
+
+// Single byte text is scanned by the same kernels as in the parser
+template<>
+char* xml_reader<char>::find_text_end(char* text)
+{
+	return const_cast<char*>(xinternal::scan_kernels[xinternal::scan_text](text));
+}
+
+template<typename ItemType>
+ItemType* xml_reader<ItemType>::find_end(ItemType* text, const char* terminator)
+{
+	for (; *text; ++text)
+	{
+		std::size_t i = 0;
+		while (terminator[i] && text[i] == ItemType(terminator[i]))
+			++i;
+		if (!terminator[i])
+			return text + i - 1;
+	}
+	return text;
+}
+
+template<typename ItemType>
+void xml_reader<ItemType>::push_name(const ItemType* name, std::size_t size)
+{
+	xinternal::grow_array(m_name_offsets, m_depth, m_depth_capacity, m_depth + 1, 32);
+	xinternal::grow_array(m_names, m_names_size, m_names_capacity, m_names_size + size + 1, 1024);
+
+	// Append zero-terminated copy
+	m_name_offsets[m_depth++] = m_names_size;
+	std::memcpy(m_names + m_names_size, name, size * sizeof(ItemType));
+	m_names_size += size;
+	m_names[m_names_size++] = ItemType('\0');
+}
+
+// Explicit instantiations
+template class xml_reader<char>;
+
+template reader_event xml_reader<char>::next<parse_default>();
+template reader_event xml_reader<char>::next<parse_non_destructive>();
+template reader_event xml_reader<char>::next<parse_fastest>();
+template reader_event xml_reader<char>::next<parse_full>();
+template reader_event xml_reader<char>::next<parse_no_data_nodes>();
+template reader_event xml_reader<char>::next<parse_trim_whitespace>();
+template reader_event xml_reader<char>::next<parse_trim_whitespace | parse_normalize_whitespace>();
+template reader_event xml_reader<char>::next<parse_validate_closing_tags>();
+template reader_event xml_reader<char>::next<parse_comment_nodes>();
+template reader_event xml_reader<char>::next<parse_declaration_node>();
+
+} /* namespace xcore */
+} /* namespace xprocesser */
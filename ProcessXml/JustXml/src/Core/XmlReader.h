@@ -0,0 +1,183 @@
+/*
+ * XmlReader.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLREADER_H_
+#define SRC_CORE_XMLREADER_H_
+
+#include "XmlDocument.h"
+
+#ifndef XPROC_READER_WINDOW_SIZE
+// Default size of input window of xml_reader, in characters.
+// Define XPROC_READER_WINDOW_SIZE before including XmlReader.h if you want to override the default value.
+// No single tag, comment, CDATA section or other markup may be longer than the window.
+#define XPROC_READER_WINDOW_SIZE (64 * 1024)
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+//! Events reported by xml_reader::next()
+enum reader_event
+{
+	reader_end_of_document,     //!< Input is exhausted and all elements are closed. Node is 0.
+	reader_start_element,       //!< Start tag. Node is an element with name and attributes, but no children.
+	reader_end_element,         //!< Closing tag, or end of empty element. Node is an element with name of the start tag.
+	reader_data,                //!< Text between tags. Node is a data node.
+	reader_cdata,               //!< CDATA section. Node is a CDATA node.
+	reader_comment,             //!< Comment. Node is a comment node.
+	reader_declaration,         //!< XML declaration. Node is a declaration node.
+	reader_doctype,             //!< DOCTYPE. Node is a DOCTYPE node.
+	reader_pi,                  //!< Processing instruction. Node is a PI node.
+	reader_need_more            //!< Reader constructed without read function needs more input from feed() or finish(). Node is 0.
+};
+
+///////////////////////////////////////////////////////////////////////////
+// XML reader
+
+//! This class parses XML text as a stream of events, without building a DOM tree.
+//! Text is pulled from a user supplied read function into a window of fixed size,
+//! so memory used does not depend on size of the input, only on nesting depth of elements.
+//! Tags, comments and other markup are parsed by the same functions as in xml_document::parse().
+//! <br><br>
+//! Alternatively, input can be pushed in chunks of any size by feed(), for example as it arrives from a socket.
+//! Chunks may end anywhere, also inside of a tag or character reference; next() then returns reader_need_more
+//! until the rest of the markup is fed, and continues where it stopped.
+//! <br><br>
+//! Call next() repeatedly to get events, and node() to get node describing the current event.
+//! Node, its attributes, and their names and values are valid until the following call to next().
+//! Names and values point into the window, which the parser modifies in the same way as parse() modifies its text.
+//! <br><br>
+//! Flags have the same meaning as for xml_document::parse(), except that:
+//! nodes disabled by flags produce no events;
+//! text and CDATA are not reported with xflags::parse_no_data_nodes;
+//! xflags::parse_no_element_values and xflags::parse_structural_index have no effect.
+//! Text longer than the window is reported as several data events, with trimming and normalization applied to each of them.
+//! <br><br>
+//! After parse_error has been thrown, the reader can only be destroyed.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_reader
+{
+public:
+
+	//! Type of user-defined function used to read input.
+	//! Function must read up to count characters into buffer, and return number of characters read, or 0 at end of input.
+	typedef std::size_t (read_func)(void*, ItemType*, std::size_t);
+
+	//! Constructs reader of input provided by read function.
+	//! \param read Function reading input.
+	//! \param source Pointer passed to read function, for example a FILE pointer for read_file().
+	//! \param window_size Size of input window in characters; must be at least 64.
+	xml_reader(read_func*, void*, std::size_t = XPROC_READER_WINDOW_SIZE);
+
+	//! Constructs reader of input pushed by feed().
+	//! \param window_size Size of input window in characters; must be at least 64.
+	explicit xml_reader(std::size_t = XPROC_READER_WINDOW_SIZE);
+
+	//! Destroys reader and frees the window.
+	~xml_reader();
+
+
+	//! Parses input up to the next event according to given flags.
+	//! In case of error, parse_error exception will be thrown.
+	//! <br><br>
+	//! next() is a member template defined in XmlReader.cpp, so only the Flags combinations
+	//! explicitly instantiated at the bottom of that file are available to the linker.
+	//! \return Kind of event; reader_end_of_document is returned for every call once input is exhausted.
+	//! Reader constructed without read function returns reader_need_more when it runs out of input before finish() is called.
+	template<int Flags>
+	reader_event next();
+
+
+	//! Appends input to the window of reader constructed without read function.
+	//! May only be called before the first call to next(), or after next() returned reader_need_more.
+	//! \param data Characters to append; they are copied, and need not be zero-terminated.
+	//! \param size Number of characters.
+	//! \return Number of characters appended, which is less than size if the window is full.
+	//! Call next() until it returns reader_need_more, then feed the rest.
+	std::size_t feed(const ItemType*, std::size_t);
+
+
+	//! Marks end of input of reader constructed without read function.
+	//! Following calls to next() report remaining events, and then reader_end_of_document,
+	//! or throw parse_error if input ended inside of the document.
+	void finish();
+
+
+	//! Gets node describing the current event.
+	//! \return Pointer to node, or 0 at end of document.
+	xml_node<ItemType>* node() const
+	{
+		return m_node;
+	}
+
+
+#if !defined(XPROC_NO_STDLIB)
+	//! Read function for input from a C stream.
+	//! \param source Pointer to FILE opened for reading.
+	static std::size_t read_file(void*, ItemType*, std::size_t);
+#endif
+
+private:
+
+	// Restrictive copy constructor and assignment operator
+	xml_reader(const xml_reader&);
+	void operator=(const xml_reader&);
+
+	// Move unconsumed input to start of window
+	void compact();
+
+	// Move unconsumed input to start of window and read more after it.
+	// Return false if nothing could be read because input is exhausted, window is full, or input is pushed.
+	bool fill();
+
+	// Check if more input may come from feed() after fill() failed
+	bool waiting() const
+	{
+		return !m_read && !m_eof && std::size_t(m_end - m_begin) != m_window_size;
+	}
+
+	// Find end of markup starting at m_begin, or return 0 if it is not in the window yet
+	ItemType* find_markup_end() const;
+
+	// Find < ending text, or zero terminator
+	static ItemType* find_text_end(ItemType*);
+
+	// Find sequence of characters ending at terminator and return pointer to its last character, or return pointer to zero terminator
+	static ItemType* find_end(ItemType*, const char*);
+
+	// Push copy of name of element opened by a start tag
+	void push_name(const ItemType*, std::size_t);
+
+	xml_document<ItemType> m_document;          // Memory pool and parsing functions for nodes of events
+	read_func* m_read;                          // Function reading input, or 0 if input is pushed by feed()
+	void* m_source;                             // Argument of read function
+	ItemType* m_window;                         // Window of input, one character longer for zero terminator
+	std::size_t m_window_size;                  // Size of window, without terminator
+	ItemType* m_begin;                          // Start of unconsumed input in window
+	ItemType* m_end;                            // End of input in window, always zero-terminated
+	ItemType* m_restore;                        // Character overwritten by terminator of the last text event, or 0
+	ItemType m_restore_char;                    // Original value of that character
+	xml_node<ItemType>* m_node;                 // Node of current event
+	bool m_started;                             // BOM was checked
+	bool m_eof;                                 // Read function returned 0, or finish() was called
+	bool m_pending_end;                         // End of empty element comes next
+	bool m_continued;                           // Last data event ended at window boundary, not at <
+	ItemType* m_names;                          // Names of open elements, each zero-terminated
+	std::size_t m_names_size;                   // Characters used in m_names
+	std::size_t m_names_capacity;               // Characters allocated in m_names
+	std::size_t* m_name_offsets;                // Start of each open element name in m_names
+	std::size_t m_depth;                        // Number of open elements
+	std::size_t m_depth_capacity;               // Entries allocated in m_name_offsets
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLREADER_H_ */
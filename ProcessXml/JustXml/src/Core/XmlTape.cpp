@@ -0,0 +1,589 @@
+/*
+ * XmlTape.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "XmlTape.h"
+
+#include "Internal/CoreAlgorithms.h"
+#include "Internal/LookupTables.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstdio>       // For std::FILE, std::fopen, std::fwrite
+#include <cstring>      // For std::memset
+#include <stdexcept>    // For std::runtime_error
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+using namespace xinternal::xflags;
+
+namespace xinternal
+{
+
+// Header of binary image of xml_tape; records of nodes, records of attributes and string table follow it.
+// Size of header and of each part is a multiple of 8 bytes, so that records stay aligned.
+struct tape_image_header
+{
+	unsigned magic;             // Identifies image, and its byte order
+	unsigned version;           // Version of image format
+	unsigned item_size;         // Size of character type
+	int flags;                  // Flags tape was parsed with
+	unsigned source[2];         // Key of source text, low and high half
+	unsigned node_count;        // Number of records of nodes
+	unsigned attribute_count;   // Number of records of attributes
+	unsigned string_size;       // Size of string table, in characters
+	unsigned reserved;          // Zero
+	unsigned checksum[2];       // Checksum of the rest of image
+};
+
+const unsigned tape_image_magic = 0x50545058;   // "XPTP" in little endian order
+const unsigned tape_image_version = 1;
+
+// Size of string table in image, in bytes, padded to the alignment of parts
+inline std::size_t tape_image_table_bytes(std::size_t size, std::size_t item_size)
+{
+	return (size * item_size + 7) & ~std::size_t(7);
+}
+
+// Checksum of image after its header, as two running sums of its words like Fletcher's checksum
+inline void tape_image_checksum(const tape_image_header* header, std::size_t bytes, unsigned* checksum)
+{
+	const unsigned* word = reinterpret_cast<const unsigned*>(header + 1);
+	const unsigned* end = word + (bytes - sizeof(tape_image_header)) / sizeof(unsigned);
+	unsigned low = 1, high = 0;
+	for (; word != end; ++word)
+	{
+		low += *word;
+		high += low;
+	}
+	checksum[0] = low;
+	checksum[1] = high;
+}
+
+} /* namespace xinternal */
+
+///////////////////////////////////////////////////////////////////////
+// Tape
+
+template<typename ItemType>
+xml_tape<ItemType>::xml_tape()
+: m_text(0)
+  , m_flags(0)
+  , m_image(false)
+  , m_nodes(0)
+  , m_node_count(0)
+  , m_node_capacity(0)
+  , m_attributes(0)
+  , m_attribute_count(0)
+  , m_attribute_capacity(0)
+#if defined(XPROC_COMPACT_NODES)
+  , m_size(0)
+#endif
+{
+	clear();
+}
+
+template<typename ItemType>
+xml_tape<ItemType>::~xml_tape()
+{
+	if (!m_image)
+	{
+		delete[] m_nodes;
+		delete[] m_attributes;
+	}
+}
+
+template<typename ItemType>
+template<int Flags>
+void xml_tape<ItemType>::parse(ItemType* text)
+{
+	assert(text);
+
+	// Nodes are recorded one at a time, so none of the options building the tree differently apply
+	const int TapeFlags = Flags & ~(parse_structural_index | parse_lazy | parse_intern_names);
+
+	// Start with the document
+	clear();
+	m_text = text;
+	m_flags = Flags;
+
+#if defined(XPROC_COMPACT_NODES)
+	// Strings of parsed nodes are kept by offset in the text, so it must fit in the range of offsets
+	m_size = xinternal::measure(text) + 1;
+	if (m_size > xinternal::cage_size)
+		RAPIDXML_PARSE_ERROR("text too long", text);
+	m_document.cage_text(text, m_size);
+#endif
+
+	// Skip UTF-8 BOM
+	if (static_cast<unsigned char>(text[0]) == 0xEF &&
+			static_cast<unsigned char>(text[1]) == 0xBB &&
+			static_cast<unsigned char>(text[2]) == 0xBF)
+		text += 3;
+
+	// Open element, whose end field links to the element enclosing it until it is closed
+	std::size_t open = 0;
+	std::size_t depth = 0;
+	while (1)
+	{
+		// Skip whitespace before node
+		ItemType* contents_start = text;
+		while (xinternal::lookup_tables<0>::lookup_whitespace[static_cast<unsigned char>(*text)])
+			++text;
+		ItemType next_char = *text;
+
+		// Text ends in front of markup or terminator, which might have been overwritten by its own terminator
+		after_data:
+
+		// End of text
+		if (next_char == ItemType('\0'))
+		{
+			if (depth)
+				RAPIDXML_PARSE_ERROR("unexpected end of data", text);
+			break;
+		}
+
+		// Text, which is only allowed inside elements
+		if (next_char != ItemType('<'))
+		{
+			if (!depth)
+				RAPIDXML_PARSE_ERROR("expected <", text);
+			xml_node<ItemType>* data;
+			next_char = m_document.template parse_data<TapeFlags>(text, contents_start, data);
+			if (!(Flags & parse_no_data_nodes))
+			{
+				std::size_t index = record(data, text);
+				m_nodes[index].end = static_cast<unsigned>(m_node_count);
+			}
+
+			// Add data to open element if no data exists yet
+			if (!(Flags & parse_no_element_values))
+			{
+				node_record& element = m_nodes[open];
+				if (*string(element.value) == ItemType('\0'))
+				{
+					element.value = offset(data->value(), data->value_size(), text);
+					element.value_size = static_cast<unsigned>(data->value_size());
+				}
+			}
+			release(false);
+			goto after_data;
+		}
+
+		// Markup, with the open element to match a closing tag
+		++text;     // Skip '<'
+		xml_node<ItemType>* closing = 0;
+		if (depth && *text == ItemType('/'))
+			closing = m_document.allocate_node(node_element, m_text + m_nodes[open].name, 0, m_nodes[open].name_size);
+		int step;
+		xml_node<ItemType>* node = m_document.template parse_markup<TapeFlags>(text, closing, step);
+		if (step < 0)
+		{
+			// Close element, so that its subtree ends here
+			std::size_t parent = m_nodes[open].end;
+			m_nodes[open].end = static_cast<unsigned>(m_node_count);
+			open = parent;
+			--depth;
+		}
+		else if (node)
+		{
+			std::size_t index = record(node, text);
+			if (step > 0)
+			{
+				m_nodes[index].end = static_cast<unsigned>(open);
+				open = index;
+				++depth;
+			}
+			else
+				m_nodes[index].end = static_cast<unsigned>(m_node_count);
+		}
+		release(false);
+	}
+
+	// Document ends after its last node
+	m_nodes[0].end = static_cast<unsigned>(m_node_count);
+	release(true);
+}
+
+template<typename ItemType>
+void xml_tape<ItemType>::clear()
+{
+	m_node_count = 0;
+	m_attribute_count = 0;
+	m_text = 0;
+	m_flags = 0;
+	release(true);
+
+	// Records of image are left to their owner
+	if (m_image)
+	{
+		m_nodes = 0;
+		m_attributes = 0;
+		m_image = false;
+	}
+
+	// Empty document remains
+	xinternal::grow_array(m_nodes, 0, m_node_capacity, 1, 256);
+	node_record& document = m_nodes[m_node_count++];
+	document.type = node_document;
+	document.name = document.value = no_string;
+	document.name_size = document.value_size = 0;
+	document.end = 1;
+	document.attribute = document.attribute_end = 0;
+}
+
+template<typename ItemType>
+bool xml_tape<ItemType>::load(const ItemType* image, std::size_t size, int flags, unsigned long source)
+{
+	assert(image || !size);
+	clear();
+
+	// Identify image; parts are read in place, so it must be aligned for them
+	const xinternal::tape_image_header* header = reinterpret_cast<const xinternal::tape_image_header*>(image);
+	std::size_t bytes = size * sizeof(ItemType);
+	if (bytes < sizeof(xinternal::tape_image_header) || (reinterpret_cast<std::size_t>(image) & (sizeof(unsigned) - 1)))
+		return false;
+	if (header->magic != xinternal::tape_image_magic || header->version != xinternal::tape_image_version || header->item_size != sizeof(ItemType))
+		return false;
+
+	// Reject image of other contents
+	if (header->flags != flags || header->source[0] != static_cast<unsigned>(source & 0xFFFFFFFFul) ||
+			header->source[1] != static_cast<unsigned>(source >> 16 >> 16))
+		return false;
+	std::size_t expected = sizeof(xinternal::tape_image_header) +
+			header->node_count * sizeof(node_record) +
+			header->attribute_count * sizeof(attribute_record) +
+			xinternal::tape_image_table_bytes(header->string_size, sizeof(ItemType));
+	if (header->node_count == 0 || bytes != expected)
+		return false;
+	unsigned checksum[2];
+	xinternal::tape_image_checksum(header, bytes, checksum);
+	if (checksum[0] != header->checksum[0] || checksum[1] != header->checksum[1])
+		return false;
+
+	// Checksum guards against damage, not against images made to pass it, so every link and string is checked too
+	const node_record* nodes = reinterpret_cast<const node_record*>(header + 1);
+	const attribute_record* attributes = reinterpret_cast<const attribute_record*>(nodes + header->node_count);
+	const ItemType* table = reinterpret_cast<const ItemType*>(attributes + header->attribute_count);
+	if (!check_image(nodes, header->node_count, attributes, header->attribute_count, table, header->string_size))
+		return false;
+
+	// Records replace storage of the tape, which is released
+	delete[] m_nodes;
+	delete[] m_attributes;
+	m_node_capacity = 0;
+	m_attribute_capacity = 0;
+	m_image = true;
+	m_flags = flags;
+	m_nodes = const_cast<node_record*>(reinterpret_cast<const node_record*>(header + 1));
+	m_node_count = header->node_count;
+	m_attributes = const_cast<attribute_record*>(reinterpret_cast<const attribute_record*>(m_nodes + m_node_count));
+	m_attribute_count = header->attribute_count;
+	m_text = const_cast<ItemType*>(reinterpret_cast<const ItemType*>(m_attributes + m_attribute_count));
+	return true;
+}
+
+template<typename ItemType>
+bool xml_tape<ItemType>::check_image(const node_record* nodes, std::size_t node_count,
+		const attribute_record* attributes, std::size_t attribute_count, const ItemType* table, std::size_t string_size)
+{
+	// Document comes first, and spans all nodes
+	if (nodes[0].end != node_count)
+		return false;
+
+	for (std::size_t i = 0; i < node_count; ++i)
+	{
+		const node_record& node = nodes[i];
+		if (node.type > node_pi || (node.type == node_document) != (i == 0) || node.end <= i || node.end > node_count)
+			return false;
+		if (node.attribute > node.attribute_end || node.attribute_end > attribute_count)
+			return false;
+		if (!check_string(node.name, node.name_size, table, string_size) || !check_string(node.value, node.value_size, table, string_size))
+			return false;
+
+		// Children follow each other up to the end of node; once every node before passed, each node is visited
+		// as a child of its parent only, so all nodes are checked in linear time
+		for (std::size_t child = i + 1; child < node.end; child = nodes[child].end)
+			if (nodes[child].end <= child || nodes[child].end > node.end)
+				return false;
+	}
+
+	for (std::size_t i = 0; i < attribute_count; ++i)
+	{
+		const attribute_record& attribute = attributes[i];
+		if (!check_string(attribute.name, attribute.name_size, table, string_size) || !check_string(attribute.value, attribute.value_size, table, string_size))
+			return false;
+	}
+	return true;
+}
+
+template<typename ItemType>
+bool xml_tape<ItemType>::check_string(unsigned offset, unsigned size, const ItemType* table, std::size_t string_size)
+{
+	if (offset == no_string)
+		return size == 0;
+	return offset < string_size && size < string_size - offset && table[offset + size] == ItemType('\0');
+}
+
+#if !defined(XPROC_NO_STDLIB)
+
+template<typename ItemType>
+void xml_tape<ItemType>::save(const char* filename, unsigned long source) const
+{
+	assert(filename);
+
+	// Measure string table
+	std::size_t string_size = 0;
+	for (std::size_t i = 0; i < m_node_count; ++i)
+	{
+		if (m_nodes[i].name != no_string)
+			string_size += m_nodes[i].name_size + 1;
+		if (m_nodes[i].value != no_string)
+			string_size += m_nodes[i].value_size + 1;
+	}
+	for (std::size_t i = 0; i < m_attribute_count; ++i)
+		string_size += m_attributes[i].name_size + m_attributes[i].value_size + 2;
+	if (string_size >= no_string)
+		error("tape too large to save");
+
+	// Build image in memory, so that it is written at once
+	std::size_t bytes = sizeof(xinternal::tape_image_header) +
+			m_node_count * sizeof(node_record) +
+			m_attribute_count * sizeof(attribute_record) +
+			xinternal::tape_image_table_bytes(string_size, sizeof(ItemType));
+	char* image = new char[bytes];
+	std::memset(image, 0, bytes);
+	xinternal::tape_image_header* header = reinterpret_cast<xinternal::tape_image_header*>(image);
+	node_record* nodes = reinterpret_cast<node_record*>(header + 1);
+	attribute_record* attributes = reinterpret_cast<attribute_record*>(nodes + m_node_count);
+	ItemType* table = reinterpret_cast<ItemType*>(attributes + m_attribute_count);
+
+	// Records refer to strings in the table instead of the text
+	std::size_t used = 0;
+	unsigned names[2 * 256];
+	for (std::size_t i = 0; i < 256; ++i)
+		names[2 * i] = no_string;
+	for (std::size_t i = 0; i < m_node_count; ++i)
+	{
+		nodes[i] = m_nodes[i];
+		nodes[i].name = copy_string(m_nodes[i].name, m_nodes[i].name_size, table, used, names);
+		nodes[i].value = copy_string(m_nodes[i].value, m_nodes[i].value_size, table, used, 0);
+	}
+	for (std::size_t i = 0; i < m_attribute_count; ++i)
+	{
+		attributes[i] = m_attributes[i];
+		attributes[i].name = copy_string(m_attributes[i].name, m_attributes[i].name_size, table, used, names);
+		attributes[i].value = copy_string(m_attributes[i].value, m_attributes[i].value_size, table, used, 0);
+	}
+
+	// Table shrinks by names shared
+	string_size = used;
+	bytes = sizeof(xinternal::tape_image_header) +
+			m_node_count * sizeof(node_record) +
+			m_attribute_count * sizeof(attribute_record) +
+			xinternal::tape_image_table_bytes(string_size, sizeof(ItemType));
+
+	header->magic = xinternal::tape_image_magic;
+	header->version = xinternal::tape_image_version;
+	header->item_size = sizeof(ItemType);
+	header->flags = m_flags;
+	header->source[0] = static_cast<unsigned>(source & 0xFFFFFFFFul);
+	header->source[1] = static_cast<unsigned>(source >> 16 >> 16);
+	header->node_count = static_cast<unsigned>(m_node_count);
+	header->attribute_count = static_cast<unsigned>(m_attribute_count);
+	header->string_size = static_cast<unsigned>(string_size);
+	xinternal::tape_image_checksum(header, bytes, header->checksum);
+
+	// Write image
+	std::FILE* file = std::fopen(filename, "wb");
+	bool failed = !file || std::fwrite(image, 1, bytes, file) != bytes;
+	if (file && std::fclose(file) != 0)
+		failed = true;
+	delete[] image;
+	if (failed)
+		error("cannot write file");
+}
+
+template<typename ItemType>
+void xml_tape<ItemType>::error(const char* what)
+{
+#if defined(RAPIDXML_NO_EXCEPTIONS)
+	RAPIDXML_PARSE_ERROR(what, 0);
+#else
+	throw std::runtime_error(what);
+#endif
+}
+
+#endif
+
+template<typename ItemType>
+unsigned xml_tape<ItemType>::copy_string(unsigned offset, unsigned size, ItemType* table, std::size_t& used, unsigned* names) const
+{
+	if (offset == no_string)
+		return no_string;
+
+	// Names repeat, so names copied lately are looked up by size and ends, and shared
+	const ItemType* string = m_text + offset;
+	unsigned* slot = 0;
+	if (names && size)
+	{
+		slot = names + 2 * ((size * 31 + static_cast<unsigned>(string[0]) * 7 + static_cast<unsigned>(string[size - 1])) & 255);
+		if (slot[0] != no_string && slot[1] == size && xinternal::compare(table + slot[0], size, string, size, true))
+			return slot[0];
+	}
+
+	unsigned result = static_cast<unsigned>(used);
+	for (unsigned i = 0; i < size; ++i)
+		table[used++] = string[i];
+	table[used++] = ItemType('\0');
+	if (slot)
+	{
+		slot[0] = result;
+		slot[1] = size;
+	}
+	return result;
+}
+
+template<typename ItemType>
+xml_tape_node<ItemType> xml_tape<ItemType>::document() const
+{
+	return xml_tape_node<ItemType>(this, 0, m_node_count);
+}
+
+template<typename ItemType>
+std::size_t xml_tape<ItemType>::record(const xml_node<ItemType>* node, const ItemType* end)
+{
+	xinternal::grow_array(m_nodes, m_node_count, m_node_capacity, m_node_count + 1, 256);
+	node_record& result = m_nodes[m_node_count];
+	result.type = node->type();
+	result.name = offset(node->name(), node->name_size(), end);
+	result.name_size = static_cast<unsigned>(node->name_size());
+	result.value = offset(node->value(), node->value_size(), end);
+	result.value_size = static_cast<unsigned>(node->value_size());
+	result.attribute = static_cast<unsigned>(m_attribute_count);
+
+	// Attributes follow attributes of previous nodes
+	for (xml_attribute<ItemType>* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+	{
+		xinternal::grow_array(m_attributes, m_attribute_count, m_attribute_capacity, m_attribute_count + 1, 256);
+		attribute_record& recorded = m_attributes[m_attribute_count++];
+		recorded.name = offset(attribute->name(), attribute->name_size(), end);
+		recorded.name_size = static_cast<unsigned>(attribute->name_size());
+		recorded.value = offset(attribute->value(), attribute->value_size(), end);
+		recorded.value_size = static_cast<unsigned>(attribute->value_size());
+	}
+	result.attribute_end = static_cast<unsigned>(m_attribute_count);
+	return m_node_count++;
+}
+
+template<typename ItemType>
+unsigned xml_tape<ItemType>::offset(const ItemType* string, std::size_t size, const ItemType* end) const
+{
+	// Empty strings of nodes lie outside the text
+	if (string < m_text || string >= end)
+		return no_string;
+	std::size_t result = string - m_text;
+	if (result + size >= no_string)
+		RAPIDXML_PARSE_ERROR("text too long", const_cast<ItemType*>(string));
+	return static_cast<unsigned>(result);
+}
+
+template<typename ItemType>
+void xml_tape<ItemType>::release(bool all)
+{
+#if defined(XPROC_COMPACT_NODES)
+	// Cage is reserved again with the text after it is released, so it is kept until it grows
+	if (!all && m_document.m_ptr - m_document.m_cage < RAPIDXML_DYNAMIC_POOL_SIZE)
+		return;
+	m_document.memory_pool<ItemType>::clear();
+	if (!all)
+		m_document.cage_text(m_text, m_size);
+#else
+	(void)all;
+	m_document.memory_pool<ItemType>::clear();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////
+// Tape node
+
+template<typename ItemType>
+xml_tape_node<ItemType> xml_tape_node<ItemType>::first_node(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name && name_size == 0)
+		name_size = xinternal::measure(name);
+	const typename xml_tape<ItemType>::node_record* nodes = m_tape->nodes();
+	std::size_t end = nodes[m_index].end;
+	for (std::size_t child = m_index + 1; child < end; child = nodes[child].end)
+		if (!name || xinternal::compare(m_tape->string(nodes[child].name), nodes[child].name_size, name, name_size, case_sensitive))
+			return xml_tape_node(m_tape, child, end);
+	return xml_tape_node();
+}
+
+template<typename ItemType>
+xml_tape_node<ItemType> xml_tape_node<ItemType>::next_sibling(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name && name_size == 0)
+		name_size = xinternal::measure(name);
+	const typename xml_tape<ItemType>::node_record* nodes = m_tape->nodes();
+	for (std::size_t sibling = nodes[m_index].end; sibling < m_parent_end; sibling = nodes[sibling].end)
+		if (!name || xinternal::compare(m_tape->string(nodes[sibling].name), nodes[sibling].name_size, name, name_size, case_sensitive))
+			return xml_tape_node(m_tape, sibling, m_parent_end);
+	return xml_tape_node();
+}
+
+template<typename ItemType>
+xml_tape_attribute<ItemType> xml_tape_node<ItemType>::first_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (record().attribute == record().attribute_end)
+		return xml_tape_attribute<ItemType>();
+	xml_tape_attribute<ItemType> first(m_tape, record().attribute, record().attribute_end);
+	if (!name)
+		return first;
+	if (name_size == 0)
+		name_size = xinternal::measure(name);
+	if (xinternal::compare(first.name(), first.name_size(), name, name_size, case_sensitive))
+		return first;
+	return first.next_attribute(name, name_size, case_sensitive);
+}
+
+///////////////////////////////////////////////////////////////////////
+// Tape attribute
+
+template<typename ItemType>
+xml_tape_attribute<ItemType> xml_tape_attribute<ItemType>::next_attribute(const ItemType* name, std::size_t name_size, bool case_sensitive) const
+{
+	if (name && name_size == 0)
+		name_size = xinternal::measure(name);
+	const typename xml_tape<ItemType>::attribute_record* attributes = m_tape->attributes();
+	for (std::size_t attribute = m_index + 1; attribute < m_end; ++attribute)
+		if (!name || xinternal::compare(m_tape->string(attributes[attribute].name), attributes[attribute].name_size, name, name_size, case_sensitive))
+			return xml_tape_attribute(m_tape, attribute, m_end);
+	return xml_tape_attribute();
+}
+
+// Explicit instantiations
+template class xml_tape<char>;
+template class xml_tape_node<char>;
+template class xml_tape_attribute<char>;
+
+template void xml_tape<char>::parse<parse_default>(char*);
+template void xml_tape<char>::parse<parse_non_destructive>(char*);
+template void xml_tape<char>::parse<parse_fastest>(char*);
+template void xml_tape<char>::parse<parse_full>(char*);
+template void xml_tape<char>::parse<parse_no_data_nodes>(char*);
+template void xml_tape<char>::parse<parse_trim_whitespace>(char*);
+template void xml_tape<char>::parse<parse_trim_whitespace | parse_normalize_whitespace>(char*);
+template void xml_tape<char>::parse<parse_validate_closing_tags>(char*);
+template void xml_tape<char>::parse<parse_comment_nodes>(char*);
+template void xml_tape<char>::parse<parse_declaration_node>(char*);
+
+} /* namespace xcore */
+} /* namespace xprocesser */
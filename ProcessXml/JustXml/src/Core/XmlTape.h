@@ -0,0 +1,579 @@
+/*
+ * XmlTape.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef SRC_CORE_XMLTAPE_H_
+#define SRC_CORE_XMLTAPE_H_
+
+#include "XmlDocument.h"
+
+// If standard library is disabled, user must provide implementations of required functions and typedefs
+#if !defined(XPROC_NO_STDLIB)
+#include <cstddef>      // For std::ptrdiff_t
+#include <iterator>     // For std::forward_iterator_tag
+#endif
+
+namespace xprocesser
+{
+namespace xcore
+{
+
+template<class ItemType> class xml_tape_node;
+template<class ItemType> class xml_tape_attribute;
+
+///////////////////////////////////////////////////////////////////////////
+// XML tape
+
+//! This class holds a parsed document in flat, read-only form: a tape.
+//! Nodes are records of fixed size in one array, in document order, with the document itself first;
+//! attributes are records in a second array, in the same order.
+//! A node record holds its type, offsets and sizes of name and value in the text,
+//! index past the last node of its subtree, and range of its attributes,
+//! so whole subtrees are skipped in constant time and scans of the tape read memory linearly.
+//! <br><br>
+//! Use parse() to build the tape from a zero-terminated XML text string.
+//! Text is parsed in place with the same functions as xml_document::parse(), so it is modified in the same way,
+//! and the tape describes the same tree as the DOM built with the same flags;
+//! but no node is linked, and nodes of the parser are released as soon as they are recorded.
+//! Names and values are offsets in the text, which must persist for the lifetime of the tape and be shorter than 4 GB.
+//! <br><br>
+//! Walk the tree from document() with xml_tape_node, which offers navigation like xml_node,
+//! or scan nodes() and attributes() directly.
+//! Parent nodes are not recorded, so the tape is walked downwards only.
+//! Flags xflags::parse_structural_index, xflags::parse_lazy and xflags::parse_intern_names are ignored.
+//! <br><br>
+//! A parsed tape can be saved into a binary image with save(), and the image used later through load(),
+//! with no parsing and no allocation: records and strings are read where the image lies, for example in a file mapped by xml_file.
+//! The image starts with a header holding format version, parse flags, a key identifying the source and a checksum,
+//! so that load() rejects images which are stale or damaged, and the source can be parsed again instead:
+//! <pre>
+//! xml_file<> image("catalog.xpt");
+//! if (!tape.load(image.data(), image.size(), parse_default, key))
+//! {
+//!     // Parse text of xml_file<> source("catalog.xml", file_copy_on_write) and save the tape
+//! }
+//! </pre>
+//! <br><br>
+//! parse() is a member template defined in XmlTape.cpp, so only the Flags combinations
+//! explicitly instantiated at the bottom of that file are available to the linker.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_tape
+{
+public:
+
+	//! Offset standing for no name or value
+	static const unsigned no_string = ~0u;
+
+	//! Record of a node
+	struct node_record
+	{
+		unsigned type;              //!< Type of node, one of node_type values
+		unsigned name;              //!< Offset of name in the text, or no_string if node has no name
+		unsigned name_size;         //!< Size of name
+		unsigned value;             //!< Offset of value in the text, or no_string if node has no value
+		unsigned value_size;        //!< Size of value
+		unsigned end;               //!< Index of the first node after the subtree of this node
+		unsigned attribute;         //!< Index of the first attribute of node
+		unsigned attribute_end;     //!< Index past the last attribute of node
+	};
+
+	//! Record of an attribute
+	struct attribute_record
+	{
+		unsigned name;              //!< Offset of name in the text
+		unsigned name_size;         //!< Size of name
+		unsigned value;             //!< Offset of value in the text
+		unsigned value_size;        //!< Size of value
+	};
+
+	//! Constructs empty tape
+	xml_tape();
+
+	//! Destroys tape
+	~xml_tape();
+
+
+	//! Parses zero-terminated XML string into the tape according to given flags.
+	//! Passed string will be modified by the parser, unless xflags::parse_non_destructive flag is used.
+	//! The string must persist for the lifetime of the tape.
+	//! In case of error, parse_error exception will be thrown.
+	//! <br><br>
+	//! Tape can be parsed into multiple times; each new call to parse replaces previous records.
+	//! \param text XML data to parse; pointer is non-const to denote fact that this data may be modified by the parser.
+	template<int Flags>
+	void parse(ItemType*);
+
+
+	//! Uses binary image written by save() as contents of the tape, without copying it.
+	//! Image is rejected if it was written by another version of the format or for another character type,
+	//! if it was parsed with other flags or from another source, or if its checksum does not match.
+	//! Image is also rejected unless every subtree ends within its parent, every range of attributes lies within the image,
+	//! and every name and value is a terminated string of the string table, so that a damaged image which passes
+	//! the checksum is never read beyond its end. Checks take time linear in the size of the image.
+	//! Accepted image must persist for the lifetime of the tape, or until it is parsed or cleared,
+	//! and its names and values must not be modified.
+	//! \param image Image to use, aligned at least at 4 bytes; memory mapped file is aligned at a page.
+	//! \param size Size of image, in characters of ItemType.
+	//! \param flags Flags tape is expected to be parsed with.
+	//! \param source Key of source text the tape is expected to be parsed from, as given to save().
+	//! \return True if image is used, false if it is rejected and the tape is empty.
+	bool load(const ItemType*, std::size_t, int, unsigned long = 0);
+
+#if !defined(XPROC_NO_STDLIB)
+	//! Saves tape into binary image file, for load().
+	//! Strings of names and values are collected into a table of zero-terminated strings,
+	//! so that the image does not need the text.
+	//! If file cannot be written, std::runtime_error is thrown, or parse_error if exceptions are disabled.
+	//! \param filename Name of file to write.
+	//! \param source Key of source text, for example its modification time or hash; load() requires the same key.
+	void save(const char*, unsigned long = 0) const;
+#endif
+
+
+	//! Removes all records, leaving just the empty document.
+	void clear();
+
+
+	//! Gets document, the root of the tree.
+	//! \return Node of the document.
+	xml_tape_node<ItemType> document() const;
+
+
+	//! Gets number of nodes, including the document.
+	//! \return Number of node records.
+	std::size_t size() const
+	{
+		return m_node_count;
+	}
+
+	//! Gets records of nodes, in document order; the document is the first one.
+	//! \return Pointer to array of size() records.
+	const node_record* nodes() const
+	{
+		return m_nodes;
+	}
+
+	//! Gets records of attributes, in document order.
+	//! \return Pointer to array of records.
+	const attribute_record* attributes() const
+	{
+		return m_attributes;
+	}
+
+	//! Gets string at offset in the text, as recorded for name or value.
+	//! Strings of a loaded image lie in memory which may be read-only, so they are never modified through the tape.
+	//! \param offset Offset of string, or no_string.
+	//! \return Pointer to string, or pointer to empty string for no_string.
+	const ItemType* string(unsigned offset) const
+	{
+		static const ItemType zero = ItemType('\0');
+		return offset == no_string ? &zero : m_text + offset;
+	}
+
+private:
+
+	// Restrictive copy constructor and assignment operator
+	xml_tape(const xml_tape&);
+	void operator=(const xml_tape&);
+
+	// Append record of node to the tape, with records of its attributes
+	std::size_t record(const xml_node<ItemType>*, const ItemType*);
+
+	// Get offset of string of parsed node, which lies before end in the text, or no_string if it is elsewhere
+	unsigned offset(const ItemType*, std::size_t, const ItemType*) const;
+
+	// Release nodes of the parser; with compact nodes, cage is kept for a while, because it is costly to reserve
+	void release(bool);
+
+	// Check that records of image link only to records of image, and refer only to terminated strings of its string table
+	static bool check_image(const node_record*, std::size_t, const attribute_record*, std::size_t, const ItemType*, std::size_t);
+
+	// Check that string of image lies in its string table, and is terminated
+	static bool check_string(unsigned, unsigned, const ItemType*, std::size_t);
+
+	// Copy string at offset in the text into string table of image, and return its offset there.
+	// Names are shared through cache of offsets and sizes of names in the table, if given.
+	unsigned copy_string(unsigned, unsigned, ItemType*, std::size_t&, unsigned*) const;
+
+#if !defined(XPROC_NO_STDLIB)
+	// Report failure to write image file
+	static void error(const char*);
+#endif
+
+	xml_document<ItemType> m_document;          // Memory pool and parsing functions for nodes being recorded
+	ItemType* m_text;                           // Text of the last parse, or string table of image
+	int m_flags;                                // Flags of the last parse
+	bool m_image;                               // Records and strings lie in image given to load(), which is not owned
+	node_record* m_nodes;                       // Records of nodes
+	std::size_t m_node_count;                   // Number of records of nodes
+	std::size_t m_node_capacity;                // Records of nodes allocated
+	attribute_record* m_attributes;             // Records of attributes
+	std::size_t m_attribute_count;              // Number of records of attributes
+	std::size_t m_attribute_capacity;           // Records of attributes allocated
+#if defined(XPROC_COMPACT_NODES)
+	std::size_t m_size;                         // Size of the text, which is registered again with the cage after it is released
+#endif
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Tape node
+
+//! This class refers to a node of xml_tape, and navigates the tape like xml_node navigates the DOM.
+//! It is a small value; default constructed one refers to no node and converts to false, like a null pointer.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_tape_node
+{
+public:
+
+	//! Constructs reference to no node
+	xml_tape_node()
+	: m_tape(0)
+	  , m_index(0)
+	  , m_parent_end(0){}
+
+	//! Constructs reference to node of tape.
+	//! \param tape Tape holding node.
+	//! \param index Index of node in the tape.
+	//! \param parent_end End of subtree of parent, which bounds siblings of node.
+	xml_tape_node(const xml_tape<ItemType>* tape, std::size_t index, std::size_t parent_end)
+	: m_tape(tape)
+	  , m_index(index)
+	  , m_parent_end(parent_end){}
+
+	//! Checks if node is referred to.
+	//! \return Non-zero if node is referred to, 0 otherwise.
+	operator const void*() const
+	{
+		return m_tape ? this : 0;
+	}
+
+	bool operator ==(const xml_tape_node& other) const
+	{
+		return m_tape == other.m_tape && m_index == other.m_index;
+	}
+
+	bool operator !=(const xml_tape_node& other) const
+	{
+		return !(*this == other);
+	}
+
+
+	//! Gets type of node.
+	//! \return Type of node.
+	node_type type() const
+	{
+		return static_cast<node_type>(record().type);
+	}
+
+	//! Gets name of node.
+	//! \return Name of node, or empty string if node has no name.
+	const ItemType* name() const
+	{
+		return m_tape->string(record().name);
+	}
+
+	//! Gets size of name, not including terminator character.
+	//! \return Size of node name, in characters.
+	std::size_t name_size() const
+	{
+		return record().name_size;
+	}
+
+	//! Gets value of node.
+	//! \return Value of node, or empty string if node has no value.
+	const ItemType* value() const
+	{
+		return m_tape->string(record().value);
+	}
+
+	//! Gets size of value, not including terminator character.
+	//! \return Size of node value, in characters.
+	std::size_t value_size() const
+	{
+		return record().value_size;
+	}
+
+	//! Gets index of node in the tape.
+	//! \return Index of record of node.
+	std::size_t index() const
+	{
+		return m_index;
+	}
+
+	//! Gets index of the first node after the subtree of this node.
+	//! Nodes from index() + 1 to this index are all descendants of node, in document order.
+	//! \return Index of record following the subtree.
+	std::size_t subtree_end() const
+	{
+		return record().end;
+	}
+
+
+	//! Gets first child node, optionally matching node name.
+	//! \param name Name of child to find, or 0 to return first child regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Found child, or no node if not found.
+	xml_tape_node first_node(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+	//! Gets next sibling node, optionally matching node name.
+	//! Behaviour is undefined for the document, or a node obtained by index without bound of its siblings.
+	//! \param name Name of sibling to find, or 0 to return next sibling regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Found sibling, or no node if not found.
+	xml_tape_node next_sibling(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+	//! Gets first attribute of node, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return first attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Found attribute, or no attribute if not found.
+	xml_tape_attribute<ItemType> first_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+private:
+
+	const typename xml_tape<ItemType>::node_record& record() const
+	{
+		return m_tape->nodes()[m_index];
+	}
+
+	const xml_tape<ItemType>* m_tape;           // Tape holding node, or 0 if no node is referred to
+	std::size_t m_index;                        // Index of node
+	std::size_t m_parent_end;                   // End of subtree of parent
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Tape attribute
+
+//! This class refers to an attribute of xml_tape, and navigates attributes of a node like xml_attribute.
+//! It is a small value; default constructed one refers to no attribute and converts to false, like a null pointer.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class xml_tape_attribute
+{
+public:
+
+	//! Constructs reference to no attribute
+	xml_tape_attribute()
+	: m_tape(0)
+	  , m_index(0)
+	  , m_end(0){}
+
+	//! Constructs reference to attribute of tape.
+	//! \param tape Tape holding attribute.
+	//! \param index Index of attribute in the tape.
+	//! \param end Index past the last attribute of the same node.
+	xml_tape_attribute(const xml_tape<ItemType>* tape, std::size_t index, std::size_t end)
+	: m_tape(tape)
+	  , m_index(index)
+	  , m_end(end){}
+
+	//! Checks if attribute is referred to.
+	//! \return Non-zero if attribute is referred to, 0 otherwise.
+	operator const void*() const
+	{
+		return m_tape ? this : 0;
+	}
+
+	bool operator ==(const xml_tape_attribute& other) const
+	{
+		return m_tape == other.m_tape && m_index == other.m_index;
+	}
+
+	bool operator !=(const xml_tape_attribute& other) const
+	{
+		return !(*this == other);
+	}
+
+
+	//! Gets name of attribute.
+	//! \return Name of attribute.
+	const ItemType* name() const
+	{
+		return m_tape->string(record().name);
+	}
+
+	//! Gets size of name, not including terminator character.
+	//! \return Size of attribute name, in characters.
+	std::size_t name_size() const
+	{
+		return record().name_size;
+	}
+
+	//! Gets value of attribute.
+	//! \return Value of attribute.
+	const ItemType* value() const
+	{
+		return m_tape->string(record().value);
+	}
+
+	//! Gets size of value, not including terminator character.
+	//! \return Size of attribute value, in characters.
+	std::size_t value_size() const
+	{
+		return record().value_size;
+	}
+
+
+	//! Gets next attribute of the same node, optionally matching attribute name.
+	//! \param name Name of attribute to find, or 0 to return next attribute regardless of its name; this string doesn't have to be zero-terminated if name_size is non-zero
+	//! \param name_size Size of name, in characters, or 0 to have size calculated automatically from string
+	//! \param case_sensitive Should name comparison be case-sensitive; non case-sensitive comparison works properly only for ASCII characters
+	//! \return Found attribute, or no attribute if not found.
+	xml_tape_attribute next_attribute(const ItemType* = 0, std::size_t = 0, bool = true) const;
+
+private:
+
+	const typename xml_tape<ItemType>::attribute_record& record() const
+	{
+		return m_tape->attributes()[m_index];
+	}
+
+	const xml_tape<ItemType>* m_tape;           // Tape holding attribute, or 0 if no attribute is referred to
+	std::size_t m_index;                        // Index of attribute
+	std::size_t m_end;                          // Index past the last attribute of the same node
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Tape iterators
+
+//! Iterator of child nodes of xml_tape_node, like node_iterator of xml_node.
+//! Its value is xml_tape_node; as the tape records no previous siblings, it only moves forward.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class tape_node_iterator
+{
+public:
+
+	typedef xml_tape_node<ItemType> value_type;
+	typedef const xml_tape_node<ItemType>& reference;
+	typedef const xml_tape_node<ItemType>* pointer;
+#if !defined(XPROC_NO_STDLIB)
+	typedef std::ptrdiff_t difference_type;
+	typedef std::forward_iterator_tag iterator_category;
+#endif
+
+	//! Constructs end iterator
+	tape_node_iterator(){}
+
+	//! Constructs iterator at the first child of node.
+	//! \param node Node whose children are iterated.
+	explicit tape_node_iterator(const xml_tape_node<ItemType>& node)
+	: m_node(node.first_node()){}
+
+	reference operator *() const
+	{
+		assert(m_node);
+		return m_node;
+	}
+
+	pointer operator->() const
+	{
+		assert(m_node);
+		return &m_node;
+	}
+
+	tape_node_iterator& operator++()
+	{
+		assert(m_node);
+		m_node = m_node.next_sibling();
+		return *this;
+	}
+
+	tape_node_iterator operator++(int)
+	{
+		tape_node_iterator tmp = *this;
+		++*this;
+		return tmp;
+	}
+
+	bool operator ==(const tape_node_iterator& rhs) const
+	{
+		return m_node == rhs.m_node;
+	}
+
+	bool operator !=(const tape_node_iterator& rhs) const
+	{
+		return m_node != rhs.m_node;
+	}
+
+private:
+
+	xml_tape_node<ItemType> m_node;             // Current child, or no node at end
+};
+
+//! Iterator of attributes of xml_tape_node, like attribute_iterator of xml_node.
+//! Its value is xml_tape_attribute, and it only moves forward.
+//! \param ItemType Character type to use.
+template<class ItemType = char>
+class tape_attribute_iterator
+{
+public:
+
+	typedef xml_tape_attribute<ItemType> value_type;
+	typedef const xml_tape_attribute<ItemType>& reference;
+	typedef const xml_tape_attribute<ItemType>* pointer;
+#if !defined(XPROC_NO_STDLIB)
+	typedef std::ptrdiff_t difference_type;
+	typedef std::forward_iterator_tag iterator_category;
+#endif
+
+	//! Constructs end iterator
+	tape_attribute_iterator(){}
+
+	//! Constructs iterator at the first attribute of node.
+	//! \param node Node whose attributes are iterated.
+	explicit tape_attribute_iterator(const xml_tape_node<ItemType>& node)
+	: m_attribute(node.first_attribute()){}
+
+	reference operator *() const
+	{
+		assert(m_attribute);
+		return m_attribute;
+	}
+
+	pointer operator->() const
+	{
+		assert(m_attribute);
+		return &m_attribute;
+	}
+
+	tape_attribute_iterator& operator++()
+	{
+		assert(m_attribute);
+		m_attribute = m_attribute.next_attribute();
+		return *this;
+	}
+
+	tape_attribute_iterator operator++(int)
+	{
+		tape_attribute_iterator tmp = *this;
+		++*this;
+		return tmp;
+	}
+
+	bool operator ==(const tape_attribute_iterator& rhs) const
+	{
+		return m_attribute == rhs.m_attribute;
+	}
+
+	bool operator !=(const tape_attribute_iterator& rhs) const
+	{
+		return m_attribute != rhs.m_attribute;
+	}
+
+private:
+
+	xml_tape_attribute<ItemType> m_attribute;   // Current attribute, or no attribute at end
+};
+
+} /* namespace xcore */
+} /* namespace xprocesser */
+
+#endif /* SRC_CORE_XMLTAPE_H_ */
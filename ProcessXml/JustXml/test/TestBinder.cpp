@@ -0,0 +1,240 @@
+/*
+ * TestBinder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlBindingGenerator.h"
+#include "TestBinding.h"    // Generated from TestBinding.xml by the makefile
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+const char order[] =
+		"<order id='4000000001' express='true'>"
+		"<customer id='18000000000'><name>Ann</name><phone>1</phone><phone>2</phone></customer>"
+		"<item sku='a1' weight='0.25' serial='12345678901'>3</item>"
+		"<unknown><item sku='zz'/></unknown>"
+		"<item sku='b2'> 7 </item>"
+		"<code>1</code><code>18446744073709551615</code><flag>1</flag><flag>false</flag>"
+		"<discount>2.5e-1</discount><reference>42</reference>"
+		"</order>";
+
+// Parse copy of text into order with generated code; return error message, or empty string
+std::string bound(const char* text, shop::Order& value)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	try
+	{
+		shop::parse<parse_default>(&copy[0], value);
+	}
+	catch (const parse_error& error)
+	{
+		return error.what();
+	}
+	return std::string();
+}
+
+void test_generated()
+{
+	// Members of every kind, with the multi-word type unsigned long
+	shop::Order value;
+	XTEST_CHECK(bound(order, value) == "");
+	XTEST_CHECK(value.id == 4000000001ul && value.express);
+	XTEST_CHECK(value.customer.id == 18000000000ul && value.customer.name == "Ann" && value.customer.phones.size() == 2);
+	XTEST_CHECK(value.items.size() == 2 && value.items[0].sku == "a1" && value.items[1].sku == "b2");
+	XTEST_CHECK(value.items[0].weight == 0.25 && value.items[0].serial == 12345678901ul && value.items[0].quantity == 3);
+	XTEST_CHECK(value.items[1].weight == 0 && value.items[1].serial == 0 && value.items[1].quantity == 7);
+	XTEST_CHECK(value.codes.size() == 2 && value.codes[1] == 18446744073709551615ul);
+	XTEST_CHECK(value.flags.size() == 2 && value.flags[0] && !value.flags[1]);
+	XTEST_CHECK(value.discount == 0.25f && value.reference == 42);
+
+	// Optional members are reset when read again
+	XTEST_CHECK(bound("<order id='1'><customer id='2'><name/></customer><item sku='c' serial='9'>1</item></order>", value) == "");
+	XTEST_CHECK(value.id == 1 && !value.express && value.customer.phones.empty() && value.items.size() == 1);
+	XTEST_CHECK(value.items[0].serial == 9 && value.codes.empty() && value.flags.empty() && value.discount == 0 && value.reference == 0);
+
+	// Occurrences and values are checked
+	const char* customer = "<customer id='2'><name/></customer>";
+	XTEST_CHECK(bound((std::string("<order>") + customer + "<item sku='c'>1</item></order>").c_str(), value) == "missing required attribute");
+	XTEST_CHECK(bound("<order id='1'><item sku='c'>1</item></order>", value) == "missing required element");
+	XTEST_CHECK(bound((std::string("<order id='1'>") + customer + customer + "<item sku='c'>1</item></order>").c_str(), value) == "repeated element");
+	XTEST_CHECK(bound((std::string("<order id='1'>") + customer + "</order>").c_str(), value) == "too few elements");
+	std::string items;
+	for (int i = 0; i < 4; ++i)
+		items += "<item sku='c'>1</item>";
+	XTEST_CHECK(bound((std::string("<order id='1'>") + customer + items + "</order>").c_str(), value) == "too many elements");
+	XTEST_CHECK(bound((std::string("<order id='-1'>") + customer + "<item sku='c'>1</item></order>").c_str(), value) == "number out of range");
+	XTEST_CHECK(bound((std::string("<order id='1'>") + customer + "<item sku='c' weight='0x10'>1</item></order>").c_str(), value) == "invalid number");
+	XTEST_CHECK(bound("<other/>", value) == "unexpected root element");
+}
+
+// Walk of element by binder, in the form of walk_dom()
+void walk_binder(xml_binder<char>& binder, std::string& out)
+{
+	out += '<';
+	out.append(binder.name(), binder.name_size());
+	while (binder.next_attribute<parse_default>())
+	{
+		out += ' ';
+		out.append(binder.name(), binder.name_size());
+		out += '=';
+		out.append(binder.value(), binder.value_size());
+	}
+	out += '>';
+	if (binder.enter<parse_default>())
+		while (binder.next_element<parse_default>())
+			walk_binder(binder, out);
+	out.append(binder.value(), binder.value_size());
+	out += '/';
+}
+
+// Walk of element of DOM: name, attributes, child elements and value
+void walk_dom(const xml_node<char>* node, std::string& out)
+{
+	out += '<';
+	out.append(node->name(), node->name_size());
+	for (const xml_attribute<char>* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+	{
+		out += ' ';
+		out.append(attribute->name(), attribute->name_size());
+		out += '=';
+		out.append(attribute->value(), attribute->value_size());
+	}
+	out += '>';
+	for (const xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+		if (child->type() == node_element)
+			walk_dom(child, out);
+	out.append(node->value(), node->value_size());
+	out += '/';
+}
+
+void test_binder()
+{
+	// Elements, attributes and values are those of the DOM
+	const char text[] = "<?xml version='1.0'?><!-- c --><a x='1' y='&lt;2&gt;'>first<b/><c z=''>v &amp; w<d>x</d>tail</c>"
+			"<![CDATA[cd]]><e><f><g/></f></e></a>";
+	std::vector<char> copy(text, text + sizeof(text));
+	xml_document<char> document;
+	document.parse<parse_default>(&copy[0]);
+	std::string expected;
+	walk_dom(document.first_node("a"), expected);
+
+	std::vector<char> again(text, text + sizeof(text));
+	xml_binder<char> binder;
+	binder.begin<parse_default>(&again[0]);
+	std::string walked;
+	walk_binder(binder, walked);
+	XTEST_CHECK(walked == expected);
+
+	// Skipped and read elements
+	std::vector<char> third(text, text + sizeof(text));
+	binder.begin<parse_default>(&third[0]);
+	XTEST_CHECK(binder.enter<parse_default>() && binder.next_element<parse_default>() && binder.name_is("b", 1));
+	binder.skip<parse_default>();
+	XTEST_CHECK(binder.next_element<parse_default>() && binder.name_is("c", 1));
+	binder.read_value<parse_default>();
+	XTEST_STRING(binder.value(), binder.value_size(), "v & w");
+	XTEST_CHECK(binder.next_element<parse_default>() && binder.name_is("e", 1));
+	binder.skip<parse_default>();
+	XTEST_CHECK(!binder.next_element<parse_default>());
+
+	// Mismatched closing tag
+	char broken[] = "<a><b></c></a>";
+	binder.begin<parse_validate_closing_tags>(broken);
+	XTEST_THROWS(while (binder.enter<parse_validate_closing_tags>() && binder.next_element<parse_validate_closing_tags>()) binder.skip<parse_validate_closing_tags>());
+}
+
+// Convert text to double, or return -1 on error
+double floating(const char* text)
+{
+	double result;
+	try
+	{
+		convert_value(text, std::strlen(text), result);
+	}
+	catch (const parse_error&)
+	{
+		return -1;
+	}
+	return result;
+}
+
+void test_convert()
+{
+	// Lexical form of xs:double
+	XTEST_CHECK(floating("1.5") == 1.5 && floating(" -2e3 ") == -2000 && floating(".5") == 0.5 && floating("5.") == 5);
+	XTEST_CHECK(floating("+1E-2") == 0.01 && floating("0012.50") == 12.5 && floating("-0") == 0);
+	XTEST_CHECK(floating("INF") > 1e308 && floating("+INF") > 1e308 && floating("-INF") < -1e308 && std::isnan(floating("NaN")));
+
+	// Other forms strtod takes, and malformed numbers
+	const char* invalid[] = { "0x10", "0X1p3", "inf", "-inf", "Infinity", "nan", "NAN", "1e", "1e+", ".", "", " ", "1.5.2", "1,5", "e5", "+-1", "1 2", "1f" };
+	for (std::size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+		if (!XTEST_CHECK(floating(invalid[i]) == -1))
+			std::printf("  '%s' was converted\n", invalid[i]);
+
+	float single;
+	convert_value("3.25", 4, single);
+	XTEST_CHECK(single == 3.25f);
+	unsigned long number;
+	XTEST_THROWS(convert_value("18446744073709551616", 20, number));
+	bool truth;
+	convert_value(" 0 ", 3, truth);
+	XTEST_CHECK(!truth);
+	XTEST_THROWS(convert_value("yes", 3, truth));
+}
+
+// Error of generator reading schema, or empty string
+std::string schema_error(const char* schema)
+{
+	std::vector<char> copy(schema, schema + std::strlen(schema) + 1);
+	xml_binding_generator generator;
+	try
+	{
+		generator.parse_schema(&copy[0]);
+	}
+	catch (const parse_error& error)
+	{
+		return error.what();
+	}
+	return std::string();
+}
+
+void test_schema()
+{
+	// Types of members are named, so generated code never writes a multi-word type before ()
+	std::vector<char> schema(1, 0);
+	const char text[] = "<binding><struct name='S'><attribute name='a' type='unsigned long'/>"
+			"<element name='b' type='unsigned long' min='0' max='unbounded'/></struct></binding>";
+	schema.assign(text, text + sizeof(text));
+	xml_binding_generator generator;
+	generator.parse_schema(&schema[0]);
+	std::string header = generator.header();
+	XTEST_CHECK(header.find("typedef unsigned long a_type;") != std::string::npos);
+	XTEST_CHECK(header.find("std::vector<b_type> b;") != std::string::npos);
+	XTEST_CHECK(header.find("unsigned long()") == std::string::npos);
+
+	XTEST_CHECK(schema_error("<binding><struct name='S'><attribute name='a' type='int'/><attribute name='a_type' type='int'/></struct></binding>") ==
+			"member name taken by type of another member");
+	XTEST_CHECK(schema_error("<binding><struct name='S'><element name='a' type='T'/></struct></binding>") == "unknown type");
+	XTEST_CHECK(schema_error("<binding><struct name='S'><attribute name='a' type='S'/></struct></binding>") == "attribute and text must have a simple type");
+}
+
+} // namespace
+
+int main()
+{
+	test_generated();
+	test_binder();
+	test_convert();
+	test_schema();
+	return xprocesser::xtest::report("TestBinder");
+}
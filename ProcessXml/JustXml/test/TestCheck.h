@@ -0,0 +1,193 @@
+/*
+ * TestCheck.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef TEST_TESTCHECK_H_
+#define TEST_TESTCHECK_H_
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Core/XmlDocument.h"
+
+// Check condition, reporting it with its place if it does not hold
+#define XTEST_CHECK(condition) xprocesser::xtest::check((condition), #condition, __FILE__, __LINE__)
+
+// Check that string of given size equals zero-terminated expected string
+#define XTEST_STRING(string, size, expected) xprocesser::xtest::check(xprocesser::xtest::equal((string), (size), (expected)), #string " == " #expected, __FILE__, __LINE__)
+
+// Check that statement throws parse_error
+#define XTEST_THROWS(statement) \
+	do \
+	{ \
+		bool thrown = false; \
+		try \
+		{ \
+			statement; \
+		} \
+		catch (const xprocesser::xcore::parse_error&) \
+		{ \
+			thrown = true; \
+		} \
+		xprocesser::xtest::check(thrown, #statement " throws", __FILE__, __LINE__); \
+	} while (0)
+
+namespace xprocesser
+{
+namespace xtest
+{
+
+// Counters of checks made and failed by the test program
+inline int& checks()
+{
+	static int count = 0;
+	return count;
+}
+
+inline int& failures()
+{
+	static int count = 0;
+	return count;
+}
+
+// Count check, and report it if it failed
+inline bool check(bool passed, const char* what, const char* file, int line)
+{
+	++checks();
+	if (!passed)
+	{
+		++failures();
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+	}
+	return passed;
+}
+
+// Report result of test program, and return its exit status
+inline int report(const char* name)
+{
+	if (failures())
+		std::fprintf(stderr, "%s: %d of %d checks failed\n", name, failures(), checks());
+	else
+		std::printf("%s: %d checks passed\n", name, checks());
+	return failures() ? 1 : 0;
+}
+
+// Compare string of given size with zero-terminated string
+template<class ItemType>
+bool equal(const ItemType* string, std::size_t size, const char* expected)
+{
+	if (size != std::strlen(expected))
+		return false;
+	for (std::size_t i = 0; i < size; ++i)
+		if (string[i] != ItemType(static_cast<unsigned char>(expected[i])))
+			return false;
+	return true;
+}
+
+// Append string of given size to dump
+template<class ItemType>
+void append(std::string& out, const ItemType* string, std::size_t size)
+{
+	for (std::size_t i = 0; i < size; ++i)
+		out += static_cast<char>(string[i]);
+}
+
+// Dump node and its subtree into a string, so that trees built in different ways can be compared:
+// type, name and value of each node, its attributes in brackets and its children in parentheses
+template<class ItemType>
+std::string dump(const xcore::xml_node<ItemType>* node)
+{
+	std::string out;
+	out += static_cast<char>('0' + node->type());
+	append(out, node->name(), node->name_size());
+	out += '=';
+	append(out, node->value(), node->value_size());
+	out += '[';
+	for (const xcore::xml_attribute<ItemType>* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+	{
+		append(out, attribute->name(), attribute->name_size());
+		out += '=';
+		append(out, attribute->value(), attribute->value_size());
+		out += ';';
+	}
+	out += "](";
+	for (const xcore::xml_node<ItemType>* child = node->first_node(); child; child = child->next_sibling())
+		out += dump(child);
+	out += ')';
+	return out;
+}
+
+// Parse copy of text in place with given flags, and return dump of the document, or error and its offset.
+// Contents deferred by xflags::parse_lazy are parsed by a first dump, which sets values of their elements.
+template<int Flags>
+std::string parsed(const std::string& text)
+{
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back('\0');
+	xcore::xml_document<char> document;
+	try
+	{
+		document.template parse<Flags>(&copy[0]);
+	}
+	catch (const xcore::parse_error& error)
+	{
+		char where[32];
+		std::snprintf(where, sizeof(where), " at %ld", static_cast<long>(error.where<char>() - &copy[0]));
+		return std::string("error: ") + error.what() + where;
+	}
+	if (Flags & xcore::xinternal::xflags::parse_lazy)
+		dump(&document);
+	return dump(&document);
+}
+
+// Page of text between two inaccessible pages, so that reads crossing its bounds fault
+class guarded_page
+{
+public:
+
+	guarded_page()
+	: m_size(sysconf(_SC_PAGESIZE))
+	{
+		void* memory = mmap(0, 3 * m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		m_memory = static_cast<char*>(memory);
+		mprotect(m_memory, m_size, PROT_NONE);
+		mprotect(m_memory + 2 * m_size, m_size, PROT_NONE);
+	}
+
+	~guarded_page()
+	{
+		munmap(m_memory, 3 * m_size);
+	}
+
+	char* begin() const
+	{
+		return m_memory + m_size;
+	}
+
+	char* end() const
+	{
+		return m_memory + 2 * m_size;
+	}
+
+private:
+
+	// No copying
+	guarded_page(const guarded_page&);
+	void operator=(const guarded_page&);
+
+	std::size_t m_size;
+	char* m_memory;
+};
+
+} /* namespace xtest */
+} /* namespace xprocesser */
+
+#endif /* TEST_TESTCHECK_H_ */
@@ -0,0 +1,127 @@
+/*
+ * TestChildIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/Internal/CoreAlgorithms.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+bool named(const xml_node<char>* node, const char* name)
+{
+	return xprocesser::xcore::xinternal::compare(node->name(), node->name_size(), name, std::strlen(name), true);
+}
+
+// Lookups which walk the children, to check indexed lookups against
+xml_node<char>* walk_first(xml_node<char>* node, const char* name)
+{
+	for (xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+		if (named(child, name))
+			return child;
+	return 0;
+}
+
+xml_node<char>* walk_last(xml_node<char>* node, const char* name)
+{
+	xml_node<char>* found = 0;
+	for (xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+		if (named(child, name))
+			found = child;
+	return found;
+}
+
+// Number of lookups by every function, for names n0 to n9 and a missing name, which disagree with walking the children
+int mismatches(xml_node<char>* root)
+{
+	int errors = 0;
+	char name[8];
+	for (int i = 0; i <= 10; ++i)
+	{
+		std::snprintf(name, sizeof(name), "n%d", i);
+		xml_node<char>* first = root->first_node(name);
+		errors += first != walk_first(root, name);
+		errors += root->last_node(name) != walk_last(root, name);
+		if (!first)
+			continue;
+
+		// Chain of siblings with the name, both ways
+		xml_node<char>* last = first;
+		for (xml_node<char>* next; (next = last->next_sibling(name)) != 0; last = next)
+		{
+			xml_node<char>* expected = last->next_sibling();
+			while (expected && !named(expected, name))
+				expected = expected->next_sibling();
+			errors += next != expected || next->previous_sibling(name) != last;
+		}
+		errors += last != walk_last(root, name);
+	}
+	return errors;
+}
+
+void test_lookups()
+{
+	// Wide node, looked up often enough to build an index where indexes are enabled
+	std::string text = "<root>";
+	char buffer[64];
+	for (int i = 0; i < 200; ++i)
+	{
+		std::snprintf(buffer, sizeof(buffer), "<n%d i='%d'/>", i * 7 % 10, i);
+		text += buffer;
+	}
+	text += "</root>";
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xml_document<char> document;
+	document.parse<parse_default>(&copy[0]);
+	xml_node<char>* root = document.first_node();
+	for (int round = 0; round < 3; ++round)
+		XTEST_CHECK(mismatches(root) == 0);
+
+	// Children appended, inserted and removed
+	for (int i = 0; i < 50; ++i)
+		root->append_node(document.allocate_node(node_element, "n3"));
+	root->insert_node(root->first_node("n5"), document.allocate_node(node_element, "n5"));
+	root->prepend_node(document.allocate_node(node_element, "n9"));
+	root->remove_node(root->last_node("n1"));
+	root->remove_first_node();
+	root->remove_last_node();
+	XTEST_CHECK(mismatches(root) == 0);
+
+	// Child renamed by its own setter, and through its base class
+	root->first_node("n2")->name("n4");
+	XTEST_CHECK(mismatches(root) == 0);
+	Xml_Base<char>* base = root->last_node("n6");
+	base->name("n0", 2);
+	XTEST_CHECK(mismatches(root) == 0);
+	static_cast<Xml_Base<char>*>(root->first_node("n8"))->name("n10");
+	XTEST_CHECK(mismatches(root) == 0 && root->first_node("n10"));
+
+	// Attribute renamed through its base class leaves lookups of children right
+	base = root->first_node()->first_attribute();
+	base->name("renamed");
+	XTEST_CHECK(mismatches(root) == 0);
+
+	// All children removed
+	root->remove_all_nodes();
+	XTEST_CHECK(!root->first_node("n1"));
+	root->append_node(document.allocate_node(node_element, "n1"));
+	XTEST_CHECK(mismatches(root) == 0);
+}
+
+} // namespace
+
+int main()
+{
+	test_lookups();
+	return xprocesser::xtest::report("TestChildIndex");
+}
@@ -0,0 +1,100 @@
+/*
+ * TestConstInput.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+using xprocesser::xtest::guarded_page;
+
+namespace
+{
+
+// Parse size characters of text, placed read-only at the end of a page, and return dump of the document or error
+template<int Flags>
+std::string parsed_const(const char* text, std::size_t size)
+{
+	guarded_page page;
+	char* copy = page.end() - size;
+	std::memcpy(copy, text, size);
+	mprotect(page.begin(), page.end() - page.begin(), PROT_READ);
+	xml_document<char> document;
+	try
+	{
+		document.parse<Flags>(static_cast<const char*>(copy), size);
+	}
+	catch (const parse_error& error)
+	{
+		return std::string("error: ") + error.what();
+	}
+	return dump(&document);
+}
+
+template<int Flags>
+std::string parsed_const(const char* text)
+{
+	return parsed_const<Flags>(text, std::strlen(text));
+}
+
+void test_tree()
+{
+	// Tree is the one built from terminated text, reading nothing past the end
+	const char* texts[] =
+	{
+		"<a/>",
+		"<a x='1' y=\"2\">text<b>more &amp; &#65;</b><!-- c --><![CDATA[d]]></a>",
+		"<?xml version='1.0'?><!DOCTYPE a><a>  spaced   out  </a>  \n",
+		"\xEF\xBB\xBF<a><b/><c>x</c></a>",
+	};
+	for (std::size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		XTEST_CHECK(parsed_const<parse_default>(texts[i]) == parsed<parse_default>(texts[i]));
+		XTEST_CHECK(parsed_const<parse_full>(texts[i]) == parsed<parse_full>(texts[i]));
+		XTEST_CHECK(parsed_const<parse_trim_whitespace | parse_normalize_whitespace>(texts[i])
+				== parsed<parse_trim_whitespace | parse_normalize_whitespace>(texts[i]));
+	}
+}
+
+void test_errors()
+{
+	// Text ending inside markup or values fails without reading past the end, as terminated text does;
+	// messages may differ, since the end of the text is found where its terminator would be read
+	const char* texts[] = { "<", "<a", "<a x='1", "<a>text", "<a><b/>", "<a>&amp", "<a><!-- c", "<a/> x", "<a/><" };
+	for (std::size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		XTEST_CHECK(parsed_const<parse_default>(texts[i]).compare(0, 7, "error: ") == 0);
+		XTEST_CHECK(parsed<parse_default>(texts[i]).compare(0, 7, "error: ") == 0);
+	}
+}
+
+void test_embedded_zero()
+{
+	// Zero character ends the text, whatever follows it
+	const char markup[] = "<a>x</a>\0<b/>";
+	const char junk[] = "<a>x</a>\0 junk";
+	std::string expected = parsed_const<parse_default>("<a>x</a>");
+	XTEST_CHECK(parsed_const<parse_default>(markup, sizeof(markup) - 1) == expected);
+	XTEST_CHECK(parsed_const<parse_default>(junk, sizeof(junk) - 1) == expected);
+	XTEST_CHECK(parsed_const<parse_default>("<a>x</a>\0", 9) == expected);
+
+	// Zero inside markup ends it early
+	const char inside[] = "<a>x\0</a>";
+	XTEST_CHECK(parsed_const<parse_default>(inside, sizeof(inside) - 1) == parsed_const<parse_default>("<a>x"));
+	XTEST_CHECK(parsed_const<parse_default>("\0<a/>", 5) == parsed_const<parse_default>(""));
+}
+
+} // namespace
+
+int main()
+{
+	test_tree();
+	test_errors();
+	test_embedded_zero();
+	return xprocesser::xtest::report("TestConstInput");
+}
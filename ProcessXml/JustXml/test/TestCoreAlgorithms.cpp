@@ -0,0 +1,209 @@
+/*
+ * TestCoreAlgorithms.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/Internal/CoreAlgorithms.h"
+
+using namespace xprocesser::xcore::xinternal;
+using xprocesser::xtest::guarded_page;
+
+namespace
+{
+
+// Case fold of compare(): low byte of character, with ASCII letters upcased
+template<class ItemType>
+unsigned fold(ItemType c)
+{
+	unsigned byte = static_cast<unsigned char>(c);
+	return byte >= 'a' && byte <= 'z' ? byte - 32 : byte;
+}
+
+template<class ItemType>
+bool reference_compare(const ItemType* a, const ItemType* b, std::size_t size, bool case_sensitive)
+{
+	for (std::size_t i = 0; i < size; ++i)
+		if (case_sensitive ? a[i] != b[i] : fold(a[i]) != fold(b[i]))
+			return false;
+	return true;
+}
+
+// Strings of every length ending at the end of a page, and starting at its beginning, at every alignment
+template<class ItemType>
+void test_measure()
+{
+	guarded_page page;
+	ItemType* begin = reinterpret_cast<ItemType*>(page.begin());
+	ItemType* end = reinterpret_cast<ItemType*>(page.end());
+	for (ItemType* p = begin; p < end; ++p)
+		*p = ItemType('x');
+	end[-1] = 0;
+	int errors = 0;
+	for (std::size_t length = 0; length < 200; ++length)
+		errors += measure(end - 1 - length) != length;
+	for (std::size_t length = 0; length < 200; ++length)
+	{
+		begin[length] = 0;
+		errors += measure(begin) != length;
+		for (std::size_t start = 0; start <= length; ++start)
+			errors += measure(begin + start) != length - start;
+		begin[length] = ItemType('x');
+	}
+	XTEST_CHECK(errors == 0);
+
+	// Characters with zero bytes do not end wide strings
+	if (sizeof(ItemType) == 4)
+	{
+		ItemType text[] = { ItemType(0x100), ItemType(0x1), ItemType(0x10000), ItemType('a'), 0 };
+		XTEST_CHECK(measure(text) == 4);
+	}
+}
+
+// Bounded measure stops at the bound, which may be the end of a page, or at a zero before it
+template<class ItemType>
+void test_measure_bounded()
+{
+	guarded_page page;
+	ItemType* end = reinterpret_cast<ItemType*>(page.end());
+	for (ItemType* p = reinterpret_cast<ItemType*>(page.begin()); p < end; ++p)
+		*p = ItemType('x');
+	int errors = 0;
+	for (std::size_t size = 0; size < 100; ++size)
+	{
+		ItemType* text = end - size;
+		errors += measure(text, size) != size;
+		for (std::size_t zero = 0; zero < size; ++zero)
+		{
+			text[zero] = 0;
+			errors += measure(text, size) != zero;
+			text[zero] = ItemType('x');
+		}
+	}
+	XTEST_CHECK(errors == 0);
+}
+
+// Equal strings, and strings differing at every position, placed where a read past them would fault
+template<class ItemType>
+void test_compare(bool case_sensitive)
+{
+	guarded_page first_page, second_page;
+	ItemType* first_end = reinterpret_cast<ItemType*>(first_page.end());
+	ItemType* second_end = reinterpret_cast<ItemType*>(second_page.end());
+	static const char letters[] = "aBcD@[`{zZ09_-:xY";
+	int errors = 0;
+	for (std::size_t length = 0; length < 70; ++length)
+	{
+		for (std::size_t shift = 0; shift < 3; ++shift)
+		{
+			ItemType* a = first_end - length - shift;
+			ItemType* b = second_end - length;
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				a[i] = ItemType(letters[(i * 7 + length) % 17]);
+				b[i] = case_sensitive || i % 2 ? a[i] : ItemType(fold(a[i]));
+			}
+			errors += compare(a, length, b, length, case_sensitive) != reference_compare(a, b, length, case_sensitive);
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				ItemType saved = b[i];
+				static const char others[] = "A@`[{ ";
+				for (const char* other = others; *other; ++other)
+				{
+					b[i] = ItemType(*other);
+					errors += compare(a, length, b, length, case_sensitive) != reference_compare(a, b, length, case_sensitive);
+				}
+				b[i] = saved;
+			}
+		}
+	}
+	XTEST_CHECK(errors == 0);
+	ItemType x[] = { ItemType('x'), 0 };
+	XTEST_CHECK(!compare(x, 1, x, 0, case_sensitive));
+}
+
+// Counts of < and = at every size and alignment, and over runs long enough to overflow byte counters
+template<class ItemType>
+void test_count_markup()
+{
+	guarded_page page;
+	ItemType* begin = reinterpret_cast<ItemType*>(page.begin());
+	std::size_t capacity = (page.end() - page.begin()) / sizeof(ItemType);
+	unsigned seed = 7;
+	static const char palette[] = "<=a <=\n>/";
+	for (std::size_t i = 0; i < capacity; ++i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		begin[i] = ItemType(palette[(seed >> 16) % 9]);
+		if (sizeof(ItemType) > 1 && (seed >> 8) % 13 == 0)
+			begin[i] = ItemType(begin[i] + 0x100);     // Not markup, though its low byte is
+	}
+	int errors = 0;
+	for (std::size_t start = 0; start < 40; ++start)
+	{
+		for (std::size_t size = 0; start + size <= capacity; size += size < 70 ? 1 : 97)
+		{
+			std::size_t tags = 0, equals = 0, expected_tags = 0, expected_equals = 0;
+			for (std::size_t i = start; i < start + size; ++i)
+			{
+				expected_tags += begin[i] == ItemType('<');
+				expected_equals += begin[i] == ItemType('=');
+			}
+			count_markup(begin + start, size, tags, equals);
+			errors += tags != expected_tags || equals != expected_equals;
+		}
+	}
+	XTEST_CHECK(errors == 0);
+
+	std::vector<ItemType> run(100000, ItemType('<'));
+	for (std::size_t i = 0; i < run.size(); i += 3)
+		run[i] = ItemType('=');
+	std::size_t tags = 0, equals = 0;
+	count_markup(&run[0], run.size(), tags, equals);
+	XTEST_CHECK(tags == 66666 && equals == 33334);
+}
+
+// Capacities double from the initial one, and items kept survive each growth
+void test_grow_array()
+{
+	int* array = 0;
+	std::size_t capacity = 0, used = 0, growths = 0;
+	int errors = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		std::size_t before = capacity;
+		grow_array(array, used, capacity, used + 1, 16);
+		growths += capacity != before;
+		array[used++] = i;
+		for (std::size_t j = 0; j < used; j += 97)
+			errors += array[j] != int(j);
+	}
+	XTEST_CHECK(errors == 0 && capacity == 1024 && growths == 7);
+	grow_array(array, used, capacity, 5000, 16);
+	XTEST_CHECK(capacity == 8192 && array[999] == 999);
+	grow_array(array, used, capacity, 10, 16);
+	XTEST_CHECK(capacity == 8192);
+	delete[] array;
+}
+
+} // namespace
+
+int main()
+{
+	test_measure<char>();
+	test_measure<wchar_t>();
+	test_measure_bounded<char>();
+	test_measure_bounded<wchar_t>();
+	test_compare<char>(true);
+	test_compare<char>(false);
+	test_compare<wchar_t>(true);
+	test_compare<wchar_t>(false);
+	test_count_markup<char>();
+	test_count_markup<wchar_t>();
+	test_grow_array();
+	return xprocesser::xtest::report("TestCoreAlgorithms");
+}
@@ -0,0 +1,146 @@
+/*
+ * TestExtractor.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlExtractor.h"
+#include "Core/XmlQuery.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+const char order[] =
+		"<?xml version='1.0'?>"
+		"<order id='17'>"
+		"<customer><name>Ann &amp; Bo</name><address><city>Oslo</city></address></customer>"
+		"<item sku='a1'><quantity>2</quantity></item>"
+		"<item sku='b2'><quantity>5</quantity><note><![CDATA[<fragile>]]></note></item>"
+		"<empty/><total>  12.50  </total>"
+		"</order>";
+
+const char* paths[] =
+{
+	"/order/@id", "/order/customer/name", "/order/customer/address/city", "/order/item/@sku", "/order/item/quantity",
+	"/order/item/note", "/order/empty", "/order/total", "/order/missing", "/order/item/@missing", "/other"
+};
+const std::size_t path_count = sizeof(paths) / sizeof(paths[0]);
+
+// Value of result, or "(none)" if path was not found
+std::string value(const xml_extractor<char>::result& result)
+{
+	return result.value ? std::string(result.value, result.size) : std::string("(none)");
+}
+
+// Value of the first node or attribute path selects in DOM parsed from copy of text with the same flags
+template<int Flags>
+std::string queried(const char* text, const char* path)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	xml_document<char> document;
+	document.parse<Flags>(&copy[0]);
+	Xml_Base<char>* found = xml_query<char>(path).first(&document);
+	return found ? std::string(found->value(), found->value_size()) : std::string("(none)");
+}
+
+// Number of paths whose values differ from those of the DOM, extracted with given flags
+template<int Flags>
+int mismatches(const char* text)
+{
+	xml_extractor<char> extractor;
+	std::vector<std::size_t> indexes;
+	for (std::size_t i = 0; i < path_count; ++i)
+		indexes.push_back(extractor.add(paths[i]));
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	std::vector<xml_extractor<char>::result> results(extractor.size());
+	std::size_t found = extractor.extract<Flags>(&copy[0], &results[0]);
+
+	int errors = 0;
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < path_count; ++i)
+	{
+		std::string want = queried<Flags>(text, paths[i]);
+		expected += want != "(none)";
+		if (value(results[indexes[i]]) != want)
+		{
+			std::printf("  %s: extracted %s, DOM has %s\n", paths[i], value(results[indexes[i]]).c_str(), want.c_str());
+			++errors;
+		}
+	}
+	return errors + (found != expected);
+}
+
+void test_values()
+{
+	// Values are those of the DOM built with the same flags
+	XTEST_CHECK(mismatches<parse_default>(order) == 0);
+	XTEST_CHECK(mismatches<parse_non_destructive>(order) == 0);
+	XTEST_CHECK(mismatches<parse_trim_whitespace | parse_normalize_whitespace>(order) == 0);
+	XTEST_CHECK(mismatches<parse_validate_closing_tags>(order) == 0);
+
+	// Translated in place, or left as they are in the text
+	xml_extractor<char> extractor;
+	std::size_t name = extractor.add("order/customer/name");
+	std::vector<xml_extractor<char>::result> results(extractor.size());
+	std::vector<char> copy(order, order + sizeof(order));
+	XTEST_CHECK(extractor.extract<parse_default>(&copy[0], &results[0]) == 1 && value(results[name]) == "Ann & Bo");
+	std::vector<char> again(order, order + sizeof(order));
+	XTEST_CHECK(extractor.extract<parse_non_destructive>(&again[0], &results[0]) == 1 && value(results[name]) == "Ann &amp; Bo");
+	XTEST_CHECK(std::string(&again[0]) == order);
+}
+
+void test_paths()
+{
+	// Path added again gets its index, with or without the leading slash
+	xml_extractor<char> extractor;
+	std::size_t id = extractor.add("/order/@id");
+	XTEST_CHECK(extractor.add("order/@id") == id && extractor.add("/order/@idx", 10) == id && extractor.size() == 1);
+	XTEST_CHECK(extractor.add("/order/total") != id && extractor.size() == 2);
+
+	// Errors leave the paths as they were
+	XTEST_THROWS(extractor.add("/order/@id/name"));
+	XTEST_THROWS(extractor.add("/order//name"));
+	XTEST_CHECK(extractor.size() == 2);
+
+	extractor.clear();
+	XTEST_CHECK(extractor.size() == 0 && extractor.add("/order/total") == 0);
+}
+
+void test_early_end()
+{
+	// Text after the last value found is not read
+	xml_extractor<char> extractor;
+	extractor.add("/a/b");
+	xml_extractor<char>::result result;
+	char text[] = "<a><b>1</b><c></wrong></a>";
+	XTEST_CHECK(extractor.extract<parse_default>(text, &result) == 1 && value(result) == "1");
+
+	// Errors before all values are found are reported
+	extractor.add("/a/d");
+	std::vector<xml_extractor<char>::result> results(extractor.size());
+	char broken[] = "<a><b>1</b><c></wrong></a>";
+	XTEST_THROWS(extractor.extract<parse_validate_closing_tags>(broken, &results[0]));
+	char unclosed[] = "<a><b>1</b><c>";
+	XTEST_THROWS(extractor.extract<parse_default>(unclosed, &results[0]));
+
+	// Paths not found at the end of the document
+	char other[] = "<a><c/></a>";
+	XTEST_CHECK(extractor.extract<parse_default>(other, &results[0]) == 0 && !results[0].value && !results[1].value);
+}
+
+} // namespace
+
+int main()
+{
+	test_values();
+	test_paths();
+	test_early_end();
+	return xprocesser::xtest::report("TestExtractor");
+}
@@ -0,0 +1,166 @@
+/*
+ * TestFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdlib>
+#include <stdexcept>
+
+#include "TestCheck.h"
+#include "Core/XmlFile.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+// Temporary file holding given contents, removed when it goes out of scope
+class temporary_file
+{
+public:
+
+	explicit temporary_file(const std::string& contents)
+	{
+		char path[] = "/tmp/TestFileXXXXXX";
+		int fd = mkstemp(path);
+		m_path = path;
+		if (fd >= 0)
+		{
+			if (write(fd, contents.data(), contents.size()) != static_cast<ssize_t>(contents.size()))
+				m_path.clear();
+			close(fd);
+		}
+	}
+
+	~temporary_file()
+	{
+		if (!m_path.empty())
+			unlink(m_path.c_str());
+	}
+
+	const char* path() const
+	{
+		return m_path.c_str();
+	}
+
+	// Contents of the file as they are now
+	std::string contents() const
+	{
+		std::string out;
+		if (std::FILE* file = std::fopen(m_path.c_str(), "rb"))
+		{
+			char buffer[4096];
+			std::size_t size;
+			while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+				out.append(buffer, size);
+			std::fclose(file);
+		}
+		return out;
+	}
+
+private:
+
+	// No copying
+	temporary_file(const temporary_file&);
+	void operator=(const temporary_file&);
+
+	std::string m_path;
+};
+
+// Document padded with a comment to given size
+std::string document_of_size(std::size_t size)
+{
+	std::string text = "<root a='1'><b>x &amp; y</b><c/></root><!--";
+	text += std::string(size - text.size() - 3, '-');
+	text += "-->";
+	return text;
+}
+
+void test_modes()
+{
+	std::string text = "<root a='1'><b>x &amp; y</b><c>  text  </c></root>\n";
+	temporary_file source(text);
+
+	// Read-only text is the file as it is, and parsing leaves it so
+	{
+		xml_file<char> file(source.path(), file_read_only);
+		XTEST_CHECK(file.size() == text.size());
+		XTEST_CHECK(std::string(file.data(), file.size()) == text);
+		xml_document<char> document;
+		file.parse<parse_default>(document);
+		XTEST_CHECK(dump(&document) == parsed<parse_default>(text));
+		XTEST_CHECK(std::string(file.data(), file.size()) == text);
+	}
+
+	// Copy-on-write text is terminated and writable, and changes never reach the file
+	{
+		xml_file<char> file(source.path(), file_copy_on_write);
+		XTEST_CHECK(file.size() == text.size() && file.data()[file.size()] == 0);
+		xml_document<char> document;
+		file.parse<parse_default>(document);
+		XTEST_CHECK(dump(&document) == parsed<parse_default>(text));
+		XTEST_CHECK(std::string(file.data(), file.size()) != text);       // Terminators and translated references
+	}
+	XTEST_CHECK(source.contents() == text);
+}
+
+void test_sizes()
+{
+	// Terminator of copy-on-write text lies after the last page of the file, whether or not the file fills it
+	std::size_t page = sysconf(_SC_PAGESIZE);
+	std::size_t sizes[] = { 100, page - 1, page, page + 1, 3 * page };
+	for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+	{
+		std::string text = document_of_size(sizes[i]);
+		temporary_file source(text);
+		xml_file<char> cow(source.path(), file_copy_on_write);
+		XTEST_CHECK(cow.size() == sizes[i] && cow.data()[sizes[i]] == 0);
+		xml_document<char> document;
+		cow.parse<parse_default>(document);
+		XTEST_CHECK(dump(&document) == parsed<parse_default>(text));
+
+		xml_file<char> read_only(source.path(), file_read_only);
+		read_only.parse<parse_default>(document);
+		XTEST_CHECK(dump(&document) == parsed<parse_default>(text));
+	}
+}
+
+void test_special()
+{
+	// Empty file cannot be mapped, so it is read into a buffer
+	temporary_file empty("");
+	xml_file<char> read_only(empty.path(), file_read_only);
+	xml_file<char> cow(empty.path(), file_copy_on_write);
+	XTEST_CHECK(read_only.size() == 0 && cow.size() == 0 && cow.data()[0] == 0);
+
+	// Special file is read as a stream
+	xml_file<char> null("/dev/null", file_copy_on_write);
+	XTEST_CHECK(null.size() == 0 && null.data()[0] == 0);
+
+	// Missing file
+	bool thrown = false;
+	try
+	{
+		xml_file<char> missing("/nonexistent/TestFile.xml");
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	XTEST_CHECK(thrown);
+}
+
+} // namespace
+
+int main()
+{
+	test_modes();
+	test_sizes();
+	test_special();
+	return xprocesser::xtest::report("TestFile");
+}
@@ -0,0 +1,101 @@
+/*
+ * TestInternNames.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+const char catalog[] = "<catalog><book id='1' lang='en'><title>A</title></book><note/><book id='2'><title>B</title></book></catalog>";
+
+void test_tree()
+{
+	// Tree is the one built without the flag, whether or not names are interned
+	XTEST_CHECK(parsed<parse_intern_names>(catalog) == parsed<parse_default>(catalog));
+	XTEST_CHECK(parsed<parse_intern_names | parse_non_destructive>(catalog) == parsed<parse_non_destructive>(catalog));
+}
+
+#if defined(XPROC_INTERN_NAMES)
+
+void test_lookups()
+{
+	xml_document<char> document;
+	name_id book = document.intern_name("book");        // Before parsing
+	std::vector<char> copy(catalog, catalog + sizeof(catalog));
+	document.parse<parse_intern_names>(&copy[0]);
+	name_id id = document.intern_name("id", 2);         // After parsing
+	XTEST_CHECK(book != name_id() && id != name_id() && book != id);
+	XTEST_CHECK(document.intern_name("book") == book);
+
+	xml_node<char>* root = document.first_node();
+	XTEST_CHECK(root->name_id() == document.intern_name("catalog"));
+	xml_node<char>* first = root->first_node(book);
+	xml_node<char>* last = root->last_node(book);
+	XTEST_CHECK(first && last && first != last);
+	XTEST_CHECK(first->next_sibling(book) == last && last->previous_sibling(book) == first);
+	XTEST_CHECK(first->first_attribute(id) == first->first_attribute("id"));
+	XTEST_CHECK(first->first_attribute(id)->next_attribute(document.intern_name("lang")) == first->last_attribute());
+	XTEST_CHECK(last->last_attribute(id)->previous_attribute(id) == 0);
+	XTEST_CHECK(!root->first_node(document.intern_name("missing")));
+
+	// Renamed node loses its identifier
+	first->name("volume");
+	XTEST_CHECK(first->name_id() == name_id() && root->first_node(book) == last);
+
+	// Nodes parsed without the flag carry no identifiers
+	std::vector<char> again(catalog, catalog + sizeof(catalog));
+	document.parse<parse_default>(&again[0]);
+	XTEST_CHECK(!document.first_node()->first_node(book) && document.first_node()->name_id() == name_id());
+}
+
+// Identifiers given by workers of parallel parse are those of the document
+void test_parallel()
+{
+	std::string text = "<root>";
+	char buffer[64];
+	for (int i = 0; i < 300; ++i)
+	{
+		std::snprintf(buffer, sizeof(buffer), "<rec n='%d'><f%d/></rec>", i, i % 7);
+		text += buffer;
+	}
+	text += "</root>";
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xml_document<char> document;
+	document.parse_parallel<parse_intern_names>(&copy[0], 4);
+	int errors = 0, records = 0;
+	name_id rec = document.intern_name("rec"), n = document.intern_name("n");
+	for (xml_node<char>* node = document.first_node()->first_node(rec); node; node = node->next_sibling(rec), ++records)
+	{
+		errors += !node->first_attribute(n);
+		std::snprintf(buffer, sizeof(buffer), "f%d", records % 7);
+		errors += node->first_node()->name_id() != document.intern_name(buffer);
+	}
+	XTEST_CHECK(records == 300 && errors == 0);
+}
+
+#endif
+
+} // namespace
+
+int main()
+{
+	test_tree();
+#if defined(XPROC_INTERN_NAMES)
+	test_lookups();
+	test_parallel();
+#endif
+	return xprocesser::xtest::report("TestInternNames");
+}
@@ -0,0 +1,108 @@
+/*
+ * TestLazy.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+const char catalog[] =
+	"<catalog>"
+	"<book id='1'><title>First</title><author><name>A</name></author></book>"
+	"<book id='2'><title>Second &amp; last</title><price>2.50</price></book>"
+	"<note>only text</note>"
+	"</catalog>";
+
+void test_tree()
+{
+	// Tree is the one built without the flag, whether or not contents are deferred
+	XTEST_CHECK(parsed<parse_lazy>(catalog) == parsed<parse_default>(catalog));
+	XTEST_CHECK(parsed<parse_lazy | parse_non_destructive>(catalog) == parsed<parse_non_destructive>(catalog));
+	XTEST_CHECK(parsed<parse_lazy | parse_full>(catalog) == parsed<parse_full>(catalog));
+}
+
+void test_access()
+{
+	std::vector<char> copy(catalog, catalog + sizeof(catalog));
+	xml_document<char> document;
+	document.parse<parse_lazy>(&copy[0]);
+
+	// Elements holding only text have values at once
+	xml_node<char>* root = document.first_node("catalog");
+	XTEST_CHECK(root && root->last_node("note"));
+	XTEST_STRING(root->last_node("note")->value(), root->last_node("note")->value_size(), "only text");
+
+	// Children are reached through every function, in any order
+	xml_node<char>* second = root->last_node("book");
+	XTEST_CHECK(second && second->first_attribute("id"));
+	XTEST_STRING(second->last_node()->value(), second->last_node()->value_size(), "2.50");
+	xml_node<char>* first = root->first_node("book");
+	XTEST_CHECK(first->first_node("author")->first_node("name"));
+
+	// Children of removed node are parsed before it leaves the document
+	root->remove_node(first);
+	XTEST_CHECK(first->first_node("title") && first->first_node("author"));
+	XTEST_CHECK(root->first_node("book") == second);
+
+	// Appending to a node with deferred contents keeps them in front
+	xml_node<char>* extra = document.allocate_node(node_element, "extra");
+	second->append_node(extra);
+	XTEST_CHECK(second->first_node("title") && second->last_node() == extra);
+}
+
+// Check that parsing copy of text with given flags, or parsing all of its deferred contents, fails
+template<int Flags>
+bool fails(const char* text)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	xml_document<char> document;
+	try
+	{
+		document.parse<Flags>(&copy[0]);
+		dump(&document);
+	}
+	catch (const parse_error&)
+	{
+		return true;
+	}
+	return false;
+}
+
+void test_errors()
+{
+	XTEST_CHECK(fails<parse_lazy>("<root><a><b x=1/></a></root>"));
+	XTEST_CHECK(fails<parse_lazy>("<root><a><b></a></root>"));
+	XTEST_CHECK(fails<parse_lazy>("<root><a><b>&#xZZ;</b></a></root>"));
+	XTEST_CHECK(fails<parse_lazy | parse_full>("<root><a><b></c></a></root>"));
+	XTEST_CHECK(!fails<parse_lazy>("<root><a><b></c></a></root>"));
+
+#if defined(XPROC_LAZY_CONTENTS)
+	// Skipping checks markup only, so errors in character references surface when deferred contents are parsed
+	char text[] = "<root><a><b>&#xZZ;</b></a></root>";
+	xml_document<char> document;
+	document.parse<parse_lazy>(text);
+	XTEST_CHECK(document.first_node()->first_node("a"));
+	XTEST_THROWS(document.first_node()->first_node("a")->first_node());
+#endif
+}
+
+} // namespace
+
+int main()
+{
+	test_tree();
+	test_access();
+	test_errors();
+	return xprocesser::xtest::report("TestLazy");
+}
@@ -0,0 +1,183 @@
+/*
+ * TestMapping.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlMapping.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+const char order[] =
+		"<?xml version='1.0'?>"
+		"<order id='17'>"
+		"<item sku='a1'><quantity>2</quantity><price currency='EUR'>1.5</price><note>first</note><note>second</note></item>"
+		"<box><item sku='x9'><quantity>99</quantity></item></box>"
+		"<item sku='b2'>loose<quantity> 5 </quantity><price>3</price></item>"
+		"<item/>"
+		"</order>";
+
+struct Item
+{
+	Item() : quantity(0), price(0) {}
+	std::string sku;
+	int quantity;
+	double price;
+	std::string currency;
+	std::string note;
+	std::string text;
+};
+
+struct Order
+{
+	Order() : id(0) {}
+	unsigned id;
+	std::string sku;
+};
+
+// Map copy of text into objects
+template<int Flags, class Objects>
+std::size_t mapped(xml_mapping<char>& mapping, const char* text, Objects& objects)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	return mapping.map<Flags>(&copy[0], objects);
+}
+
+void test_records()
+{
+	xml_mapping<char> mapping;
+	mapping.record("/order/item");
+	mapping.add("@sku", &Item::sku);
+	mapping.add("quantity", &Item::quantity);
+	mapping.add("price", &Item::price);
+	mapping.add("price/@currency", &Item::currency);
+	mapping.add("note", &Item::note);
+	mapping.add(".", &Item::text);
+
+	// Records in document order, only at the record path; first occurrence of a path is mapped
+	std::vector<Item> items;
+	XTEST_CHECK(mapped<parse_default>(mapping, order, items) == 3 && items.size() == 3);
+	XTEST_CHECK(items[0].sku == "a1" && items[0].quantity == 2 && items[0].price == 1.5 && items[0].currency == "EUR");
+	XTEST_CHECK(items[0].note == "first" && items[0].text == "");
+	XTEST_CHECK(items[1].sku == "b2" && items[1].quantity == 5 && items[1].price == 3 && items[1].currency == "" && items[1].text == "loose");
+	XTEST_CHECK(items[2].sku == "" && items[2].quantity == 0 && items[2].note == "");
+
+	// Objects of vector are reused and reset
+	items.clear();
+	items.reserve(8);
+	items.resize(5);
+	items[2].note = "stale";
+	const Item* data = &items[0];
+	XTEST_CHECK(mapped<parse_non_destructive>(mapping, order, items) == 3 && items.size() == 3 && &items[0] == data);
+	XTEST_CHECK(items[2].note == "" && items[1].quantity == 5);
+
+	// Single object gets the first record, and is unchanged without one
+	Item item;
+	XTEST_CHECK(mapped<parse_default>(mapping, order, item) == 1 && item.sku == "a1");
+	XTEST_CHECK(mapped<parse_default>(mapping, "<order><box/></order>", item) == 0 && item.sku == "a1");
+	XTEST_CHECK(mapped<parse_default>(mapping, "<other><item sku='z'/></other>", item) == 0);
+
+	// Member added again is mapped to the member added last
+	mapping.add("note", &Item::sku);
+	XTEST_CHECK(mapped<parse_default>(mapping, order, item) == 1 && item.sku == "first" && item.note == "");
+
+	// Root element is the record after clear(), whatever its name
+	mapping.clear();
+	Order root;
+	mapping.add("@id", &Order::id);
+	mapping.add("item/@sku", &Order::sku);
+	XTEST_CHECK(mapped<parse_default>(mapping, order, root) == 1 && root.id == 17 && root.sku == "a1");
+	XTEST_CHECK(mapped<parse_default>(mapping, "<list id='4'/>", root) == 1 && root.id == 4 && root.sku == "");
+}
+
+// Object whose members are all strings, mapped by offset
+struct Wide
+{
+	std::string values[64];
+};
+
+void store(const char* value, std::size_t size, void* member)
+{
+	static_cast<std::string*>(member)->assign(value, size);
+}
+
+void test_many_paths()
+{
+	// More states and longer names than the tree starts with
+	xml_mapping<char> mapping;
+	std::string text = "<r>";
+	std::vector<std::string> paths;
+	for (int i = 0; i < 64; ++i)
+	{
+		char name[64];
+		std::sprintf(name, "element_with_a_rather_long_name_%d", i / 4);
+		std::string element = name;
+		std::sprintf(name, "attribute_%d", i);
+		std::string path = i % 4 == 3 ? element : element + "/@" + name;
+		mapping.add(path.c_str(), 0, reinterpret_cast<const char*>(&static_cast<Wide*>(0)->values[i]) - static_cast<const char*>(0), &store);
+		paths.push_back(path);
+		if (i % 4 == 0)
+			text += "<" + element;
+		if (i % 4 != 3)
+		{
+			std::sprintf(name, " attribute_%d='%d'", i, i);
+			text += name;
+		}
+		else
+		{
+			std::sprintf(name, ">%d</", i);
+			text += name + element + ">";
+		}
+	}
+	text += "</r>";
+	Wide wide;
+	XTEST_CHECK(mapped<parse_default>(mapping, text.c_str(), wide) == 1);
+	int wrong = 0;
+	for (int i = 0; i < 64; ++i)
+	{
+		char expected[16];
+		std::sprintf(expected, "%d", i);
+		wrong += wide.values[i] != expected;
+	}
+	XTEST_CHECK(wrong == 0);
+}
+
+void test_errors()
+{
+	xml_mapping<char> mapping;
+	Item item;
+	XTEST_THROWS(mapping.add("a//b", &Item::sku));
+	XTEST_THROWS(mapping.add("@a/b", &Item::sku));
+	XTEST_THROWS(mapping.add("a@b", &Item::sku));
+	XTEST_THROWS(mapping.add("a/", &Item::sku));
+	XTEST_THROWS(mapping.record("/order/@id"));
+	XTEST_THROWS(mapping.record("/order//item"));
+
+	// Errors leave paths and record unchanged
+	mapping.add("@sku", &Item::sku);
+	XTEST_CHECK(mapped<parse_default>(mapping, "<item sku='s'/>", item) == 1 && item.sku == "s");
+
+	// Conversion and text errors
+	mapping.add("quantity", &Item::quantity);
+	XTEST_THROWS(mapped<parse_default>(mapping, "<item><quantity>many</quantity></item>", item));
+	XTEST_THROWS(mapped<parse_default>(mapping, "<item><quantity>1</quantity>", item));
+	XTEST_THROWS(mapped<parse_validate_closing_tags>(mapping, "<item><quantity>1</price></item>", item));
+}
+
+} // namespace
+
+int main()
+{
+	test_records();
+	test_many_paths();
+	test_errors();
+	return xprocesser::xtest::report("TestMapping");
+}
@@ -0,0 +1,305 @@
+/*
+ * TestMemoryPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlBinder.h"
+#include "Core/XmlExtractor.h"
+#include "Core/XmlMapping.h"
+#include "Core/XmlReader.h"
+#include "Core/XmlTape.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+const char order[] = "<order><item sku='a1'><quantity>2</quantity></item><item sku='b2'><quantity>5</quantity></item></order>";
+
+const std::size_t megabyte = std::size_t(1) << 20;
+
+// Field of /proc/self/status in bytes, as VmSize for the address space in use and VmPeak for its largest size so far
+std::size_t status(const char* field)
+{
+	std::size_t size = 0;
+	if (std::FILE* file = std::fopen("/proc/self/status", "r"))
+	{
+		char line[256];
+		std::size_t length = std::strlen(field);
+		while (std::fgets(line, sizeof(line), file))
+			if (std::strncmp(line, field, length) == 0 && line[length] == ':')
+				size = std::strtoul(line + length + 1, 0, 10) * 1024;
+		std::fclose(file);
+	}
+	return size;
+}
+
+struct item
+{
+	std::string sku;
+	int quantity;
+};
+
+void test_scanning()
+{
+	// Components which only scan reserve no cage, and neither does parsing text which makes no nodes
+	std::size_t before = status("VmSize");
+	{
+		std::vector<char> text(order, order + sizeof(order));
+		xml_extractor<char> extractor;
+		extractor.add("/order/item/quantity");
+		std::vector<xml_extractor<char>::result> results(extractor.size());
+		XTEST_CHECK(extractor.extract<parse_non_destructive>(&text[0], &results[0]) == 1);
+
+		xml_binder<char> binder;
+		binder.begin<parse_non_destructive>(&text[0]);
+		XTEST_CHECK(binder.enter<parse_non_destructive>() && binder.next_element<parse_non_destructive>());
+
+		xml_mapping<char> mapping;
+		mapping.record("/order/item");
+		mapping.add("@sku", &item::sku);
+		mapping.add("quantity", &item::quantity);
+		std::vector<item> items;
+		XTEST_CHECK(mapping.map<parse_non_destructive>(&text[0], items) == 2 && items[1].quantity == 5);
+
+		char blank[] = "  \n ";
+		xml_document<char> document;
+		document.parse<parse_default>(blank);
+		XTEST_CHECK(!document.first_node());
+
+		xml_reader<char> reader;
+		xml_tape<char> tape;
+		XTEST_CHECK(status("VmSize") < before + 64 * megabyte);
+	}
+}
+
+void test_parsing()
+{
+	// Each pool which allocates reserves one cage, without reserving twice its size on the way
+	std::size_t before = status("VmSize");
+	std::size_t peak = status("VmPeak");
+	std::vector<char> text(order, order + sizeof(order));
+	xml_document<char> document;
+	document.parse<parse_default>(&text[0]);
+	XTEST_CHECK(document.first_node()->first_node("item"));
+
+	std::size_t after = status("VmSize");
+#if defined(XPROC_COMPACT_NODES)
+	XTEST_CHECK(after >= before + xinternal::cage_size && after < before + xinternal::cage_size + 64 * megabyte);
+	XTEST_CHECK(status("VmPeak") < (peak > before ? peak : before) + xinternal::cage_size + 64 * megabyte);
+
+	// Cage is kept by clear() with retention, and given back without it
+	document.set_retention(megabyte);
+	document.clear();
+	XTEST_CHECK(status("VmSize") >= before + xinternal::cage_size);
+	document.set_retention(0);
+	document.clear();
+	XTEST_CHECK(status("VmSize") < before + 64 * megabyte);
+#else
+	(void)peak;
+	XTEST_CHECK(after < before + 64 * megabyte);
+#endif
+}
+
+#if !defined(XPROC_COMPACT_NODES)
+
+// Sizes of blocks allocated by allocation functions of pools, and number of blocks freed
+std::vector<std::size_t> g_allocated;
+std::size_t g_freed;
+
+void* count_alloc(std::size_t size)
+{
+	g_allocated.push_back(size);
+	return std::malloc(size);
+}
+
+void count_free(void* memory)
+{
+	++g_freed;
+	std::free(memory);
+}
+
+// Allocate given number of strings of 1000 characters, which come from dynamic blocks beyond the first 64
+void fill(memory_pool<char>& pool, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+		pool.allocate_string(0, 1000)[999] = 'x';
+}
+
+void test_retention()
+{
+	// Blocks kept by clear() serve the next fill without allocating
+	memory_pool<char> pool;
+	pool.set_allocator(&count_alloc, &count_free);
+	g_allocated.clear();
+	fill(pool, 300);
+	std::size_t blocks = g_allocated.size();
+	XTEST_CHECK(blocks >= 3);
+	pool.set_retention(megabyte);
+	pool.clear();
+	g_allocated.clear();
+	g_freed = 0;
+	fill(pool, 300);
+	XTEST_CHECK(g_allocated.empty() && g_freed == 0);
+
+	// Blocks beyond retention are freed, at once when it is lowered
+	pool.clear();
+	pool.set_retention(0);
+	XTEST_CHECK(g_freed == blocks);
+	fill(pool, 300);
+	XTEST_CHECK(g_allocated.size() == blocks);
+	pool.clear();
+	XTEST_CHECK(g_freed == 2 * blocks);
+}
+
+void test_block_sizes()
+{
+	// Blocks double from the first size up to the largest one
+	memory_pool<char> pool;
+	pool.set_allocator(&count_alloc, &count_free);
+	pool.set_block_sizes(64 * 1024, 2, megabyte);
+	g_allocated.clear();
+	fill(pool, 8 * 1024);
+	XTEST_CHECK(g_allocated.size() >= 5 && g_allocated.size() <= 12);
+	XTEST_CHECK(g_allocated[0] >= 64 * 1024 && g_allocated[0] < 64 * 1024 + 256);
+	bool doubling = true;
+	for (std::size_t i = 1; i < g_allocated.size(); ++i)
+		doubling = doubling && g_allocated[i] >= g_allocated[i - 1] && g_allocated[i] < megabyte + 256;
+	XTEST_CHECK(doubling && g_allocated.back() >= megabyte);
+
+	// Allocation larger than the largest block gets a block of its own size
+	pool.allocate_string(0, 3 * megabyte);
+	XTEST_CHECK(g_allocated.back() >= 3 * megabyte);
+
+	// Growth starts again from the first size after clear()
+	pool.clear();
+	g_allocated.clear();
+	fill(pool, 100);
+	XTEST_CHECK(g_allocated.size() == 1 && g_allocated[0] < 64 * 1024 + 256);
+
+	// Large block mapped for huge pages starts at a huge page boundary
+	memory_pool<char> huge;
+	huge.set_huge_pages(true);
+	huge.set_block_sizes(4 * megabyte, 1, 4 * megabyte);
+	char* string = huge.allocate_string(0, 70000);
+	std::memset(string, 'x', 70000);
+	XTEST_CHECK(reinterpret_cast<std::size_t>(string) % (2 * megabyte) < 64);
+}
+
+void test_presize()
+{
+	// Presized block serves allocations in one run of memory
+	memory_pool<char> pool;
+	pool.set_allocator(&count_alloc, &count_free);
+	pool.allocate_string(0, RAPIDXML_STATIC_POOL_SIZE);      // Static memory is used up
+	g_allocated.clear();
+	pool.presize(megabyte);
+	XTEST_CHECK(g_allocated.size() == 1 && g_allocated[0] >= megabyte);
+	char* previous = pool.allocate_string(0, 1000);
+	bool contiguous = true;
+	for (int i = 1; i < 1000; ++i)
+	{
+		char* string = pool.allocate_string(0, 1000);
+		contiguous = contiguous && string >= previous + 1000 && string < previous + 1000 + RAPIDXML_ALIGNMENT;
+		previous = string;
+	}
+	XTEST_CHECK(contiguous && g_allocated.size() == 1);
+
+	// Parser presizes text of known size, so nodes lie in one block in document order
+	std::string text = "<list>";
+	for (int i = 0; i < 20000; ++i)
+		text += "<item id='1' kind='a'><name>n</name></item>";
+	text += "</list>";
+	xml_document<char> document;
+	document.set_allocator(&count_alloc, &count_free);
+	g_allocated.clear();
+	document.parse<parse_presize>(text.data(), text.size());
+	XTEST_CHECK(g_allocated.size() == 1);
+	const char* last = 0;
+	bool ordered = true;
+	for (xml_node<char>* item = document.first_node()->first_node(); item; item = item->next_sibling())
+	{
+		ordered = ordered && reinterpret_cast<const char*>(item) > last;
+		last = reinterpret_cast<const char*>(item->first_node());
+	}
+	XTEST_CHECK(ordered);
+
+	// Zero-terminated text is not presized, and takes the blocks it would take without the flag
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back('\0');
+	document.clear();
+	g_allocated.clear();
+	document.parse<parse_default>(&copy[0]);
+	std::size_t blocks = g_allocated.size();
+	std::vector<char> again(text.begin(), text.end());
+	again.push_back('\0');
+	document.clear();
+	g_allocated.clear();
+	document.parse<parse_presize>(&again[0]);
+	XTEST_CHECK(blocks > 1 && g_allocated.size() == blocks);
+	XTEST_CHECK(xml_document<char>::parse_available(parse_presize | parse_full));
+}
+
+#endif
+
+#if defined(XPROC_POOL_STATISTICS)
+
+void test_statistics()
+{
+	// Counts of a parse follow the nodes and attributes made
+	std::vector<char> text(order, order + sizeof(order));
+	xml_document<char> document;
+	document.parse<parse_default>(&text[0]);
+	const pool_statistics& counts = document.statistics();
+	XTEST_CHECK(counts.node_bytes == 7 * sizeof(xml_node<char>) && counts.attribute_bytes == 2 * sizeof(xml_attribute<char>));
+	XTEST_CHECK(counts.string_bytes == 0 && counts.allocations == 9 && counts.bytes == counts.node_bytes + counts.attribute_bytes);
+#if defined(XPROC_COMPACT_NODES)
+	XTEST_CHECK(counts.static_allocations == 0 && counts.blocks == 1);
+#else
+	XTEST_CHECK(counts.static_allocations == 9 && counts.blocks == 0);
+#endif
+	XTEST_CHECK(counts.used_bytes == counts.bytes + counts.padding_bytes + counts.tail_bytes && counts.peak_bytes == counts.used_bytes);
+
+	// Strings are counted, and used bytes start again from 0 on clear() while the peak is kept
+	std::size_t peak = counts.peak_bytes;
+	document.allocate_string(0, 10);
+	XTEST_CHECK(counts.string_bytes == 10 && counts.allocations == 10);
+	document.clear();
+	XTEST_CHECK(counts.used_bytes == 0 && counts.peak_bytes >= peak + 10);
+	document.reset_statistics();
+	XTEST_CHECK(counts.allocations == 0 && counts.bytes == 0 && counts.peak_bytes == 0);
+
+	// Tails are left by allocations which do not fit in what remains of a block
+	document.allocate_string(0, 1000);
+	for (int i = 0; i < 200; ++i)
+		document.allocate_string(0, 1000);
+	XTEST_CHECK(counts.blocks >= 1 && counts.string_bytes == 201 * 1000);
+	XTEST_CHECK(counts.used_bytes == counts.bytes + counts.padding_bytes + counts.tail_bytes);
+}
+
+#endif
+
+} // namespace
+
+int main()
+{
+	test_scanning();
+	test_parsing();
+#if !defined(XPROC_COMPACT_NODES)
+	test_retention();
+	test_block_sizes();
+	test_presize();
+#endif
+#if defined(XPROC_POOL_STATISTICS)
+	test_statistics();
+#endif
+	return xprocesser::xtest::report("TestMemoryPool");
+}
@@ -0,0 +1,168 @@
+/*
+ * TestParallel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+// Result of parsing copy of text with given number of threads, in the form of xprocesser::xtest::parsed()
+template<int Flags>
+std::string parsed_parallel(const std::string& text, unsigned threads)
+{
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xml_document<char> document;
+	try
+	{
+		document.parse_parallel<Flags>(&copy[0], threads);
+	}
+	catch (const parse_error& error)
+	{
+		char where[32];
+		std::snprintf(where, sizeof(where), " at %ld", static_cast<long>(error.where<char>() - &copy[0]));
+		return std::string("error: ") + error.what() + where;
+	}
+	if (Flags & parse_lazy)
+		dump(&document);        // Parses deferred contents, which sets values of their elements
+	return dump(&document);
+}
+
+// Check that parallel parse with every number of threads gives the tree or error of serial parse
+template<int Flags>
+void check_same(const std::string& text)
+{
+	std::string expected = parsed<Flags>(text);
+	for (unsigned threads = 1; threads <= 8; ++threads)
+		XTEST_CHECK(parsed_parallel<Flags>(text, threads) == expected);
+}
+
+void check_all(const std::string& text)
+{
+	check_same<parse_default>(text);
+	check_same<parse_non_destructive>(text);
+	check_same<parse_full>(text);
+	check_same<parse_trim_whitespace | parse_normalize_whitespace>(text);
+	check_same<parse_intern_names>(text);
+	check_same<parse_lazy>(text);
+}
+
+// Records named like the first child, which also appear where split guesses go wrong:
+// nested, in comments, in CDATA, in attribute values and in text
+std::string records(int count, const std::string& tail)
+{
+	std::string out = "<?xml version='1.0'?>\n<root>";
+	char buffer[256];
+	for (int i = 0; i < count; ++i)
+	{
+		std::snprintf(buffer, sizeof(buffer), "\n  <rec id='%d' note=\"&lt;rec&gt; <rec\">v&amp;%d", i, i);
+		out += buffer;
+		switch (i % 5)
+		{
+		case 1: out += "<rec>nested <rec/></rec>"; break;
+		case 2: out += "<!-- <rec> --><x a='1'/>"; break;
+		case 3: out += "<![CDATA[<rec>]]>"; break;
+		case 4: out += "  <y>  spaced   text  </y>"; break;
+		}
+		out += "</rec>";
+	}
+	out += tail;
+	return out;
+}
+
+void test_documents()
+{
+	check_all(records(0, "</root>"));
+	check_all(records(3, "</root>"));
+	check_all(records(200, "</root>\n<!-- after -->"));
+
+	// Guesses landing inside one long record
+	check_all(records(2, "<rec>" + std::string(4000, 'x') + "<rec>inner</rec></rec></root>"));
+
+	// First child with attributes only, then text between children
+	check_all("<root><rec a='1'/>text<rec b='2'/>more text<rec/>end</root>");
+}
+
+void test_errors()
+{
+	// Errors in every part give the error of serial parse, at the same place
+	std::string good = records(100, "</root>");
+	for (std::size_t at = good.size() / 10; at < good.size(); at += good.size() / 7)
+	{
+		std::string bad = good;
+		bad.insert(bad.find("<rec", at), "<bad a=1>");
+		check_all(bad);
+		bad = good;
+		bad.insert(bad.find("</rec>", at), "</oops>");
+		check_all(bad);
+	}
+	check_all(good.substr(0, good.size() - 20));
+}
+
+// Deferred contents of nodes parsed by workers are parsed by the document
+void test_lazy()
+{
+	std::string text = records(100, "</root>");
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xml_document<char> document;
+	document.parse_parallel<parse_lazy>(&copy[0], 4);
+	xml_node<char>* last = document.first_node("root")->last_node("rec");
+	XTEST_CHECK(last && last->first_node("y"));
+	XTEST_STRING(last->first_node("y")->value(), last->first_node("y")->value_size(), "  spaced   text  ");
+	dump(&document);
+	XTEST_CHECK(dump(&document) == parsed<parse_default>(text));
+}
+
+// One document parses again and again with different numbers of threads, on the threads it keeps, also after an error
+void test_reuse()
+{
+	std::string good = records(100, "</root>");
+	std::string bad = good;
+	bad.insert(bad.find("</rec>", good.size() / 2), "</oops>");
+	std::string expected = parsed<parse_default>(good);
+	xml_document<char> document;
+	static const unsigned threads[] = { 8, 2, 5, 1, 8, 3 };
+	for (std::size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); ++i)
+	{
+		std::vector<char> copy(bad.begin(), bad.end());
+		copy.push_back(0);
+		bool thrown = false;
+		try
+		{
+			document.parse_parallel<parse_default>(&copy[0], threads[i]);
+		}
+		catch (const parse_error&)
+		{
+			thrown = true;
+		}
+		XTEST_CHECK(thrown);
+		copy.assign(good.begin(), good.end());
+		copy.push_back(0);
+		document.parse_parallel<parse_default>(&copy[0], threads[i]);
+		XTEST_CHECK(dump(&document) == expected);
+	}
+}
+
+} // namespace
+
+int main()
+{
+	test_documents();
+	test_errors();
+	test_lazy();
+	test_reuse();
+	return xprocesser::xtest::report("TestParallel");
+}
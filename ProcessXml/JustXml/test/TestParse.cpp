@@ -0,0 +1,165 @@
+/*
+ * TestParse.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+// Check that parsing copy of text with given flags fails
+template<int Flags>
+bool fails(const char* text)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	xml_document<char> document;
+	try
+	{
+		document.parse<Flags>(&copy[0]);
+	}
+	catch (const parse_error&)
+	{
+		return true;
+	}
+	return false;
+}
+
+void test_elements()
+{
+	char text[] = "<root a='1' b=\"two\"><child>text</child><empty/><child x='y'/></root>";
+	xml_document<char> document;
+	document.parse<parse_default>(text);
+
+	xml_node<char>* root = document.first_node();
+	XTEST_CHECK(root && root->type() == node_element);
+	XTEST_STRING(root->name(), root->name_size(), "root");
+	XTEST_CHECK(root->first_attribute("b") && std::strcmp(root->first_attribute("b")->value(), "two") == 0);
+	XTEST_CHECK(root->last_attribute()->previous_attribute() == root->first_attribute());
+	XTEST_CHECK(root->first_node("empty") && !root->first_node("empty")->first_node());
+	XTEST_CHECK(root->last_node("child")->first_attribute("x"));
+	XTEST_CHECK(root->first_node("child")->next_sibling("child") == root->last_node());
+	XTEST_CHECK(root->last_node()->previous_sibling("CHILD", 0, false) == root->first_node());
+	XTEST_CHECK(root->first_node("missing") == 0);
+	XTEST_STRING(root->first_node()->value(), root->first_node()->value_size(), "text");
+	XTEST_CHECK(root->first_node()->first_node()->type() == node_data);
+	XTEST_CHECK(root->document() == &document && root->first_node()->parent() == root);
+
+	// Strings are terminated in place by default
+	XTEST_CHECK(root->name()[4] == '\0');
+}
+
+void test_character_references()
+{
+	XTEST_CHECK(parsed<parse_default>("<a>&lt;&gt;&amp;&quot;&apos;</a>") == "0=[](1a=<>&\"'[](2=<>&\"'[]()))");
+	XTEST_CHECK(parsed<parse_default>("<a>&#65;&#x42;&#x20AC;</a>") == "0=[](1a=AB\xE2\x82\xAC[](2=AB\xE2\x82\xAC[]()))");
+	XTEST_CHECK(parsed<parse_default>("<a v='x&amp;y &unknown; &'/>") == "0=[](1a=[v=x&y &unknown; &;]())");
+	XTEST_CHECK(parsed<parse_non_destructive>("<a>&amp;</a>") == "0=[](1a=&amp;[](2=&amp;[]()))");
+
+	// Long runs between references, so that expansion goes run by run
+	std::string text = "<a>" + std::string(100, 'x') + "&amp;" + std::string(37, 'y') + "&#x41;</a>";
+	XTEST_CHECK(parsed<parse_default>(text.c_str()) == "0=[](1a=" + std::string(100, 'x') + "&" + std::string(37, 'y') + "A[](2=" + std::string(100, 'x') + "&" + std::string(37, 'y') + "A[]()))");
+}
+
+void test_whitespace()
+{
+	XTEST_CHECK(parsed<parse_trim_whitespace>("<a>  x  y  </a>") == "0=[](1a=x  y[](2=x  y[]()))");
+	XTEST_CHECK(parsed<parse_trim_whitespace | parse_normalize_whitespace>("<a>  x \t\n y  </a>") == "0=[](1a=x y[](2=x y[]()))");
+	XTEST_CHECK(parsed<parse_trim_whitespace>("<a> <b/> </a>") == "0=[](1a=[](1b=[]()))");
+}
+
+void test_node_kinds()
+{
+	const char* text = "<?xml version='1.0'?><!DOCTYPE a><!-- c --><?pi x?><a><![CDATA[<&>]]></a>";
+	XTEST_CHECK(parsed<parse_default>(text) == "0=[](1a=[](3=<&>[]()))");
+	XTEST_CHECK(parsed<parse_full>(text) == "0=[](5=[version=1.0;]()6=a[]()4= c []()7pi=x[]()1a=[](3=<&>[]()))");
+	XTEST_CHECK(parsed<parse_no_data_nodes>("<a>x<b/>y</a>") == "0=[](1a=x[](1b=[]()))");
+	XTEST_CHECK(parsed<parse_fastest>("<a>x<b/>y</a>") == "0=[](1a=x[](1b=[]()))");
+}
+
+void test_non_destructive()
+{
+	const char* original = "<a b='&amp;'>x&lt;</a>";
+	char text[32];
+	std::strcpy(text, original);
+	xml_document<char> document;
+	document.parse<parse_non_destructive>(text);
+	XTEST_CHECK(std::strcmp(text, original) == 0);
+	XTEST_STRING(document.first_node()->name(), document.first_node()->name_size(), "a");
+	XTEST_STRING(document.first_node()->value(), document.first_node()->value_size(), "x&lt;");
+}
+
+void test_errors()
+{
+	XTEST_CHECK(fails<parse_default>("<a>"));
+	XTEST_CHECK(fails<parse_default>("<a b='1></a>"));
+	XTEST_CHECK(fails<parse_default>("<a><!-- x </a>"));
+	XTEST_CHECK(fails<parse_default>("x<a/>"));
+	XTEST_CHECK(!fails<parse_default>("<a></b>"));
+	XTEST_CHECK(fails<parse_validate_closing_tags>("<a></b>"));
+	XTEST_CHECK(fails<parse_default>("<a>&#xFFFFFFFFF;</a>"));
+}
+
+void test_modification()
+{
+	char text[] = "<a><b/><c/></a>";
+	xml_document<char> document;
+	document.parse<parse_default>(text);
+	xml_node<char>* a = document.first_node();
+
+	xml_node<char>* d = document.allocate_node(node_element, "d");
+	a->insert_node(a->first_node("c"), d);
+	a->append_attribute(document.allocate_attribute("k", "v"));
+	a->prepend_node(document.allocate_node(node_element, "first"));
+	XTEST_CHECK(dump(&document) == "0=[](1a=[k=v;](1first=[]()1b=[]()1d=[]()1c=[]()))");
+
+	a->remove_node(d);
+	a->remove_first_node();
+	a->remove_last_node();
+	a->remove_all_attributes();
+	XTEST_CHECK(dump(&document) == "0=[](1a=[](1b=[]()))");
+
+	a->remove_all_nodes();
+	XTEST_CHECK(!a->first_node());
+
+	// Parsing again replaces the tree
+	char again[] = "<z/>";
+	document.parse<parse_default>(again);
+	XTEST_CHECK(dump(&document) == "0=[](1z=[]())");
+	document.clear();
+	XTEST_CHECK(!document.first_node());
+}
+
+// Without optional members, nodes and attributes are as large as those of rapidxml: no virtual table, only pointers and lengths
+void test_layout()
+{
+#if !defined(XPROC_COMPACT_NODES) && !defined(XPROC_LAZY_CONTENTS) && !defined(XPROC_INTERN_NAMES) && XPROC_CHILD_INDEX_LOOKUPS == 0
+	XTEST_CHECK(sizeof(Xml_Base<char>) == 5 * sizeof(void*));
+	XTEST_CHECK(sizeof(xml_attribute<char>) == 7 * sizeof(void*));
+	XTEST_CHECK(sizeof(xml_node<char>) == 12 * sizeof(void*));
+#endif
+}
+
+} // namespace
+
+int main()
+{
+	test_elements();
+	test_character_references();
+	test_whitespace();
+	test_node_kinds();
+	test_non_destructive();
+	test_errors();
+	test_modification();
+	test_layout();
+	return xprocesser::xtest::report("TestParse");
+}
@@ -0,0 +1,132 @@
+/*
+ * TestQuery.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlQuery.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::append;
+
+namespace
+{
+
+const char catalog[] =
+		"<catalog>"
+		"<item type='book' id='1'><title>Dune</title><price currency='EUR'>10</price></item>"
+		"<item type='film' id='2'><title>Alien</title><price currency='USD'>12</price></item>"
+		"<item type='book' id='3'><title>Emma</title>note<![CDATA[<x>]]><price>7</price></item>"
+		"<group><item type='book' id='4'><title>Ulysses</title></item></group>"
+		"</catalog>";
+
+// Results of query from context, each as name=value, separated by spaces
+std::string selected(const char* text, xml_node<char>* context)
+{
+	xml_query<char> query(text);
+	Xml_Base<char>* results[32];
+	std::size_t count = query.select(context, results, 32);
+	std::string out;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (i)
+			out += ' ';
+		append(out, results[i]->name(), results[i]->name_size());
+		out += '=';
+		append(out, results[i]->value(), results[i]->value_size());
+	}
+
+	// First result is the first one selected
+	Xml_Base<char>* first = query.first(context);
+	if (first != (count ? results[0] : 0))
+		out += " (first differs)";
+	return out;
+}
+
+// Message of error compiling query, or empty string
+std::string compile_error(const char* text)
+{
+	try
+	{
+		xml_query<char> query(text);
+	}
+	catch (const parse_error& error)
+	{
+		return error.what();
+	}
+	return std::string();
+}
+
+void test_select()
+{
+	std::vector<char> copy(catalog, catalog + sizeof(catalog));
+	xml_document<char> document;
+	document.parse<parse_default>(&copy[0]);
+	xml_node<char>* root = document.first_node();
+
+	// Child and descendant steps, absolute and relative
+	XTEST_CHECK(selected("/catalog/item/title", &document) == "title=Dune title=Alien title=Emma");
+	XTEST_CHECK(selected("//title", root) == "title=Dune title=Alien title=Emma title=Ulysses");
+	XTEST_CHECK(selected("item/price", root) == "price=10 price=12 price=7");
+	XTEST_CHECK(selected(".//item//title", root) == "title=Dune title=Alien title=Emma title=Ulysses");
+	XTEST_CHECK(selected("/catalog/group/*", root->first_node()) == "item=");
+	XTEST_CHECK(selected("/missing", root) == "");
+
+	// Text and attribute steps
+	XTEST_CHECK(selected("/catalog/item[3]/text()", root) == "=note =<x>");
+	XTEST_CHECK(selected("//price/@currency", root) == "currency=EUR currency=USD");
+	XTEST_CHECK(selected("/catalog/item[2]/@*", root) == "type=film id=2");
+
+	// Predicates, applied in order; positions count among children of the same parent
+	XTEST_CHECK(selected("/catalog/item[@type='book']/title", root) == "title=Dune title=Emma");
+	XTEST_CHECK(selected("/catalog/item[@type='book'][2]/title", root) == "title=Emma");
+	XTEST_CHECK(selected("/catalog/item[2][@type='book']/title", root) == "");
+	XTEST_CHECK(selected("//item[1]/@id", root) == "id=1 id=4");
+	XTEST_CHECK(selected("//price[@currency]", root) == "price=10 price=12");
+	XTEST_CHECK(selected("//item[@type=\"film\"]/price", root) == "price=12");
+
+	// Results in document order without duplicates, whichever steps select them
+	XTEST_CHECK(selected("//*//title", root) == "title=Dune title=Alien title=Emma title=Ulysses");
+
+	// Capacity bounds results
+	xml_query<char> query("//title");
+	Xml_Base<char>* results[2];
+	XTEST_CHECK(query.select(root, results, 2) == 2 && results[1]->value()[0] == 'A');
+	XTEST_CHECK(!query.selects_attributes() && xml_query<char>("//@id").selects_attributes());
+}
+
+void test_errors()
+{
+	XTEST_CHECK(compile_error("/catalog/item[") != "");
+	XTEST_CHECK(compile_error("/catalog/@id/title") != "");
+	XTEST_CHECK(compile_error("/catalog/item[@type='book]") != "");
+	XTEST_CHECK(compile_error("/catalog/item[0]") != "");
+	XTEST_CHECK(compile_error("/catalog//") != "");
+	XTEST_CHECK(compile_error("/catalog/item[@type='book'][2]") == "");
+
+	// Query left selecting the context node after an error
+	xml_query<char> query("/catalog");
+	try
+	{
+		query.compile("/catalog[");
+	}
+	catch (const parse_error&)
+	{
+	}
+	xml_document<char> document;
+	XTEST_CHECK(query.first(&document) == &document);
+}
+
+} // namespace
+
+int main()
+{
+	test_select();
+	test_errors();
+	return xprocesser::xtest::report("TestQuery");
+}
@@ -0,0 +1,344 @@
+/*
+ * TestReader.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlReader.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+
+namespace
+{
+
+const char sample[] =
+		"\xEF\xBB\xBF<?xml version='1.0' encoding='utf-8'?>\n"
+		"<!DOCTYPE order [ <!ELEMENT order ANY> ]>\n"
+		"<!-- header -->\n"
+		"<order id='17' note=\"a &amp; b\">\n"
+		"  <customer><name>Ann &#x26; Bo</name><?audit checked?></customer>\n"
+		"  <item sku='a1'>  two   words  <![CDATA[<raw> & ]]>tail &lt;x&gt;</item>\n"
+		"  <empty/><empty a='1'/>\n"
+		"  <!-- inner -->\n"
+		"</order>\n"
+		"<!-- trailer -->\n";
+
+// Events of a document, as the reader reports them: name and attributes of elements, values of other nodes.
+// Consecutive text is joined, since the reader may report long text as several events.
+class events
+{
+public:
+
+	events()
+	: m_data(false) {}
+
+	void start(const xml_node<char>* node)
+	{
+		m_out += "<";
+		m_out.append(node->name(), node->name_size());
+		for (const xml_attribute<char>* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+		{
+			m_out += " ";
+			m_out.append(attribute->name(), attribute->name_size());
+			m_out += "=";
+			m_out.append(attribute->value(), attribute->value_size());
+		}
+		m_out += ">";
+		m_data = false;
+	}
+
+	void end(const xml_node<char>* node)
+	{
+		m_out += "</";
+		m_out.append(node->name(), node->name_size());
+		m_out += ">";
+		m_data = false;
+	}
+
+	void other(const xml_node<char>* node)
+	{
+		if (node->type() == node_declaration)
+		{
+			start(node);
+			return;
+		}
+		if (node->type() != node_data || !m_data)
+		{
+			static const char* kinds = "#ED[M?TP";
+			m_out += "|";
+			m_out += kinds[node->type()];
+			m_out.append(node->name(), node->name_size());
+			m_out += ":";
+		}
+		m_out.append(node->value(), node->value_size());
+		m_data = node->type() == node_data;
+	}
+
+	const std::string& str() const
+	{
+		return m_out;
+	}
+
+private:
+
+	std::string m_out;
+	bool m_data;                // Last event was text
+};
+
+// Events of the tree below node
+void walk(const xml_node<char>* node, events& out)
+{
+	for (const xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+		if (child->type() == node_element)
+		{
+			out.start(child);
+			walk(child, out);
+			out.end(child);
+		}
+		else
+			out.other(child);
+}
+
+// Events of DOM parsed from copy of text with given flags
+template<int Flags>
+std::string walked(const std::string& text)
+{
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back('\0');
+	xml_document<char> document;
+	document.parse<Flags>(&copy[0]);
+	events out;
+	walk(&document, out);
+	return out.str();
+}
+
+// Record event of reader; return false at end of document
+template<int Flags>
+bool record(xml_reader<char>& reader, reader_event event, events& out)
+{
+	if (event == reader_end_of_document)
+	{
+		XTEST_CHECK(!reader.node());
+		return false;
+	}
+	if (event == reader_start_element)
+		out.start(reader.node());
+	else if (event == reader_end_element)
+		out.end(reader.node());
+	else
+		out.other(reader.node());
+	return true;
+}
+
+// Input read in pieces of varying size, up to the count asked for
+struct source
+{
+	const std::string* text;
+	std::size_t position;
+	unsigned seed;
+};
+
+std::size_t read_pieces(void* data, char* buffer, std::size_t count)
+{
+	source& input = *static_cast<source*>(data);
+	input.seed = input.seed * 1103515245u + 12345u;
+	std::size_t size = 1 + (input.seed >> 16) % 97;
+	if (size > count)
+		size = count;
+	if (size > input.text->size() - input.position)
+		size = input.text->size() - input.position;
+	std::memcpy(buffer, input.text->data() + input.position, size);
+	input.position += size;
+	return size;
+}
+
+// Events of reader pulling text through window of given size
+template<int Flags>
+std::string pulled(const std::string& text, std::size_t window)
+{
+	source input = { &text, 0, 5 };
+	xml_reader<char> reader(&read_pieces, &input, window);
+	events out;
+	while (record<Flags>(reader, reader.next<Flags>(), out))
+		;
+	XTEST_CHECK(reader.next<Flags>() == reader_end_of_document);
+	return out.str();
+}
+
+// Events of reader fed text in chunks of given size
+template<int Flags>
+std::string pushed(const std::string& text, std::size_t chunk, std::size_t window)
+{
+	xml_reader<char> reader(window);
+	events out;
+	std::size_t position = 0;
+	for (;;)
+	{
+		reader_event event = reader.next<Flags>();
+		if (event == reader_need_more)
+		{
+			if (position == text.size())
+				reader.finish();
+			else
+			{
+				std::size_t size = text.size() - position < chunk ? text.size() - position : chunk;
+				position += reader.feed(text.data() + position, size);
+			}
+			continue;
+		}
+		if (!record<Flags>(reader, event, out))
+			break;
+	}
+	return out.str();
+}
+
+// Text of catalog whose records are long enough to cross windows
+std::string catalog()
+{
+	std::string text = "<catalog>";
+	char record[256];
+	for (int i = 0; i < 400; ++i)
+	{
+		std::sprintf(record, "<item id='%d' state=\"%s\"><name>item &amp; %d</name><text>%s</text></item>\n",
+				i, i % 2 ? "on" : "off", i, std::string(i % 150, 'a' + i % 26).c_str());
+		text += record;
+	}
+	text += "<long>" + std::string(5000, 'z') + "&#x41;</long></catalog>";
+	return text;
+}
+
+template<int Flags>
+void test_same_events(const std::string& text)
+{
+	std::string expected = walked<Flags>(text);
+	bool pull = true, push = true;
+	for (std::size_t window = 256; window <= 4096; window *= 4)
+		pull = pull && pulled<Flags>(text, window) == expected;
+	static const std::size_t chunks[] = { 1, 2, 7, 64, 1000, 100000 };
+	for (std::size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); ++i)
+		push = push && pushed<Flags>(text, chunks[i], 256) == expected;
+	XTEST_CHECK(pull);
+	XTEST_CHECK(push);
+}
+
+void test_events()
+{
+	// Events follow the tree the document builds, whatever the window and pieces of input
+	test_same_events<parse_default>(sample);
+	test_same_events<parse_full>(sample);
+	test_same_events<parse_non_destructive>(sample);
+	test_same_events<parse_no_data_nodes>(sample);
+	test_same_events<parse_declaration_node>(sample);
+	test_same_events<parse_default>(catalog());
+	test_same_events<parse_non_destructive>(catalog());
+	test_same_events<parse_comment_nodes>(catalog());
+
+	// Text longer than the window comes as several events
+	std::string text = "<a>" + std::string(1000, 'x') + "</a>";
+	xml_reader<char> reader(64);
+	reader.feed(text.data(), 64);
+	std::size_t data = 0, events = 0;
+	std::size_t position = 64;
+	for (reader_event event; (event = reader.next<parse_default>()) != reader_end_of_document; )
+		if (event == reader_need_more)
+		{
+			if (position == text.size())
+				reader.finish();
+			else
+				position += reader.feed(text.data() + position, text.size() - position);
+		}
+		else if (event == reader_data)
+		{
+			data += reader.node()->value_size();
+			++events;
+		}
+	XTEST_CHECK(data == 1000 && events > 1);
+
+	// Markup filling the whole window is read, pulled or pushed
+	std::string tag = "<a x='" + std::string(64 - 9, 'y') + "'/>";
+	text = "<r>" + tag + "<b/></r>";
+	XTEST_CHECK(tag.size() == 64);
+	XTEST_CHECK(pulled<parse_default>(text, 64) == walked<parse_default>(text));
+	XTEST_CHECK(pushed<parse_default>(text, 1000, 64) == walked<parse_default>(text));
+
+	// Markup ending at the end of fed input is reported before more input is asked for
+	xml_reader<char> fed(64);
+	fed.feed("<r><a/><!--c-->", 15);
+	XTEST_CHECK(fed.next<parse_comment_nodes>() == reader_start_element);
+	XTEST_CHECK(fed.next<parse_comment_nodes>() == reader_start_element);
+	XTEST_CHECK(fed.next<parse_comment_nodes>() == reader_end_element);
+	XTEST_CHECK(fed.next<parse_comment_nodes>() == reader_comment);
+	XTEST_CHECK(fed.next<parse_comment_nodes>() == reader_need_more);
+}
+
+void test_read_file()
+{
+	std::FILE* file = std::tmpfile();
+	if (!XTEST_CHECK(file))
+		return;
+	std::fwrite(sample, 1, sizeof(sample) - 1, file);
+	std::rewind(file);
+	xml_reader<char> reader(&xml_reader<char>::read_file, file, 128);
+	events out;
+	while (record<parse_full>(reader, reader.next<parse_full>(), out))
+		;
+	XTEST_CHECK(out.str() == walked<parse_full>(sample));
+	std::fclose(file);
+}
+
+// Check that reading whole text with given flags fails, both when pulled and when pushed
+template<int Flags>
+bool fails(const std::string& text, std::size_t window = 256)
+{
+	bool pull = false, push = false;
+	try
+	{
+		pulled<Flags>(text, window);
+	}
+	catch (const parse_error&)
+	{
+		pull = true;
+	}
+	try
+	{
+		pushed<Flags>(text, 1000, window);
+	}
+	catch (const parse_error&)
+	{
+		push = true;
+	}
+	XTEST_CHECK(pull == push);
+	return pull && push;
+}
+
+void test_errors()
+{
+	XTEST_CHECK(fails<parse_default>("<a><b></b>"));
+	XTEST_CHECK(fails<parse_default>("<a x='1></a>"));
+	XTEST_CHECK(fails<parse_validate_closing_tags>("<a><b></c></a>"));
+	XTEST_CHECK(!fails<parse_default>("<a><b></c></a>"));
+	XTEST_CHECK(fails<parse_default>("<a " + std::string(200, 'x') + "='1'/>", 64));
+	XTEST_CHECK(!fails<parse_default>("<a " + std::string(200, 'x') + "='1'/>", 256));
+	XTEST_CHECK(fails<parse_default>("<a><!-- open"));
+
+	// Zero character inside of element content ends data, as in parse()
+	XTEST_CHECK(fails<parse_default>(std::string("<a>x\0y</a>", 10)));
+	XTEST_CHECK(fails<parse_default>(std::string("<a>\0</a>", 8)));
+	XTEST_CHECK(fails<parse_non_destructive>(std::string("<a><b/>x\0</a>", 13)));
+}
+
+} // namespace
+
+int main()
+{
+	test_events();
+	test_read_file();
+	test_errors();
+	return xprocesser::xtest::report("TestReader");
+}
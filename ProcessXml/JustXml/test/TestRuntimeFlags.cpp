@@ -0,0 +1,122 @@
+/*
+ * TestRuntimeFlags.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+const char text[] = "<?xml version='1.0'?><a x='1'>  some   text  <!--note--><b>v &amp; w</b></a>";
+
+// Dump of document parsed from copy of text with flags given at run time
+std::string parsed_at_run_time(const char* source, int flags)
+{
+	std::vector<char> copy(source, source + std::strlen(source) + 1);
+	xml_document<char> document;
+	document.parse(&copy[0], flags);
+	return dump(&document);
+}
+
+// Check that flags given at run time parse as the same flags given at compile time
+template<int Flags>
+bool same(const char* source)
+{
+	return parsed_at_run_time(source, Flags) == parsed<Flags>(source);
+}
+
+void test_instantiated()
+{
+	// Combinations of run-time flags, and others explicitly instantiated
+	XTEST_CHECK(same<parse_default>(text));
+	XTEST_CHECK(same<parse_non_destructive>(text));
+	XTEST_CHECK(same<parse_comment_nodes>(text));
+	XTEST_CHECK(same<parse_trim_whitespace>(text));
+	XTEST_CHECK(same<parse_trim_whitespace | parse_normalize_whitespace>(text));
+	XTEST_CHECK(same<parse_validate_closing_tags>(text));
+	XTEST_CHECK(same<parse_fastest>(text));
+	XTEST_CHECK(same<parse_full>(text));
+	XTEST_CHECK(same<parse_declaration_node>(text));
+	XTEST_CHECK(same<parse_no_data_nodes>(text));
+	XTEST_CHECK(same<parse_presize | parse_full>(text));
+	XTEST_CHECK(same<parse_structural_index | parse_non_destructive>(text));
+}
+
+void test_combinations()
+{
+	// Every combination of run-time flags has the effect of each of its flags
+	const int flags[] = { parse_non_destructive, parse_comment_nodes, parse_validate_closing_tags, parse_trim_whitespace, parse_normalize_whitespace };
+	const int count = sizeof(flags) / sizeof(flags[0]);
+	int errors = 0;
+	for (int combination = 0; combination < 1 << count; ++combination)
+	{
+		int mask = 0;
+		for (int i = 0; i < count; ++i)
+			if (combination >> i & 1)
+				mask |= flags[i];
+		XTEST_CHECK(xml_document<char>::parse_available(mask));
+
+		std::vector<char> copy(text, text + sizeof(text));
+		xml_document<char> document;
+		document.parse(&copy[0], mask);
+		xml_node<char>* a = document.first_node("a");
+		std::string data(a->value(), a->value_size());
+		bool unchanged = std::memcmp(&copy[0], text, sizeof(text)) == 0;
+		bool comment = a->first_node()->next_sibling() && a->first_node()->next_sibling()->type() == node_comment;
+		bool trimmed = data[0] != ' ';
+		bool normalized = data.find("  ") == std::string::npos;
+		errors += unchanged != ((mask & parse_non_destructive) && !(mask & parse_normalize_whitespace));    // Normalized in place
+		errors += comment != ((mask & parse_comment_nodes) != 0);
+		errors += trimmed != ((mask & parse_trim_whitespace) != 0);
+		errors += normalized != ((mask & parse_normalize_whitespace) != 0);
+
+		char mismatched[] = "<a><b></c></a>";
+		bool thrown = false;
+		try
+		{
+			document.parse(mismatched, mask);
+		}
+		catch (const parse_error&)
+		{
+			thrown = true;
+		}
+		errors += thrown != ((mask & parse_validate_closing_tags) != 0);
+		if (errors)
+		{
+			std::printf("  flags %#x: data '%s'\n", mask, data.c_str());
+			break;
+		}
+	}
+	XTEST_CHECK(errors == 0);
+}
+
+void test_unavailable()
+{
+	// Flags not instantiated are rejected before the text is touched
+	const int flags = parse_lazy | parse_validate_closing_tags;
+	XTEST_CHECK(!xml_document<char>::parse_available(flags));
+	std::vector<char> copy(text, text + sizeof(text));
+	xml_document<char> document;
+	XTEST_THROWS(document.parse(&copy[0], flags));
+	XTEST_CHECK(std::memcmp(&copy[0], text, sizeof(text)) == 0 && !document.first_node());
+}
+
+} // namespace
+
+int main()
+{
+	test_instantiated();
+	test_combinations();
+	test_unavailable();
+	return xprocesser::xtest::report("TestRuntimeFlags");
+}
@@ -0,0 +1,84 @@
+/*
+ * TestScanKernels.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include "TestCheck.h"
+#include "Core/Internal/ScanKernels.h"
+
+using namespace xprocesser::xcore::xinternal;
+using xprocesser::xtest::guarded_page;
+
+namespace
+{
+
+// Fill page with members of class, a non-member now and then if asked, and terminate it with its last character
+void fill(const guarded_page& page, scan_func* scalar, unsigned seed, bool mixed)
+{
+	char members[256], others[256];
+	int member_count = 0, other_count = 0;
+	for (int c = 1; c < 256; ++c)
+	{
+		char text[2] = { static_cast<char>(c), 0 };
+		if (scalar(text) == text + 1)
+			members[member_count++] = text[0];
+		else
+			others[other_count++] = text[0];
+	}
+	for (char* p = page.begin(); p < page.end(); ++p)
+	{
+		seed = seed * 1103515245u + 12345u;
+		bool member = member_count && (!mixed || !other_count || (seed >> 16) % 97 != 0);
+		*p = member ? members[(seed >> 8) % member_count] : others[(seed >> 8) % other_count];
+	}
+	page.end()[-1] = 0;
+}
+
+// Compare kernels of instruction set with scalar ones, for scans starting near both ends of a page
+void test_kernels(scan_isa isa)
+{
+	scan_select(scan_isa_scalar);
+	scan_func* scalar[scan_class_count];
+	for (int i = 0; i < scan_class_count; ++i)
+		scalar[i] = scan_kernels[i];
+	scan_select(isa);
+
+	guarded_page page;
+	for (int i = 0; i < scan_class_count; ++i)
+	{
+		for (unsigned seed = 1; seed <= 8; ++seed)
+		{
+			fill(page, scalar[i], seed, true);
+			int mismatches = 0;
+			for (const char* p = page.begin(); p < page.begin() + 256; ++p)
+				mismatches += scan_kernels[i](p) != scalar[i](p);
+			for (const char* p = page.end() - 256; p < page.end(); ++p)
+				mismatches += scan_kernels[i](p) != scalar[i](p);
+			XTEST_CHECK(mismatches == 0);
+		}
+
+		// Runs of members up to the terminator at the end of the page, of every length and alignment
+		for (int length = 0; length < 130; ++length)
+		{
+			fill(page, scalar[i], length, false);
+			char* p = page.end() - 1 - length;
+			const char* expected = scalar[i](p);
+			XTEST_CHECK(scan_kernels[i](p) == expected);
+		}
+	}
+	scan_select(scan_detect());
+}
+
+} // namespace
+
+int main()
+{
+	test_kernels(scan_isa_scalar);
+	if (scan_detect() >= scan_isa_sse2)
+		test_kernels(scan_isa_sse2);
+	if (scan_detect() >= scan_isa_avx2)
+		test_kernels(scan_isa_avx2);
+	return xprocesser::xtest::report("TestScanKernels");
+}
@@ -0,0 +1,140 @@
+/*
+ * TestStructuralIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <vector>
+
+#include "TestCheck.h"
+
+#include "Core/Internal/StructuralIndex.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+// Characters stage 1 records in copy of text, in order, with '0' for the terminator
+std::string recorded(const std::string& text, bool declarations = false)
+{
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xprocesser::xcore::xinternal::structural_index<char> index;
+	index.build(&copy[0], declarations);
+	std::string result;
+	if (!index.active())
+		return "inactive";
+	for (char* p = index.markup_end(&copy[0]); ; p = index.markup_end(p + 1))
+	{
+		result += *p ? *p : '0';
+		if (!*p)
+			break;
+	}
+	XTEST_CHECK(result.size() == index.size());
+	return result;
+}
+
+// Check that two-stage parse builds the same tree as single stage parse, or fails with the same error
+void check_same(const std::string& text)
+{
+	XTEST_CHECK(parsed<parse_structural_index>(text) == parsed<parse_default>(text));
+	XTEST_CHECK((parsed<parse_structural_index | parse_non_destructive>(text) == parsed<parse_non_destructive>(text)));
+	XTEST_CHECK((parsed<parse_structural_index | parse_full>(text) == parsed<parse_full>(text)));
+	XTEST_CHECK((parsed<parse_structural_index | parse_trim_whitespace | parse_normalize_whitespace>(text)
+			== parsed<parse_trim_whitespace | parse_normalize_whitespace>(text)));
+}
+
+// Quotes, '>' and '=' count only inside tags; inside values only the closing quote and '&' do
+void test_masking()
+{
+	XTEST_CHECK(recorded("<a b='x\"<>=' c=\"'\">t\"e'x=t></a>") == "<=''=\"\"><>0");
+	XTEST_CHECK(recorded("<a b='&amp;'>&lt;</a>") == "<='&'>&<>0");
+	XTEST_CHECK(recorded("<a/><b x=\"1\"/>") == "<><=\"\">0");
+	XTEST_CHECK(recorded("") == "0");
+	XTEST_CHECK(recorded("it's > 1 = \"x\"") == "0");
+
+	// Quotes are name characters, and open a value only after '=' which follows the element name
+	XTEST_CHECK(recorded("<a<\"/>'") == "<<\">0");
+	XTEST_CHECK(recorded("<a b\"c = 'x>'>") == "<\"=''>0");
+	XTEST_CHECK(recorded("<a='x>'>") == "<='>0");
+	XTEST_CHECK(recorded("</a='x>'>") == "<='>0");
+}
+
+// Comments, CDATA, processing instructions and DOCTYPE record only their '<' and closing '>'
+void test_markup()
+{
+	XTEST_CHECK(recorded("<!-- '<\"> -- > --><a/>") == "<><>0");
+	XTEST_CHECK(recorded("<![CDATA[<'\"&>]>]]>'") == "<>0");
+	XTEST_CHECK(recorded("<?pi '\"> ?>") == "<>0");
+	XTEST_CHECK(recorded("<!DOCTYPE a [<!ENTITY x 'y>'>]><a/>") == "<><>0");
+	XTEST_CHECK(recorded("<!ELEMENT '>'>") == "<>0");
+
+	// Search for the closing sequence starts after the opening one, as in the parser
+	XTEST_CHECK(recorded("<!-->-->") == "<>0");
+	XTEST_CHECK(recorded("<?>?>") == "<>0");
+
+	// Declaration is a tag when its attributes are parsed, and a processing instruction otherwise
+	XTEST_CHECK(recorded("<?xml v='?>'?><a/>") == "<><>0");
+	XTEST_CHECK(recorded("<?xml v='?>'?><a/>", true) == "<=''><>0");
+
+	// Unterminated markup ends at the terminator
+	XTEST_CHECK(recorded("<!-- '") == "<0");
+	XTEST_CHECK(recorded("<a b='>") == "<='0");
+}
+
+void test_documents()
+{
+	static const char* documents[] =
+	{
+		"<a/>",
+		"<a b='x\"<>&amp;' c=\"'<&lt;>\">t\"ext'&amp;more</a>",
+		"<?xml version='1.0'?><!DOCTYPE a [<!ENTITY x 'y'>]><a><!-- '<\" --><?pi '\"?><![CDATA[<'\"&>]]></a>",
+		"<?xml v='?>'?><a/>",
+		"<a><!-->--></a>",
+		"<a><?p?></a>",
+		"<a>it's 1 > 0 = \"x\"<b c='it\"s'/></a>",
+		"<a>]\" t<a<\"/><![CDATA[\"</a>",
+		"<a b\"c = 'x>'></a>",
+		"<a='x'>x'</a='x'>",
+		"<a>  lots   of\n\twhitespace  <b>  </b>  </a>",
+		"<a>&#65;&#x20AC;&unknown;&</a>",
+		"<a b='unterminated></a>",
+		"<a><!-- unterminated</a>",
+		"<a><![CDATA[unterminated</a>",
+		"<a><?pi unterminated</a>",
+		"<a><b></a>",
+		"<a>text",
+		""
+	};
+	for (std::size_t i = 0; i < sizeof(documents) / sizeof(documents[0]); ++i)
+		check_same(documents[i]);
+}
+
+// Long runs of text, values and comments, which the second stage takes from the index, across block boundaries
+void test_long_runs()
+{
+	for (std::size_t length = 50; length < 200; length += 13)
+	{
+		std::string text = "<root>";
+		for (int i = 0; i < 20; ++i)
+			text += "<v a='" + std::string(length + i, 'q') + "\"' b=\"" + std::string(i, '<') + "\">" + std::string(length - i, 't') +
+					"&amp;'\"<!--" + std::string(i, '-') + std::string(length, '>') + "--><![CDATA[" + std::string(i, ']') + "]]></v>";
+		text += "</root>";
+		check_same(text);
+	}
+}
+
+} // namespace
+
+int main()
+{
+	test_masking();
+	test_markup();
+	test_documents();
+	test_long_runs();
+	return xprocesser::xtest::report("TestStructuralIndex");
+}
@@ -0,0 +1,191 @@
+/*
+ * TestTape.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Core/XmlFile.h"
+#include "Core/XmlTape.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using xprocesser::xtest::append;
+using xprocesser::xtest::dump;
+using xprocesser::xtest::parsed;
+
+namespace
+{
+
+const char catalog[] = "<?xml version='1.0'?><catalog><book id='1' lang='en'><title>A &amp; B</title><price/></book>"
+		"<!-- note --><book id='2'><title>C</title>text<![CDATA[x<y]]></book></catalog>";
+
+// Dump of tape node in the form of xprocesser::xtest::dump()
+std::string dump_tape(const xml_tape_node<char>& node)
+{
+	std::string out;
+	out += static_cast<char>('0' + node.type());
+	append(out, node.name(), node.name_size());
+	out += '=';
+	append(out, node.value(), node.value_size());
+	out += '[';
+	for (xml_tape_attribute<char> attribute = node.first_attribute(); attribute; attribute = attribute.next_attribute())
+	{
+		append(out, attribute.name(), attribute.name_size());
+		out += '=';
+		append(out, attribute.value(), attribute.value_size());
+		out += ';';
+	}
+	out += "](";
+	for (xml_tape_node<char> child = node.first_node(); child; child = child.next_sibling())
+		out += dump_tape(child);
+	out += ')';
+	return out;
+}
+
+// Image of tape, kept in words so that it is aligned for load()
+struct image
+{
+	std::vector<unsigned> words;
+	std::size_t size;
+
+	const char* data() const
+	{
+		return reinterpret_cast<const char*>(&words[0]);
+	}
+
+	unsigned& word(std::size_t index)
+	{
+		return words[index];
+	}
+
+	// Recompute checksum after image is changed, as a damaged image made to pass it would be
+	void seal()
+	{
+		unsigned low = 1, high = 0;
+		for (std::size_t i = 12; i < size / sizeof(unsigned); ++i)
+		{
+			low += words[i];
+			high += low;
+		}
+		words[10] = low;
+		words[11] = high;
+	}
+};
+
+// Words of header, and of records which follow it
+const std::size_t node_count_word = 6;
+const std::size_t header_words = 12;
+const std::size_t node_words = 8;
+const std::size_t attribute_words = 4;
+
+// Save tape parsed from copy of text into image
+template<int Flags>
+image saved(const char* text, unsigned long source)
+{
+	std::vector<char> copy(text, text + std::strlen(text) + 1);
+	xml_tape<char> tape;
+	tape.parse<Flags>(&copy[0]);
+	char path[] = "/tmp/TestTapeXXXXXX";
+	close(mkstemp(path));
+	tape.save(path, source);
+	xml_file<char> file(path, file_read_only);
+	unlink(path);
+	image result;
+	result.size = file.size();
+	result.words.resize(file.size() / sizeof(unsigned) + 1);
+	std::memcpy(&result.words[0], file.data(), file.size());
+	return result;
+}
+
+void test_round_trip()
+{
+	// Tape is the DOM, and so is the tape of its image, whatever the flags
+	std::vector<char> copy(catalog, catalog + sizeof(catalog));
+	xml_tape<char> tape;
+	tape.parse<parse_full>(&copy[0]);
+	XTEST_CHECK(dump_tape(tape.document()) == parsed<parse_full>(catalog));
+
+	image full = saved<parse_full>(catalog, 42);
+	XTEST_CHECK(tape.load(full.data(), full.size, parse_full, 42));
+	XTEST_CHECK(dump_tape(tape.document()) == parsed<parse_full>(catalog));
+
+	image defaults = saved<parse_default>(catalog, 0);
+	XTEST_CHECK(tape.load(defaults.data(), defaults.size, parse_default));
+	XTEST_CHECK(dump_tape(tape.document()) == parsed<parse_default>(catalog));
+
+	// Lookups by name in the image
+	xml_tape_node<char> book = tape.document().first_node("catalog").first_node("book");
+	XTEST_CHECK(book && book.first_attribute("lang") && book.next_sibling("book").first_attribute("id"));
+	XTEST_STRING(book.next_sibling("book").first_node("title").value(), 1, "C");
+
+	// Strings of images are read-only
+	XTEST_CHECK((std::is_same<decltype(tape.string(0)), const char*>::value));
+	XTEST_CHECK((std::is_same<decltype(book.name()), const char*>::value));
+}
+
+void test_rejected()
+{
+	image good = saved<parse_default>(catalog, 7);
+	xml_tape<char> tape;
+	XTEST_CHECK(tape.load(good.data(), good.size, parse_default, 7));
+
+	// Other flags, source, size and alignment
+	XTEST_CHECK(!tape.load(good.data(), good.size, parse_full, 7) && tape.size() == 1);
+	XTEST_CHECK(!tape.load(good.data(), good.size, parse_default, 8));
+	XTEST_CHECK(!tape.load(good.data(), good.size - 8, parse_default, 7));
+	XTEST_CHECK(!tape.load(good.data() + 4, good.size - 4, parse_default, 7));
+
+	// Damage caught by checksum
+	image damaged = good;
+	damaged.word(damaged.size / sizeof(unsigned) - 1) ^= 0x100;
+	XTEST_CHECK(!tape.load(damaged.data(), damaged.size, parse_default, 7));
+
+	// Damage which passes checksum: each link and string is checked against the image
+	unsigned nodes = good.word(node_count_word);
+	std::size_t attributes = header_words + nodes * node_words;
+	struct { std::size_t word; unsigned value; } changes[] =
+	{
+		{ header_words + node_words * 0 + 5, nodes + 1 },                   // Document ends beyond the tape
+		{ header_words + node_words * 1 + 5, 1 },                           // Node ends at itself
+		{ header_words + node_words * 2 + 5, nodes + 5 },                   // Subtree ends beyond the tape
+		{ header_words + node_words * 3 + 5, 7 },                           // Subtree ends beyond its parent
+		{ header_words + node_words * 1 + 0, 99 },                          // Unknown type
+		{ header_words + node_words * 1 + 0, node_document },               // Second document, which must be first
+		{ header_words + node_words * 1 + 1, 0x7FFFFFF0 },                  // Name beyond the string table
+		{ header_words + node_words * 1 + 2, 0xFFFFFFF0 },                  // Name size beyond the string table
+		{ header_words + node_words * 1 + 2, 2 },                           // Name not terminated at its size
+		{ header_words + node_words * 2 + 7, 0xFFFF },                      // Attributes beyond the tape
+		{ header_words + node_words * 2 + 6, 3 },                           // Attributes ending before they start
+		{ attributes + attribute_words * 0 + 2, 0x7FFFFFFF },               // Attribute value beyond the string table
+	};
+	for (std::size_t i = 0; i < sizeof(changes) / sizeof(changes[0]); ++i)
+	{
+		image crafted = good;
+		crafted.word(changes[i].word) = changes[i].value;
+		crafted.seal();
+		bool loaded = tape.load(crafted.data(), crafted.size, parse_default, 7);
+		if (!XTEST_CHECK(!loaded))
+			std::printf("  change %lu was accepted\n", static_cast<unsigned long>(i));
+		XTEST_CHECK(tape.size() == 1 && !tape.document().first_node());
+	}
+
+	// Unchanged image sealed again is still accepted
+	image sealed = good;
+	sealed.seal();
+	XTEST_CHECK(tape.load(sealed.data(), sealed.size, parse_default, 7));
+}
+
+} // namespace
+
+int main()
+{
+	test_round_trip();
+	test_rejected();
+	return xprocesser::xtest::report("TestTape");
+}
@@ -0,0 +1,204 @@
+/*
+ * BenchAlgorithms.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// measure(), compare() and count_markup() against scalar loops, on names and values of the input,
+// and compare() on names of typical lengths, with and without case.
+// Usage: BenchAlgorithms [file [runs]]; without a file, a 32 MB catalog is generated.
+
+#include "BenchData.h"
+
+#include "Core/Internal/CoreAlgorithms.h"
+
+using namespace xprocesser::xcore::xinternal;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Strings between markup of the input, zero-terminated in place, as the parser leaves names and values
+struct strings
+{
+	std::vector<char> text;
+	std::vector<const char*> starts;
+	std::vector<std::size_t> sizes;
+
+	explicit strings(const std::string& input)
+	: text(input.begin(), input.end())
+	{
+		text.push_back(0);
+		char* start = &text[0];
+		for (char* p = &text[0]; *p; ++p)
+		{
+			if (*p == '<' || *p == '>' || *p == ' ' || *p == '=' || *p == '"')
+			{
+				*p = 0;
+				starts.push_back(start);
+				sizes.push_back(p - start);
+				start = p + 1;
+			}
+		}
+	}
+};
+
+std::size_t measure_scalar(const char* p)
+{
+	const char* end = p;
+	while (*end)
+		++end;
+	return end - p;
+}
+
+bool compare_scalar(const char* a, const char* b, std::size_t size)
+{
+	for (std::size_t i = 0; i < size; ++i)
+		if (a[i] != b[i])
+			return false;
+	return true;
+}
+
+bool compare_upcase_scalar(const char* a, const char* b, std::size_t size)
+{
+	for (std::size_t i = 0; i < size; ++i)
+		if (lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(a[i])] != lookup_tables<0>::lookup_upcase[static_cast<unsigned char>(b[i])])
+			return false;
+	return true;
+}
+
+volatile std::size_t sink;
+
+// Zero-terminated names of one length, each followed by an equal copy, with case flipped if asked,
+// so that every compare runs to the end of the names
+struct name_pairs
+{
+	std::vector<char> text;
+	std::size_t length;
+	std::size_t count;
+
+	name_pairs(std::size_t length, std::size_t count, bool flip_case)
+	: text(count * 2 * (length + 1))
+	  , length(length)
+	  , count(count)
+	{
+		static const char letters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_-.";
+		unsigned seed = 1;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			char* name = first(i);
+			for (std::size_t j = 0; j < length; ++j)
+			{
+				seed = seed * 1103515245u + 12345u;
+				name[j] = letters[(seed >> 16) % (sizeof(letters) - 1)];
+				name[length + 1 + j] = flip_case && name[j] >= 'a' && name[j] <= 'z' ? name[j] - 'a' + 'A' : name[j];
+			}
+		}
+	}
+
+	char* first(std::size_t i)
+	{
+		return &text[i * 2 * (length + 1)];
+	}
+};
+
+// Time compare() of name pairs of given length against a scalar loop, comparing each pair repeatedly
+void bench_names(std::size_t length, bool case_sensitive, int runs)
+{
+	const std::size_t count = 4096, passes = 256;
+	name_pairs pairs(length, count, !case_sensitive);
+	best_time scalar, vector;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::size_t total = 0;
+		scalar.start();
+		for (std::size_t pass = 0; pass < passes; ++pass)
+		{
+			if (case_sensitive)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					total += compare_scalar(pairs.first(i), pairs.first(i) + length + 1, length);
+			}
+			else
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					total += compare_upcase_scalar(pairs.first(i), pairs.first(i) + length + 1, length);
+			}
+		}
+		scalar.stop();
+		vector.start();
+		for (std::size_t pass = 0; pass < passes; ++pass)
+			for (std::size_t i = 0; i < count; ++i)
+				total += compare(pairs.first(i), length, pairs.first(i) + length + 1, length, case_sensitive);
+		vector.stop();
+		sink = total;
+	}
+	char name[64];
+	std::snprintf(name, sizeof(name), "compare %lu%s, scalar loop", static_cast<unsigned long>(length), case_sensitive ? "" : " nocase");
+	print(name, scalar, passes * count * length);
+	std::snprintf(name, sizeof(name), "compare %lu%s", static_cast<unsigned long>(length), case_sensitive ? "" : " nocase");
+	print(name, vector, passes * count * length);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string input = xprocesser::xbench::input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	strings all(input);
+	std::size_t count = all.starts.size();
+	std::printf("%lu bytes, %lu strings, best of %d runs\n", static_cast<unsigned long>(input.size()), static_cast<unsigned long>(count), runs);
+
+	best_time scalar_measure, sse2_measure, scalar_compare, sse2_compare, scalar_count, sse2_count;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::size_t total = 0;
+		scalar_measure.start();
+		for (std::size_t i = 0; i < count; ++i)
+			total += measure_scalar(all.starts[i]);
+		scalar_measure.stop();
+		sse2_measure.start();
+		for (std::size_t i = 0; i < count; ++i)
+			total += measure(all.starts[i]);
+		sse2_measure.stop();
+
+		// Each string against its neighbour of the same size, as lookups by name compare candidates
+		scalar_compare.start();
+		for (std::size_t i = 1; i < count; ++i)
+			total += all.sizes[i] == all.sizes[i - 1] && compare_scalar(all.starts[i], all.starts[i - 1], all.sizes[i]);
+		scalar_compare.stop();
+		sse2_compare.start();
+		for (std::size_t i = 1; i < count; ++i)
+			total += compare(all.starts[i], all.sizes[i], all.starts[i - 1], all.sizes[i - 1], true);
+		sse2_compare.stop();
+
+		std::size_t tags = 0, equals = 0;
+		scalar_count.start();
+		for (std::size_t i = 0; i < input.size(); ++i)
+		{
+			tags += input[i] == '<';
+			equals += input[i] == '=';
+		}
+		scalar_count.stop();
+		sse2_count.start();
+		count_markup(input.data(), input.size(), tags, equals);
+		sse2_count.stop();
+		sink = total + tags + equals;
+	}
+	print("measure, scalar loop", scalar_measure, input.size());
+	print("measure", sse2_measure, input.size());
+	print("compare, scalar loop", scalar_compare, input.size());
+	print("compare", sse2_compare, input.size());
+	print("count_markup, scalar loop", scalar_count, input.size());
+	print("count_markup", sse2_count, input.size());
+
+	static const std::size_t lengths[] = { 4, 8, 16, 32 };
+	for (std::size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+	{
+		bench_names(lengths[i], true, runs);
+		bench_names(lengths[i], false, runs);
+	}
+	return 0;
+}
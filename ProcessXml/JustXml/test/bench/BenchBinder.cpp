@@ -0,0 +1,123 @@
+/*
+ * BenchBinder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of reading records into structures with the code xml_binding_generator writes, against parsing a DOM and walking it by hand.
+// Usage: BenchBinder [file [runs]]; without a file, a 32 MB catalog is generated.
+// A file must hold a catalog of the same form, which bench/BenchBinding.xml describes.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "BenchBinding.h"   // Generated from bench/BenchBinding.xml by the makefile
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Value of first child element with given name into member, if there is one
+template<class Member>
+void read_child(const xml_node<char>* node, const char* name, Member& member)
+{
+	if (const xml_node<char>* child = node->first_node(name))
+		convert_value(child->value(), child->value_size(), member);
+}
+
+// Value of attribute with given name into member, if there is one
+template<class Member>
+void read_attribute(const xml_node<char>* node, const char* name, Member& member)
+{
+	if (const xml_attribute<char>* attribute = node->first_attribute(name))
+		convert_value(attribute->value(), attribute->value_size(), member);
+}
+
+// Catalog read from DOM the way code without generated binding does, by name lookups
+void walk_dom(const xml_document<char>& document, feed::Catalog& value)
+{
+	value.items.clear();
+	const xml_node<char>* root = document.first_node("catalog");
+	for (const xml_node<char>* node = root->first_node("item"); node; node = node->next_sibling("item"))
+	{
+		value.items.push_back(feed::Item());
+		feed::Item& item = value.items.back();
+		read_attribute(node, "id", item.id);
+		read_attribute(node, "status", item.status);
+		read_child(node, "name", item.name);
+		read_child(node, "description", item.description);
+		if (const xml_node<char>* price = node->first_node("price"))
+		{
+			read_attribute(price, "currency", item.price.currency);
+			convert_value(price->value(), price->value_size(), item.price.amount);
+		}
+		if (const xml_node<char>* tags = node->first_node("tags"))
+			for (const xml_node<char>* tag = tags->first_node("tag"); tag; tag = tag->next_sibling("tag"))
+			{
+				item.tags.tags.push_back(std::string());
+				convert_value(tag->value(), tag->value_size(), item.tags.tags.back());
+			}
+	}
+}
+
+std::size_t g_items;
+
+template<int Flags>
+void bench_binder(const char* name, const std::string& text, int runs)
+{
+	xml_binder<char> binder;
+	feed::Catalog value;
+	std::vector<char> copy(text.size() + 1);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		feed::parse<Flags>(binder, &copy[0], value);
+		time.stop();
+	}
+	g_items += value.items.size();
+	print(name, time, text.size());
+}
+
+template<int Flags>
+void bench_dom(const char* name, const std::string& text, int runs)
+{
+	xml_document<char> document;
+	feed::Catalog value;
+	std::vector<char> copy(text.size() + 1);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		document.parse<Flags>(&copy[0]);
+		walk_dom(document, value);
+		time.stop();
+	}
+	g_items += value.items.size();
+	print(name, time, text.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("%lu bytes, best of %d runs\n", static_cast<unsigned long>(text.size()), runs);
+
+	// Small messages, where conversions weigh more, and the whole catalog
+	std::string message = catalog(4 << 10);
+	bench_binder<parse_default>("binder, 4 KB", message, runs * 100);
+	bench_dom<parse_default>("parse<parse_default> and walk, 4 KB", message, runs * 100);
+	bench_binder<parse_default>("binder", text, runs);
+	bench_dom<parse_default>("parse<parse_default> and walk", text, runs);
+	bench_binder<parse_non_destructive>("binder<parse_non_destructive>", text, runs);
+	bench_dom<parse_non_destructive>("parse<non_destructive> and walk", text, runs);
+	return g_items == 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * BenchData.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+#ifndef TEST_BENCH_BENCHDATA_H_
+#define TEST_BENCH_BENCHDATA_H_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace xprocesser
+{
+namespace xbench
+{
+
+// Generate catalog document of about given size, in bytes.
+// Records have attributes, nested elements and text with character references, in the mix of a typical data feed.
+inline std::string catalog(std::size_t size, unsigned seed = 1)
+{
+	static const char* words[] = { "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel" };
+	std::string out = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<catalog>\n";
+	char buffer[512];
+	for (unsigned id = 0; out.size() < size; ++id)
+	{
+		seed = seed * 1103515245u + 12345u;
+		const char* word = words[(seed >> 16) % 8];
+		std::snprintf(buffer, sizeof(buffer),
+				"  <item id=\"%u\" status=\"%s\">\n"
+				"    <name>%s %u</name>\n"
+				"    <price currency=\"EUR\">%u.%02u</price>\n"
+				"    <description>The %s item &amp; its %s parts, &lt;%u&gt; in stock</description>\n"
+				"    <tags><tag>%s</tag><tag>%s</tag></tags>\n"
+				"  </item>\n",
+				id, (seed & 0x100) ? "active" : "retired", word, id, (seed >> 8) % 1000, seed % 100,
+				word, words[(seed >> 4) % 8], (seed >> 12) % 50, word, words[(seed >> 20) % 8]);
+		out += buffer;
+	}
+	out += "</catalog>\n";
+	return out;
+}
+
+// Read whole file into string
+inline std::string load(const char* path)
+{
+	std::string out;
+	if (std::FILE* file = std::fopen(path, "rb"))
+	{
+		char buffer[65536];
+		std::size_t size;
+		while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+			out.append(buffer, size);
+		std::fclose(file);
+	}
+	else
+	{
+		std::fprintf(stderr, "cannot open %s\n", path);
+		std::exit(2);
+	}
+	return out;
+}
+
+// Input of benchmark: file given as first argument, or catalog of given size
+inline std::string input(int argc, char** argv, std::size_t size)
+{
+	return argc > 1 ? load(argv[1]) : catalog(size);
+}
+
+// Seconds since an arbitrary start
+inline double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Stopwatch keeping the best of repeated measurements
+class best_time
+{
+public:
+
+	best_time()
+	: m_best(1e30)
+	  , m_start(0){}
+
+	void start()
+	{
+		m_start = now();
+	}
+
+	void stop()
+	{
+		double elapsed = now() - m_start;
+		if (elapsed < m_best)
+			m_best = elapsed;
+	}
+
+	// Best time, in milliseconds
+	double milliseconds() const
+	{
+		return m_best * 1e3;
+	}
+
+	// Throughput of best time over given number of bytes, in MB/s
+	double throughput(std::size_t bytes) const
+	{
+		return bytes / m_best / 1e6;
+	}
+
+private:
+
+	double m_best;
+	double m_start;
+};
+
+// Print result line of benchmark
+inline void print(const char* name, const best_time& time, std::size_t bytes)
+{
+	std::printf("%-40s %9.2f ms %9.1f MB/s\n", name, time.milliseconds(), time.throughput(bytes));
+}
+
+} /* namespace xbench */
+} /* namespace xprocesser */
+
+#endif /* TEST_BENCH_BENCHDATA_H_ */
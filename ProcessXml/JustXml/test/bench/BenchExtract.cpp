@@ -0,0 +1,81 @@
+/*
+ * BenchExtract.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of extracting paths from a whole text, against parsing it into a DOM and querying the same paths.
+// Usage: BenchExtract [file [runs]]; without a file, a 32 MB catalog is generated.
+// The last path is never found, so that extraction reads all of the text, as the DOM parser does.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/XmlExtractor.h"
+#include "Core/XmlQuery.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+const char* paths[] = { "/catalog/item/@id", "/catalog/item/price/@currency", "/catalog/item/name", "/catalog/missing" };
+const std::size_t path_count = sizeof(paths) / sizeof(paths[0]);
+
+template<int Flags>
+void bench_extract(const char* name, const std::string& text, int runs)
+{
+	xml_extractor<char> extractor;
+	for (std::size_t i = 0; i < path_count; ++i)
+		extractor.add(paths[i]);
+	std::vector<xml_extractor<char>::result> results(extractor.size());
+	std::vector<char> copy(text.size() + 1);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		extractor.extract<Flags>(&copy[0], &results[0]);
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+template<int Flags>
+void bench_dom(const char* name, const std::string& text, int runs)
+{
+	xml_query<char> queries[path_count];
+	for (std::size_t i = 0; i < path_count; ++i)
+		queries[i].compile(paths[i]);
+	std::vector<char> copy(text.size() + 1);
+	xml_document<char> document;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		document.parse<Flags>(&copy[0]);
+		for (std::size_t i = 0; i < path_count; ++i)
+			queries[i].first(&document);
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("%lu bytes, best of %d runs\n", static_cast<unsigned long>(text.size()), runs);
+
+	bench_extract<parse_default>("extract<parse_default>", text, runs);
+	bench_dom<parse_default>("parse<parse_default> and query", text, runs);
+	bench_extract<parse_non_destructive>("extract<parse_non_destructive>", text, runs);
+	bench_dom<parse_non_destructive>("parse<non_destructive> and query", text, runs);
+	return 0;
+}
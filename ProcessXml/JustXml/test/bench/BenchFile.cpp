@@ -0,0 +1,102 @@
+/*
+ * BenchFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Load and parse time of a file, read into a vector as rapidxml::file does, or loaded by xml_file.
+// Usage: BenchFile [file [runs]]; without a file, a 256 MB catalog is written to /tmp.
+// File stays in the page cache between runs, so times are those of a warm cache.
+
+#include <fstream>
+
+#include <unistd.h>
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/XmlFile.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Load as rapidxml::file: size from seekg/tellg, then read into a zero-terminated vector
+void load_vector(const char* path, std::vector<char>& data)
+{
+	std::ifstream stream(path, std::ios::binary);
+	stream.seekg(0, std::ios::end);
+	std::size_t size = static_cast<std::size_t>(stream.tellg());
+	stream.seekg(0);
+	data.resize(size + 1);
+	stream.read(&data[0], static_cast<std::streamsize>(size));
+	data[size] = 0;
+}
+
+template<int Flags>
+void bench_vector(const char* name, const char* path, std::size_t bytes, int runs)
+{
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		{
+			std::vector<char> data;
+			load_vector(path, data);
+			xml_document<char> document;
+			document.parse<Flags>(&data[0]);
+		}
+		time.stop();
+	}
+	print(name, time, bytes);
+}
+
+template<int Flags>
+void bench_file(const char* name, const char* path, file_mode mode, std::size_t bytes, int runs)
+{
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		{
+			xml_file<char> file(path, mode);
+			xml_document<char> document;
+			file.parse<Flags>(document);
+		}
+		time.stop();
+	}
+	print(name, time, bytes);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	const char* path = argc > 1 ? argv[1] : "/tmp/BenchFile.xml";
+	int runs = argc > 2 ? std::atoi(argv[2]) : 5;
+	if (argc <= 1)
+	{
+		std::string text = catalog(256 << 20);
+		std::ofstream(path, std::ios::binary).write(text.data(), text.size());
+	}
+	std::vector<char> data;
+	load_vector(path, data);
+	std::size_t bytes = data.size() - 1;
+	std::vector<char>().swap(data);
+	std::printf("%lu bytes, best of %d runs, load and parse\n", static_cast<unsigned long>(bytes), runs);
+
+	bench_vector<parse_default>("vector copy, parse<parse_default>", path, bytes, runs);
+	bench_vector<parse_non_destructive>("vector copy, parse<non_destructive>", path, bytes, runs);
+	bench_file<parse_default>("xml_file copy-on-write, parse_default", path, file_copy_on_write, bytes, runs);
+	bench_file<parse_non_destructive>("xml_file copy-on-write, non_destructive", path, file_copy_on_write, bytes, runs);
+	bench_file<parse_default>("xml_file read-only, parse_default", path, file_read_only, bytes, runs);
+	bench_file<parse_non_destructive>("xml_file read-only, non_destructive", path, file_read_only, bytes, runs);
+
+	if (argc <= 1)
+		unlink(path);
+	return 0;
+}
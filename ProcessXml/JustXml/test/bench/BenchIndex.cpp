@@ -0,0 +1,99 @@
+/*
+ * BenchIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of two-stage parsing with xflags::parse_structural_index, against its first stage alone and against single stage parsing.
+// Usage: BenchIndex [file [runs]]; without a file, a 32 MB catalog is generated.
+// Each text is also timed with a long comment and a CDATA section added to each record,
+// which single stage parsing reads one character at a time and the second stage takes from the index.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/Internal/StructuralIndex.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Text with a comment and a CDATA section of given size after every record
+std::string annotated(const std::string& text, std::size_t size)
+{
+	std::string notes = "<!--" + std::string(size, 'c') + "--><![CDATA[" + std::string(size, 'd') + "]]>\n";
+	std::string out;
+	out.reserve(text.size() * 2);
+	std::size_t start = 0;
+	for (std::size_t end; (end = text.find("</item>", start)) != std::string::npos; start = end)
+	{
+		end += 7;
+		out.append(text, start, end - start);
+		out += notes;
+	}
+	out.append(text, start, std::string::npos);
+	return out;
+}
+
+// Time first stage alone, on copies of text as the parser gets them
+void bench_stage_1(const char* name, const std::string& text, int runs)
+{
+	std::vector<char> copy(text.size() + 1);
+	xprocesser::xcore::xinternal::structural_index<char> index;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		index.build(&copy[0], false);
+		time.stop();
+	}
+	print(name, time, text.size());
+	std::printf("%-40s %9.1f positions per KB\n", "index", index.size() * 1024.0 / text.size());
+}
+
+// Time parse of copies of text with given flags into one document, which keeps its memory pool and index
+template<int Flags>
+void bench(const char* name, const std::string& text, int runs)
+{
+	std::vector<char> copy(text.size() + 1);
+	xml_document<char> document;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		document.parse<Flags>(&copy[0]);
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+void bench_text(const char* title, const std::string& text, int runs)
+{
+	std::printf("%s: %lu bytes\n", title, static_cast<unsigned long>(text.size()));
+	bench_stage_1("stage 1 alone", text, runs);
+	bench<parse_structural_index>("parse<parse_structural_index>", text, runs);
+	bench<parse_default>("parse<parse_default>", text, runs);
+	bench<parse_structural_index | parse_non_destructive>("parse<structural_index | non_destructive>", text, runs);
+	bench<parse_non_destructive>("parse<parse_non_destructive>", text, runs);
+	bench<parse_structural_index | parse_full>("parse<structural_index | full>", text, runs);
+	bench<parse_full>("parse<parse_full>", text, runs);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("best of %d runs\n", runs);
+
+	bench_text("text", text, runs);
+	bench_text("text with 200 byte comment and CDATA per record", annotated(text, 200), runs);
+	return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * BenchMapping.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of mapping records onto objects, against extracting the same paths and against parsing a DOM and querying them.
+// Usage: BenchMapping [file [runs]]; without a file, a 32 MB catalog is generated.
+// The first record is taken by mapping and extraction alike, which stop reading after it;
+// all records are taken by mapping, and by queries relative to each record of a parsed document.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/XmlExtractor.h"
+#include "Core/XmlMapping.h"
+#include "Core/XmlQuery.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+struct Item
+{
+	Item() : id(0), price(0) {}
+	unsigned id;
+	std::string status;
+	std::string name;
+	double price;
+	std::string currency;
+	std::string description;
+	std::string tag;
+};
+
+// Paths of members within record, and the same paths from the document
+const char* members[] = { "@id", "@status", "name", "price", "price/@currency", "description", "tags/tag" };
+const char* paths[] = { "/catalog/item/@id", "/catalog/item/@status", "/catalog/item/name", "/catalog/item/price",
+		"/catalog/item/price/@currency", "/catalog/item/description", "/catalog/item/tags/tag" };
+const std::size_t member_count = sizeof(members) / sizeof(members[0]);
+
+void add_members(xml_mapping<char>& mapping)
+{
+	mapping.record("/catalog/item");
+	mapping.add(members[0], &Item::id);
+	mapping.add(members[1], &Item::status);
+	mapping.add(members[2], &Item::name);
+	mapping.add(members[3], &Item::price);
+	mapping.add(members[4], &Item::currency);
+	mapping.add(members[5], &Item::description);
+	mapping.add(members[6], &Item::tag);
+}
+
+// Convert values found for the paths into item, in the order of members
+template<class Found>
+void convert(const Found& found, Item& item)
+{
+	item = Item();
+	if (found.value(0))
+		convert_value(found.value(0), found.size(0), item.id);
+	if (found.value(1))
+		convert_value(found.value(1), found.size(1), item.status);
+	if (found.value(2))
+		convert_value(found.value(2), found.size(2), item.name);
+	if (found.value(3))
+		convert_value(found.value(3), found.size(3), item.price);
+	if (found.value(4))
+		convert_value(found.value(4), found.size(4), item.currency);
+	if (found.value(5))
+		convert_value(found.value(5), found.size(5), item.description);
+	if (found.value(6))
+		convert_value(found.value(6), found.size(6), item.tag);
+}
+
+// Values of extraction
+struct extracted
+{
+	const xml_extractor<char>::result* results;
+	const char* value(std::size_t i) const { return results[i].value; }
+	std::size_t size(std::size_t i) const { return results[i].size; }
+};
+
+// Values of queries from a record
+struct queried
+{
+	const Xml_Base<char>* found[member_count];
+	const char* value(std::size_t i) const { return found[i] ? found[i]->value() : 0; }
+	std::size_t size(std::size_t i) const { return found[i]->value_size(); }
+};
+
+// Copies of a text parsed by a run, restored before each run since parsing may modify them
+class copies
+{
+public:
+
+	copies(const std::string& text, std::size_t count)
+	: m_text(text), m_copies(count, std::vector<char>(text.size() + 1)) {}
+
+	void restore()
+	{
+		for (std::size_t i = 0; i < m_copies.size(); ++i)
+			std::memcpy(&m_copies[i][0], m_text.c_str(), m_text.size() + 1);
+	}
+
+	std::size_t size() const
+	{
+		return m_copies.size();
+	}
+
+	char* operator[](std::size_t i)
+	{
+		return &m_copies[i][0];
+	}
+
+	std::size_t bytes() const
+	{
+		return m_text.size() * m_copies.size();
+	}
+
+private:
+
+	const std::string& m_text;
+	std::vector<std::vector<char> > m_copies;
+};
+
+std::size_t g_items;
+
+template<int Flags>
+void bench_map_first(const char* name, copies& texts, int runs)
+{
+	xml_mapping<char> mapping;
+	add_members(mapping);
+	Item item;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		texts.restore();
+		time.start();
+		for (std::size_t i = 0; i < texts.size(); ++i)
+			g_items += mapping.map<Flags>(texts[i], item);
+		time.stop();
+	}
+	print(name, time, texts.bytes());
+}
+
+template<int Flags>
+void bench_extract_first(const char* name, copies& texts, int runs)
+{
+	xml_extractor<char> extractor;
+	for (std::size_t i = 0; i < member_count; ++i)
+		extractor.add(paths[i]);
+	std::vector<xml_extractor<char>::result> results(extractor.size());
+	extracted found = { &results[0] };
+	Item item;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		texts.restore();
+		time.start();
+		for (std::size_t i = 0; i < texts.size(); ++i)
+		{
+			g_items += extractor.extract<Flags>(texts[i], &results[0]) != 0;
+			convert(found, item);
+		}
+		time.stop();
+	}
+	print(name, time, texts.bytes());
+}
+
+template<int Flags>
+void bench_map_all(const char* name, copies& texts, int runs)
+{
+	xml_mapping<char> mapping;
+	add_members(mapping);
+	std::vector<Item> items;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		texts.restore();
+		time.start();
+		for (std::size_t i = 0; i < texts.size(); ++i)
+			g_items += mapping.map<Flags>(texts[i], items);
+		time.stop();
+	}
+	print(name, time, texts.bytes());
+}
+
+template<int Flags>
+void bench_query_all(const char* name, copies& texts, int runs)
+{
+	xml_query<char> records("/catalog/item");
+	xml_query<char> queries[member_count];
+	for (std::size_t i = 0; i < member_count; ++i)
+		queries[i].compile(members[i]);
+	std::vector<Xml_Base<char>*> nodes(texts.bytes() / texts.size() / 64 + 1);
+	std::vector<Item> items;
+	xml_document<char> document;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		texts.restore();
+		time.start();
+		for (std::size_t text = 0; text < texts.size(); ++text)
+		{
+			document.parse<Flags>(texts[text]);
+			std::size_t count = records.select(&document, &nodes[0], nodes.size());
+			items.resize(count);
+			for (std::size_t record = 0; record < count; ++record)
+			{
+				queried found;
+				for (std::size_t i = 0; i < member_count; ++i)
+					found.found[i] = queries[i].first(static_cast<xml_node<char>*>(nodes[record]));
+				convert(found, items[record]);
+			}
+			g_items += count;
+		}
+		time.stop();
+	}
+	print(name, time, texts.bytes());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("%lu bytes, best of %d runs\n", static_cast<unsigned long>(text.size()), runs);
+
+	// First record, and all records, of each of a thousand small messages
+	std::string message = catalog(4 << 10);
+	copies messages(message, 1000);
+	bench_map_first<parse_default>("map first record, 1000 x 4 KB", messages, runs);
+	bench_extract_first<parse_default>("extract first record, 1000 x 4 KB", messages, runs);
+	bench_map_all<parse_default>("map all records, 1000 x 4 KB", messages, runs);
+	bench_query_all<parse_default>("parse and query all, 1000 x 4 KB", messages, runs);
+
+	// All records of the whole text
+	copies whole(text, 1);
+	bench_map_all<parse_default>("map all records", whole, runs);
+	bench_query_all<parse_default>("parse and query all records", whole, runs);
+	bench_map_all<parse_non_destructive>("map<non_destructive> all records", whole, runs);
+	bench_query_all<parse_non_destructive>("parse<non_destructive>, query all", whole, runs);
+	return g_items == 0;
+}
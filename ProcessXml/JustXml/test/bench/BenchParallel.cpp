@@ -0,0 +1,74 @@
+/*
+ * BenchParallel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Scaling of parse_parallel() with 1 to 32 threads, against parse() in one thread.
+// Usage: BenchParallel [file [runs]]; without a file, a 64 MB catalog is generated.
+// Scaling has only been measured on one core, where no thread count beats parse(): with parse_default,
+// 2 to 32 threads take 1.2 to 1.7 times as long, in 300 to 430 ms against 252 to 256 ms; parse_parallel() with 1 thread
+// takes as long as parse(), and with parse_non_destructive every count is within noise of it.
+// Whether splitting and linking parts beats parse() on several cores is still to be measured.
+
+#include <thread>
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Time parse of copies of text, in one thread if threads is 0
+template<int Flags>
+best_time bench(const std::string& text, unsigned threads, int runs)
+{
+	std::vector<char> copy(text.size() + 1);
+	xml_document<char> document;
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		if (threads)
+			document.parse_parallel<Flags>(&copy[0], threads);
+		else
+			document.parse<Flags>(&copy[0]);
+		time.stop();
+	}
+	return time;
+}
+
+template<int Flags>
+void scaling(const char* name, const std::string& text, int runs)
+{
+	best_time serial = bench<Flags>(text, 0, runs);
+	std::printf("%s\n", name);
+	print("  parse()", serial, text.size());
+	for (unsigned threads = 1; threads <= 32; threads *= 2)
+	{
+		best_time parallel = bench<Flags>(text, threads, runs);
+		char label[64];
+		std::snprintf(label, sizeof(label), "  parse_parallel(), %u threads", threads);
+		std::printf("%-40s %9.2f ms %9.1f MB/s %6.2fx\n", label, parallel.milliseconds(), parallel.throughput(text.size()),
+				serial.milliseconds() / parallel.milliseconds());
+	}
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 64 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 5;
+	std::printf("%lu bytes, best of %d runs, %u hardware threads\n", static_cast<unsigned long>(text.size()), runs, std::thread::hardware_concurrency());
+	scaling<parse_default>("parse_default", text, runs);
+	scaling<parse_non_destructive>("parse_non_destructive", text, runs);
+	return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * BenchPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of parsing with the memory pool set up in different ways: kept across parses, with growing or huge-page blocks,
+// and sized up front by parse_presize, against measuring the text alone.
+// Usage: BenchPool [file [runs]]; without a file, a 32 MB catalog is generated, and a 256 KB one for repeated parses.
+// Throughput of repeated parses is given over the size of all texts parsed.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/Internal/CoreAlgorithms.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+// Pool settings of a benchmark
+struct setup
+{
+	std::size_t retention;
+	std::size_t first_block;
+	std::size_t growth;
+	std::size_t largest_block;
+	bool huge_pages;
+};
+
+const setup plain = { 0, RAPIDXML_DYNAMIC_POOL_SIZE, 1, RAPIDXML_DYNAMIC_POOL_SIZE, false };
+
+void configure(xml_document<char>& document, const setup& pool)
+{
+	document.set_retention(pool.retention);
+	document.set_block_sizes(pool.first_block, pool.growth, pool.largest_block);
+	document.set_huge_pages(pool.huge_pages);
+}
+
+// Time parse of copies of text with given flags into one document
+template<int Flags>
+void bench(const char* name, const std::string& text, const setup& pool, int runs)
+{
+	std::vector<char> copy(text.size() + 1);
+	xml_document<char> document;
+	configure(document, pool);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+		time.start();
+		document.parse<Flags>(&copy[0]);
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+// Time parse of text of known size, left as it is
+template<int Flags>
+void bench_const(const char* name, const std::string& text, const setup& pool, int runs)
+{
+	xml_document<char> document;
+	configure(document, pool);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		document.parse<Flags>(text.data(), text.size());
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+// Time of a batch of parses of a small text, as a request loop makes them
+template<int Flags>
+void bench_loop(const char* name, const std::string& text, const setup& pool, int runs)
+{
+	const int batch = 200;
+	std::vector<char> copy(text.size() + 1);
+	xml_document<char> document;
+	configure(document, pool);
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		for (int i = 0; i < batch; ++i)
+		{
+			std::memcpy(&copy[0], text.c_str(), text.size() + 1);
+			document.parse<Flags>(&copy[0]);
+		}
+		time.stop();
+	}
+	print(name, time, text.size() * batch);
+}
+
+std::size_t g_size;
+
+// Time of measuring text, the pass parse_presize would need to size the pool for zero-terminated text without XPROC_COMPACT_NODES,
+// where parse(ItemType*) ignores the flag
+void bench_measure(const char* name, const std::string& text, int runs)
+{
+	best_time time;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		g_size += xprocesser::xcore::xinternal::measure(text.c_str());
+		time.stop();
+	}
+	print(name, time, text.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	std::string small = argc > 1 ? text : catalog(256 << 10);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("%lu bytes, best of %d runs\n", static_cast<unsigned long>(text.size()), runs);
+
+	// Blocks kept by clear(), for a loop parsing small documents
+	const setup retained = { 1 << 30, RAPIDXML_DYNAMIC_POOL_SIZE, 1, RAPIDXML_DYNAMIC_POOL_SIZE, false };
+	bench_loop<parse_default>("200 parses, blocks freed", small, plain, runs);
+	bench_loop<parse_default>("200 parses, blocks kept", small, retained, runs);
+
+	// Geometry of blocks
+	const setup growing = { 0, RAPIDXML_DYNAMIC_POOL_SIZE, 2, 64 << 20, false };
+	const setup huge = { 0, RAPIDXML_DYNAMIC_POOL_SIZE, 2, 64 << 20, true };
+	bench<parse_default>("parse, 64 KB blocks", text, plain, runs);
+	bench<parse_default>("parse, growing blocks", text, growing, runs);
+	bench<parse_default>("parse, growing huge-page blocks", text, huge, runs);
+
+	// Pool sized up front, for text zero-terminated and of known size
+	bench_measure("measure() alone", text, runs);
+	bench<parse_default>("parse<parse_default>", text, plain, runs);
+	bench<parse_presize>("parse<parse_presize>", text, plain, runs);
+	bench_const<parse_default>("parse<parse_default>(const, size)", text, plain, runs);
+	bench_const<parse_presize>("parse<parse_presize>(const, size)", text, plain, runs);
+	bench_const<parse_default>("parse<parse_default>(const, size), kept", text, retained, runs);
+	bench_const<parse_presize>("parse<parse_presize>(const, size), kept", text, retained, runs);
+	bench_const<parse_presize>("parse<parse_presize>(const, size), huge", text, huge, runs);
+	return g_size == 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * BenchQuery.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Time of queries over a parsed document, against loops over nodes written by hand selecting the same nodes.
+// Usage: BenchQuery [file [runs]]; without a file, a 32 MB catalog is generated.
+// Throughput is given over the size of the text, though only the tree is read.
+
+#include "BenchData.h"
+
+#include "Core/XmlDocument.h"
+#include "Core/XmlQuery.h"
+
+using namespace xprocesser::xcore;
+using namespace xprocesser::xcore::xinternal::xflags;
+using namespace xprocesser::xbench;
+
+namespace
+{
+
+std::vector<Xml_Base<char>*> g_results;
+
+// Time selection of query from the document into results
+void bench_query(const char* name, const char* text, xml_document<char>& document, std::size_t bytes, int runs)
+{
+	xml_query<char> query(text);
+	best_time time;
+	std::size_t count = 0;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		count = query.select(&document, &g_results[0], g_results.size());
+		time.stop();
+	}
+	print(name, time, bytes);
+	std::printf("%-40s %9lu results\n", "", static_cast<unsigned long>(count));
+}
+
+// Select /catalog/item/price/@currency by hand
+std::size_t select_currencies(xml_document<char>& document)
+{
+	std::size_t count = 0;
+	for (xml_node<char>* catalog = document.first_node("catalog"); catalog; catalog = catalog->next_sibling("catalog"))
+		for (xml_node<char>* item = catalog->first_node("item"); item; item = item->next_sibling("item"))
+			for (xml_node<char>* price = item->first_node("price"); price; price = price->next_sibling("price"))
+				if (xml_attribute<char>* currency = price->first_attribute("currency"))
+					g_results[count++] = currency;
+	return count;
+}
+
+// Select //tag by hand
+std::size_t select_tags(xml_node<char>* node, std::size_t count)
+{
+	for (xml_node<char>* child = node->first_node(); child; child = child->next_sibling())
+		if (child->type() == node_element)
+		{
+			if (child->name_size() == 3 && std::memcmp(child->name(), "tag", 3) == 0)
+				g_results[count++] = child;
+			count = select_tags(child, count);
+		}
+	return count;
+}
+
+template<class Select>
+void bench_loop(const char* name, Select select, std::size_t bytes, int runs)
+{
+	best_time time;
+	std::size_t count = 0;
+	for (int run = 0; run < runs; ++run)
+	{
+		time.start();
+		count = select();
+		time.stop();
+	}
+	print(name, time, bytes);
+	std::printf("%-40s %9lu results\n", "", static_cast<unsigned long>(count));
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::string text = input(argc, argv, 32 << 20);
+	int runs = argc > 2 ? std::atoi(argv[2]) : 10;
+	std::printf("%lu bytes, best of %d runs\n", static_cast<unsigned long>(text.size()), runs);
+
+	std::vector<char> copy(text.begin(), text.end());
+	copy.push_back(0);
+	xml_document<char> document;
+	document.parse<parse_default>(&copy[0]);
+	g_results.resize(text.size() / 8);
+
+	bench_query("/catalog/item/price/@currency", "/catalog/item/price/@currency", document, text.size(), runs);
+	bench_loop("  loops by name", [&] { return select_currencies(document); }, text.size(), runs);
+	bench_query("//tag", "//tag", document, text.size(), runs);
+	bench_loop("  recursive walk", [&] { return select_tags(&document, 0); }, text.size(), runs);
+	bench_query("/catalog/item[@status='active']/name", "/catalog/item[@status='active']/name", document, text.size(), runs);
+	bench_query("/catalog/item[2]/tags/tag[2]", "/catalog/item[2]/tags/tag[2]", document, text.size(), runs);
+	return 0;
+}
@@ -0,0 +1,48 @@
+/*
+ * GenerateBinding.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: LavishK1
+ */
+
+// Build step writing header of xml_binding_generator for a schema.
+// Usage: GenerateBinding schema header
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "Core/XmlBindingGenerator.h"
+
+using namespace xprocesser::xcore;
+
+int main(int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		std::fprintf(stderr, "usage: %s schema header\n", argv[0]);
+		return 2;
+	}
+	std::ifstream input(argv[1], std::ios::binary);
+	std::stringstream schema;
+	schema << input.rdbuf();
+	std::string text = schema.str();
+	if (!input || text.empty())
+	{
+		std::fprintf(stderr, "%s: cannot read schema\n", argv[1]);
+		return 1;
+	}
+
+	xml_binding_generator generator;
+	try
+	{
+		generator.parse_schema(&text[0]);
+	}
+	catch (const parse_error& error)
+	{
+		std::fprintf(stderr, "%s:%lu: %s\n", argv[1], static_cast<unsigned long>(error.where<char>() - text.data()), error.what());
+		return 1;
+	}
+	std::ofstream(argv[2], std::ios::binary) << generator.header();
+	return 0;
+}